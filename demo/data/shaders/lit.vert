@@ -7,8 +7,8 @@ layout(std140, set = 0, binding = 0) uniform VP {
 	vec4 pos_v;
 };
 
-layout(std140, set = 1, binding = 0) uniform M {
-	mat4 mat_m;
+layout(std430, set = 1, binding = 0) readonly buffer M {
+	mat4 mat_ms[];
 };
 
 layout(location = 0) in vec3 vertPos;
@@ -27,6 +27,7 @@ out gl_PerVertex {
 };
 
 void main() {
+	mat4 mat_m = mat_ms[gl_InstanceIndex];
 	fragColour = vertColour;
 	uv = texCoord;
 	fragPos = mat_m * vec4(vertPos, 1.0);
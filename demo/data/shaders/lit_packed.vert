@@ -0,0 +1,52 @@
+#version 450 core
+
+layout(std140, set = 0, binding = 0) uniform VP {
+	mat4 mat_v;
+	mat4 mat_p;
+	mat4 mat_ui;
+	vec4 pos_v;
+};
+
+layout(std430, set = 1, binding = 0) readonly buffer M {
+	mat4 mat_ms[];
+};
+
+// graphics::Dequantize
+layout(push_constant) uniform DQ {
+	vec4 dq_offset;
+	vec4 dq_scale;
+};
+
+// graphics::CompactVertex / graphics::QuantizedVertex
+layout(location = 0) in vec3 vertPos;
+layout(location = 1) in vec4 vertColour;
+layout(location = 2) in vec2 octNormal;
+layout(location = 3) in vec2 texCoord;
+
+layout(location = 0) out vec4 fragColour;
+layout(location = 1) out vec2 uv;
+layout(location = 2) out vec4 fragPos;
+layout(location = 3) out vec3 viewPos;
+layout(location = 4) out vec3 fragNorm;
+
+out gl_PerVertex {
+	vec4 gl_Position;
+};
+
+vec3 octDecode(vec2 oct) {
+	vec3 ret = vec3(oct, 1.0 - abs(oct.x) - abs(oct.y));
+	float t = max(-ret.z, 0.0);
+	ret.x += ret.x >= 0.0 ? -t : t;
+	ret.y += ret.y >= 0.0 ? -t : t;
+	return normalize(ret);
+}
+
+void main() {
+	mat4 mat_m = mat_ms[gl_InstanceIndex];
+	fragColour = vertColour;
+	uv = texCoord;
+	fragPos = mat_m * vec4(vertPos * dq_scale.xyz + dq_offset.xyz, 1.0);
+	viewPos = vec3(pos_v);
+	fragNorm = normalize(mat3(mat_m) * octDecode(octNormal));
+	gl_Position = mat_p * mat_v * fragPos;
+}
@@ -6,8 +6,8 @@ layout(std140, set = 0, binding = 0) uniform VP {
 	mat4 mat_ui;
 };
 
-layout(std140, set = 1, binding = 0) uniform M {
-	mat4 mat_m;
+layout(std430, set = 1, binding = 0) readonly buffer M {
+	mat4 mat_ms[];
 };
 
 layout(location = 0) in vec3 vertPos;
@@ -23,6 +23,7 @@ out gl_PerVertex {
 };
 
 void main() {
+	mat4 mat_m = mat_ms[gl_InstanceIndex];
 	gl_Position = mat_ui * mat_m * vec4(vertPos, 1.0);
 	fragColour = vertColour;
 	uv = texCoord;
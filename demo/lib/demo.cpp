@@ -31,6 +31,7 @@
 
 #include <dumb_tasks/executor.hpp>
 #include <ktl/async/kthread.hpp>
+#include <levk/core/utils/data_store.hpp>
 #include <levk/engine/builder.hpp>
 #include <levk/engine/render/shader_data.hpp>
 #include <levk/gameplay/ecs/components/spring_arm.hpp>
@@ -85,6 +86,13 @@ struct DirLights {
 	alignas(4) u32 count;
 };
 
+// Material block of lit_bindless.frag
+struct BindlessMaterial {
+	graphics::BPMaterialData::Std140 material;
+	// bindless indices: diffuse, alpha (rmo), specular
+	alignas(16) glm::uvec4 textures{};
+};
+
 struct PlayerController {
 	glm::quat target = graphics::identity;
 	f32 roll = 0.0f;
@@ -127,7 +135,8 @@ class Renderer : public ListRenderer {
 		Span<DirLight const> lights;
 	};
 
-	void render(RenderPass& out_rp, ShaderBufferMap& sbMap, SceneData data, AssetStore const& store, dens::registry const& registry) {
+	void render(RenderPass& out_rp, ShaderBufferMap& sbMap, SceneData data, AssetStore const& store, dens::registry const& registry,
+				Opt<dts::executor> executor = {}) {
 		m_mats = &sbMap.get("mats");
 		m_mats->write(data.view);
 		m_lights = &sbMap.get("lights");
@@ -140,8 +149,9 @@ class Renderer : public ListRenderer {
 			m_lights->write(DirLights());
 		}
 		auto& map = data.custom;
+		m_frustum = graphics::Frustum::make(data.view.mat_perspective * data.view.mat_view);
 		fill(map, store, registry);
-		ListRenderer::render(out_rp, store, std::move(map));
+		ListRenderer::render(out_rp, store, std::move(map), executor);
 	}
 
   private:
@@ -150,10 +160,17 @@ class Renderer : public ListRenderer {
 		set0.update(0, *m_mats);
 		set0.update(1, *m_lights);
 		for (auto const& drawObj : list) {
-			map.nextSet(drawObj.bindings, 1).update(0, drawObj.matrix);
+			map.nextSet(drawObj.bindings, 1).update(0, drawObj.matrices);
 			for (auto const& obj : drawObj.objs) {
 				auto const& primitive = obj.primitive;
 				auto const smat = primitive.blinnPhong ? primitive.blinnPhong->std140() : graphics::BPMaterialData::Std140{};
+				if (auto const diffuse = map.textureIndex(primitive.textures[MatTexType::eDiffuse])) {
+					// bindless: textures are referenced by index, no per-object texture set
+					glm::uvec4 const textures = {*diffuse, *map.textureIndex(primitive.textures[MatTexType::eAlpha]),
+												 *map.textureIndex(primitive.textures[MatTexType::eSpecular], TextureFallback::eBlack), 0U};
+					map.nextSet(obj.bindings, 3).update(0, BindlessMaterial{smat, textures});
+					continue;
+				}
 				auto set2 = map.nextSet(obj.bindings, 2);
 				set2.update(0, primitive.textures[MatTexType::eDiffuse]);
 				set2.update(1, primitive.textures[MatTexType::eAlpha]);
@@ -389,9 +406,13 @@ class App : public input::Receiver, public Scene {
 			m_registry.attach(skybox, AssetProvider<graphics::Skybox>("skyboxes/sky_dusk"));
 			m_registry.attach(skybox, RenderPipeProvider("render_pipelines/skybox"));
 		}
+		// bindless textures if supported (compare "Descriptor set binds" in the editor stats)
+		char const* const lit = engine().context().pipelineFactory().bindless() ? "render_pipelines/lit_bindless" : "render_pipelines/lit";
+		// quantized vertices (meshes/nanosuit): pipeline vertex format must match the mesh's
+		char const* const litPacked = engine().context().pipelineFactory().bindless() ? "render_pipelines/lit_bindless_packed" : "render_pipelines/lit_packed";
 		{
 			PrimitiveProvider provider("mesh_primitives/cube", "materials/bp/player/cube", "texture_uris/player/cube");
-			m_data.player = spawn("player", provider, "render_pipelines/lit");
+			m_data.player = spawn("player", provider, lit);
 			m_registry.attach(m_data.player, std::move(provider));
 			m_registry.get<Transform>(m_data.player).position({0.0f, 0.0f, 5.0f});
 			m_registry.attach<PlayerController>(m_data.player);
@@ -400,21 +421,21 @@ class App : public input::Receiver, public Scene {
 			m_onCollide += [](auto&&) { logD("Collided!"); };
 		}
 		{
-			auto ent0 = spawn("model_0_0", AssetProvider<graphics::Mesh>("meshes/plant"), "render_pipelines/lit");
+			auto ent0 = spawn("model_0_0", AssetProvider<graphics::Mesh>("meshes/plant"), lit);
 			m_registry.get<Transform>(ent0).position({-2.0f, -1.0f, 2.0f});
 			m_data.entities["model_0_0"] = ent0;
 
-			auto ent1 = spawn("model_0_1", AssetProvider<graphics::Mesh>("meshes/plant"), "render_pipelines/lit");
+			auto ent1 = spawn("model_0_1", AssetProvider<graphics::Mesh>("meshes/plant"), lit);
 			auto& node = m_registry.get<Transform>(ent1);
 			node.position({-2.0f, -1.0f, 5.0f});
 			m_data.entities["model_0_1"] = ent1;
 			m_registry.get<SceneNode>(ent1).parent(m_registry, m_data.entities["model_0_0"]);
 		}
 		{
-			auto ent0 = spawn("model_1_0", AssetProvider<graphics::Mesh>("meshes/teapot"), "render_pipelines/lit");
+			auto ent0 = spawn("model_1_0", AssetProvider<graphics::Mesh>("meshes/teapot"), lit);
 			m_registry.get<Transform>(ent0).position({2.0f, -1.0f, 2.0f});
 			m_data.entities["model_1_0"] = ent0;
-			auto ent = spawn("model_1", AssetProvider<graphics::Mesh>("meshes/nanosuit"), "render_pipelines/lit");
+			auto ent = spawn("model_1", AssetProvider<graphics::Mesh>("meshes/nanosuit"), litPacked);
 			m_registry.get<Transform>(ent).position({-1.0f, -2.0f, -3.0f});
 			m_data.entities["model_1"] = ent;
 		}
@@ -467,6 +488,16 @@ class App : public input::Receiver, public Scene {
 			pos.x = tweener.current();
 			m_registry.get<Transform>(node).position(pos);
 		}
+		if (auto stress = DataObject<u32>("stress")) {
+			// instancing stress test: a grid of identical cubes collapses into a single draw call
+			auto const side = u32(std::ceil(std::sqrt(f32(*stress))));
+			for (u32 i = 0; i < *stress; ++i) {
+				auto ent = spawn(fmt::format("stress/{}", i), PrimitiveProvider("mesh_primitives/cube", "materials/bp/yellow"), "render_pipelines/basic");
+				glm::vec2 const xz = glm::vec2(f32(i % side), f32(i / side)) - glm::vec2(f32(side) * 0.5f);
+				m_registry.get<Transform>(ent).position({xz.x * 1.5f, -4.0f, xz.y * 1.5f}).scale(0.5f);
+			}
+			logI("[Demo] Spawned [{}] stress test entities", *stress);
+		}
 		{
 			auto ent = spawnNode("emitter");
 			m_emitter.textures.textures[graphics::MatTexType::eDiffuse] = "textures/awesomeface.png";
@@ -637,7 +668,7 @@ class App : public input::Receiver, public Scene {
 		Renderer::SceneData scene;
 		scene.view = view;
 		scene.lights = m_data.dirLights;
-		Renderer{}.render(renderPass, shaderBufferMap(), scene, engine().store(), m_registry);
+		Renderer{}.render(renderPass, shaderBufferMap(), scene, engine().store(), m_registry, &executor());
 	}
 
   private:
@@ -22,9 +22,12 @@ target_sources(${PROJECT_NAME} PRIVATE
   include/levk/core/ubyte.hpp
   include/levk/core/version.hpp
 
+  include/levk/core/io/async_reader.hpp
   include/levk/core/io/converters.hpp
   include/levk/core/io/file_monitor.hpp
+  include/levk/core/io/file_watcher.hpp
   include/levk/core/io/fs_media.hpp
+  include/levk/core/io/mapped_bytes.hpp
   include/levk/core/io/media.hpp
   include/levk/core/io/path.hpp
   include/levk/core/io/zip_media.hpp
@@ -0,0 +1,49 @@
+#pragma once
+#include <ktl/async/async_queue.hpp>
+#include <ktl/async/kfunction.hpp>
+#include <ktl/async/kfuture.hpp>
+#include <ktl/async/kthread.hpp>
+#include <levk/core/io/media.hpp>
+#include <vector>
+
+namespace le::io {
+///
+/// \brief Dedicated I/O threads for asynchronous reads from Media
+///
+/// Reads block I/O threads (instead of task executor threads) until data is resident.
+/// Batches are prefetched via Media::prefetch first, so the OS can keep many reads in flight.
+///
+class AsyncReader : public Pinned {
+  public:
+	using Result = std::optional<MappedBytes>;
+	using Promise = ktl::kpromise<Result>;
+	using Future = ktl::kfuture<Result>;
+
+	struct CreateInfo;
+
+	AsyncReader();
+	AsyncReader(CreateInfo const& info);
+	~AsyncReader();
+
+	///
+	/// \brief Read uri from media asynchronously (media must outlive the returned future)
+	///
+	[[nodiscard]] Future read(Media const& media, Path uri);
+	///
+	/// \brief Read a batch of uris from media asynchronously (media must outlive the returned futures)
+	///
+	[[nodiscard]] std::vector<Future> read(Media const& media, Span<Path const> uris);
+
+	std::size_t threadCount() const noexcept { return m_threads.size(); }
+
+  private:
+	void stop();
+
+	ktl::async_queue<ktl::kfunction<void()>> m_queue;
+	std::vector<ktl::kthread> m_threads;
+};
+
+struct AsyncReader::CreateInfo {
+	u32 threads = 4;
+};
+} // namespace le::io
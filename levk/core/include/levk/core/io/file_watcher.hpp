@@ -0,0 +1,56 @@
+#pragma once
+#include <levk/core/io/path.hpp>
+#include <levk/core/std_types.hpp>
+#include <levk/core/time.hpp>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace le::io {
+///
+/// \brief Event driven watcher for a set of filesystem files
+///
+/// Uses inotify (directory-level watches) on Linux, else polls timestamps (at most once per debounce window).
+/// Events for a file are coalesced until none arrive for the debounce window, so burst writes and
+/// editor-style save-by-rename report a single change.
+/// Files in a removed directory are polled until it is recreated and the inotify watch can be re-added.
+///
+class FileWatcher : public Pinned {
+  public:
+	struct CreateInfo;
+
+	FileWatcher();
+	FileWatcher(CreateInfo const& info);
+	~FileWatcher();
+
+	///
+	/// \brief Start watching path (its parent directory must exist)
+	/// \returns Normalised absolute path that changed() will report, or nullopt on failure
+	///
+	std::optional<Path> watch(Path const& path);
+	bool unwatch(Path const& path);
+	void clear();
+
+	///
+	/// \brief Obtain (normalised) paths whose changes have settled since the last call (non-blocking)
+	///
+	std::vector<Path> changed();
+
+	///
+	/// \brief Check if backed by OS notifications (as opposed to polling)
+	///
+	bool native() const noexcept;
+	std::size_t size() const noexcept;
+
+	static Path normalise(Path const& path);
+
+  private:
+	struct Impl;
+	std::unique_ptr<Impl> m_impl;
+};
+
+struct FileWatcher::CreateInfo {
+	Time_ms debounce = 50ms;
+	bool forcePolling = false;
+};
+} // namespace le::io
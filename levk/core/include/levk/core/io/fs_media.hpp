@@ -1,14 +1,30 @@
 #pragma once
 #include <levk/core/io/media.hpp>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 namespace le::io {
 ///
 /// \brief Concrete class for filesystem IO
 ///
+/// Resolved uris are cached: mounts are scanned once (lazily, after any (re)mount / invalidate()),
+/// after which lookups are hash probes. Uris not found in the cache fall back to querying each mount.
+///
 class FSMedia final : public Media {
   public:
 	static constexpr Info info_v = {"Filesystem", Flags(Flag::eRead) | Flag::eWrite};
 
+	///
+	/// \brief Path resolution cache statistics
+	///
+	struct Stats {
+		u64 hits{};
+		u64 misses{};
+		u64 probes{}; // filesystem queries (is_regular_file) on cache misses
+		u64 scans{};  // full mount scans
+	};
+
 	///
 	/// \brief Obtain full path to directory containing any of anyOf sub-paths.
 	/// \param leaf directory to start searching upwards from
@@ -24,19 +40,66 @@ class FSMedia final : public Media {
 	///
 	Path fullPath(Path const& uri) const;
 	///
-	/// \brief Mount filesystem directory
+	/// \brief Mount filesystem directory (remounting an existing directory rescans it)
 	///
 	bool mount(Path path) override;
 	bool unmount(Path const& path) noexcept override;
 	void clear() noexcept override;
 	std::optional<bytearray> bytes(Path const& uri) const override;
+	///
+	/// \brief Memory map file (no copies)
+	///
+	std::optional<MappedBytes> mapped(Path const& uri) const override;
+	///
+	/// \brief Start reading files into the OS page cache
+	///
+	void prefetch(Span<Path const> uris) const override;
 	std::optional<std::stringstream> sstream(Path const& uri) const override;
 	bool write(Path const& path, std::string_view text, bool newline = true) const override;
 	bool write(Path const& path, Span<std::byte const> bytes) const override;
 
+	///
+	/// \brief Drop cached resolution of path (a uri, or a full path under any mount)
+	///
+	void invalidate(Path const& path) const;
+	///
+	/// \brief Drop all cached resolutions (mounts will be rescanned on the next lookup)
+	///
+	void invalidate() const;
+	Stats stats() const noexcept;
+
   private:
+	struct Scan {
+		std::unordered_map<std::string, Path> paths;
+		std::vector<std::string> roots;
+	};
+
+	// mutex only guards the maps: filesystem scans / probes run outside it
+	struct Cache {
+		std::unordered_map<std::string, Path> paths;
+		std::vector<std::string> roots;
+		std::mutex mutex;
+		// serialises rescans (lookups that hit the cache don't wait on them)
+		std::mutex scanMutex;
+		std::atomic<u64> hits{};
+		std::atomic<u64> misses{};
+		std::atomic<u64> probes{};
+		std::atomic<u64> scans{};
+		// bumped whenever mounts change: results gathered against older mounts are discarded
+		u64 generation{};
+		bool stale = true;
+	};
+
 	std::optional<Path> findPrefixed(Path const& uri) const override;
+	///
+	/// \brief Resolve uri and open it; a cached path that fails to open (deleted file) is dropped and resolved again
+	///
+	template <typename F>
+	auto open(Path const& uri, F func) const -> decltype(func(uri));
+	void rescan() const;
+	static Scan scan(Span<Path const> dirs);
 
 	std::vector<Path> m_dirs;
+	mutable Cache m_cache;
 };
 } // namespace le::io
@@ -0,0 +1,54 @@
+#pragma once
+#include <levk/core/io/path.hpp>
+#include <levk/core/span.hpp>
+#include <levk/core/std_types.hpp>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace le::io {
+///
+/// \brief Read-only, ref-counted view of a file's contents
+///
+/// Backed by a memory mapping where supported (POSIX), else by an owned buffer.
+/// Copies share the same storage; the view remains valid as long as any copy is alive.
+///
+class MappedBytes {
+  public:
+	MappedBytes() = default;
+
+	///
+	/// \brief Map the file at path (falls back to reading it into memory if mapping is unavailable)
+	///
+	static std::optional<MappedBytes> map(Path const& path);
+	///
+	/// \brief Take ownership of bytes
+	///
+	static MappedBytes own(bytearray bytes);
+	///
+	/// \brief Hint the OS to start reading path into the page cache (non-blocking, no-op if unsupported)
+	///
+	static bool prefetch(Path const& path);
+
+	std::byte const* data() const noexcept { return m_bytes.data(); }
+	std::size_t size() const noexcept { return m_bytes.size(); }
+	bool empty() const noexcept { return m_bytes.empty(); }
+	///
+	/// \brief Check if the storage is a memory mapping (as opposed to an owned buffer)
+	///
+	bool mapped() const noexcept;
+	///
+	/// \brief Fault in all pages of a mapping (blocks until resident)
+	///
+	void populate() const noexcept;
+
+	Span<std::byte const> span() const noexcept { return m_bytes; }
+	std::string_view view() const noexcept { return {reinterpret_cast<char const*>(m_bytes.data()), m_bytes.size()}; }
+
+  private:
+	struct Storage;
+
+	std::shared_ptr<Storage const> m_storage;
+	Span<std::byte const> m_bytes;
+};
+} // namespace le::io
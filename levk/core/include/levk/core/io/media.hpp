@@ -1,5 +1,6 @@
 #pragma once
 #include <ktl/enum_flags/enum_flags.hpp>
+#include <levk/core/io/mapped_bytes.hpp>
 #include <levk/core/io/path.hpp>
 #include <levk/core/log.hpp>
 #include <levk/core/span.hpp>
@@ -69,6 +70,16 @@ class Media : public utils::VBase {
 	///
 	[[nodiscard]] virtual std::optional<bytearray> bytes([[maybe_unused]] Path const& uri) const { return std::nullopt; }
 	///
+	/// \brief Obtain a read-only, ref-counted view of data
+	///
+	/// Default implementation wraps bytes(); media that support it should avoid the copy (eg via memory mapping)
+	///
+	[[nodiscard]] virtual std::optional<MappedBytes> mapped(Path const& uri) const;
+	///
+	/// \brief Hint that uris will be read soon (eg start asynchronous disk reads); no-op by default
+	///
+	virtual void prefetch([[maybe_unused]] Span<Path const> uris) const {}
+	///
 	/// \brief Obtain data as `std::stringstream`
 	///
 	[[nodiscard]] virtual std::optional<std::stringstream> sstream([[maybe_unused]] Path const& uri) const { return std::nullopt; }
@@ -9,6 +9,13 @@ class ZIPMedia final : public Media, public NoCopy {
   public:
 	static constexpr Info info_v = {"ZIP", Flag::eRead};
 
+	///
+	/// \brief Sequential / random-access reader for a single archive entry
+	///
+	/// Decompresses on demand: resident memory is bounded by the buffers passed to read()
+	///
+	class Stream;
+
 	Info const& info() const noexcept override { return info_v; }
 
 	///
@@ -36,31 +43,84 @@ class ZIPMedia final : public Media, public NoCopy {
 	///
 	/// \brief Mount .zip file at path
 	///
+	/// The archive is read through a file handle on demand (not loaded into memory)
+	///
 	bool mount(Path path) override;
 	///
 	/// \brief Mount .zip contents through memory
 	///
+	/// bytes must outlive the mount
+	///
 	bool mount(Path point, Span<std::byte const> bytes);
+	///
+	/// \brief Unmount an archive (fails while any of its files are open, eg via stream())
+	///
 	bool unmount(Path const& path) noexcept override;
 	void clear() noexcept override;
 	std::optional<bytearray> bytes(Path const& uri) const override;
 	std::optional<std::stringstream> sstream(Path const& uri) const override;
+	///
+	/// \brief Open uri for streaming reads
+	///
+	std::optional<Stream> stream(Path const& uri) const;
 
   private:
 	struct Zip {
 		Path path;
 
-		Zip(Path path) noexcept : path(std::move(path)) {}
+		// unmounts path on destruction: never construct temporaries (eg for comparisons)
+		explicit Zip(Path path) noexcept : path(std::move(path)) {}
 		Zip(Zip&& rhs) noexcept { exchg(*this, rhs); }
 		Zip& operator=(Zip rhs) noexcept { return (exchg(*this, rhs), *this); }
 		~Zip();
 		static void exchg(Zip& lhs, Zip& rhs) noexcept;
-
-		bool operator==(Zip const&) const = default;
 	};
 
 	std::optional<Path> findPrefixed(Path const& uri) const override;
 
 	std::vector<Zip> m_zips;
 };
+
+class ZIPMedia::Stream {
+  public:
+	Stream(Stream&& rhs) noexcept : m_file(std::exchange(rhs.m_file, nullptr)), m_size(rhs.m_size) {}
+	Stream& operator=(Stream&& rhs) noexcept;
+	~Stream();
+
+	///
+	/// \brief Read up to out.size() bytes into out
+	/// \returns Number of bytes read (0 on end / error)
+	///
+	std::size_t read(Span<std::byte> out);
+	///
+	/// \brief Invoke onChunk for each chunk of (at most) buffer.size() bytes until end of entry
+	/// \returns Total bytes read
+	///
+	template <typename F>
+	std::size_t read(Span<std::byte> buffer, F&& onChunk);
+	bool seek(u64 offset);
+	u64 tell() const;
+	u64 size() const noexcept { return m_size; }
+	bool eof() const;
+
+  private:
+	Stream(void* file, u64 size) noexcept : m_file(file), m_size(size) {}
+
+	void* m_file{};
+	u64 m_size{};
+
+	friend class ZIPMedia;
+};
+
+// impl
+
+template <typename F>
+std::size_t ZIPMedia::Stream::read(Span<std::byte> buffer, F&& onChunk) {
+	std::size_t ret{};
+	while (auto const count = read(buffer)) {
+		onChunk(Span<std::byte const>(buffer.data(), count));
+		ret += count;
+	}
+	return ret;
+}
 } // namespace le::io
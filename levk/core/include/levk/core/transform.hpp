@@ -36,17 +36,25 @@ class Transform : utils::DirtyFlag {
 	bool isotropic() const noexcept { return m_matrix.isotropic(); }
 
 	glm::mat4 matrix() const noexcept { return (refresh(), m_mat); }
+	///
+	/// \brief Monotonic counter bumped on every modification (never reset by refresh())
+	///
+	u32 revision() const noexcept { return m_revision; }
 
 	bool stale() const noexcept { return dirty(); }
 	void refresh() const noexcept {
-		if (stale()) { m_mat = m_matrix.mat4(); }
+		if (stale()) {
+			m_mat = m_matrix.mat4();
+			setDirty(0);
+		}
 	}
 
   private:
-	Transform& makeDirty() noexcept { return (setDirty(), *this); }
+	Transform& makeDirty() noexcept { return (setDirty(), ++m_revision, *this); }
 
 	mutable glm::mat4 m_mat = glm::mat4(1.0f);
 	Matrix m_matrix;
+	u32 m_revision{};
 };
 
 // impl
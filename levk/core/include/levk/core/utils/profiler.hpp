@@ -1,9 +1,14 @@
 #pragma once
-#include <ktl/fixed_vector.hpp>
 #include <levk/core/log.hpp>
-#include <levk/core/not_null.hpp>
+#include <levk/core/std_types.hpp>
 #include <levk/core/time.hpp>
+#include <atomic>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace le::utils {
 struct ProfileEntry {
@@ -20,16 +25,6 @@ struct ProfileLogger {
 	void operator()(ProfileEntry const& entry) const { dlog::log(logLevel, "{:1.3f}ms [{}]", entry.dt.count() * 1000.0f, entry.name); }
 };
 
-template <std::size_t MaxEntries>
-struct ProfileCacher {
-	static constexpr std::size_t max_entries = MaxEntries;
-	using Entries = ktl::fixed_vector<ProfileEntry, MaxEntries>;
-
-	Entries* entries{};
-
-	void operator()(ProfileEntry const& entry) const;
-};
-
 template <typename D>
 class DProfiler {
   public:
@@ -58,53 +53,139 @@ class DProfiler<ProfileDevNull> {
 };
 using NullProfiler = DProfiler<ProfileDevNull>;
 
-template <std::size_t MaxEntries = 16, std::size_t RecordSize = 64>
-class ProfileDB {
+///
+/// \brief Thread-aware, hierarchical CPU profiler
+///
+/// Each recording thread writes zones into its own fixed-size ring buffer (single writer, lock-free);
+/// once full, the oldest zones are overwritten. Zones nest per thread, and captures can be exported
+/// in the Chrome trace event format (chrome://tracing, ui.perfetto.dev).
+/// When disabled, profile() costs one relaxed atomic load.
+///
+class ThreadProfiler : public Pinned {
   public:
-	static constexpr std::size_t max_entries = MaxEntries;
-	static constexpr std::size_t record_size = RecordSize;
-
-	using Cacher = ProfileCacher<MaxEntries>;
-	using Profiler = DProfiler<Cacher>;
-	using Entries = typename Cacher::Entries;
-
-	struct Record {
-		Entries entries;
+	struct CreateInfo;
+	struct Zone {
+		std::string_view name;
+		time::Point start{};
+		time::Point end{};
+		u32 depth{};
+
+		Time_s dt() const noexcept { return end - start; }
+	};
+	struct Thread {
+		std::string name;
+		std::vector<Zone> zones;
+		u64 dropped{};
+	};
+	///
+	/// \brief Zones recorded on the thread calling next() during the previous frame, aggregated by name and depth
+	///
+	struct Frame {
+		struct Entry {
+			std::string_view name;
+			Time_s dt{};
+			u32 depth{};
+		};
+		std::vector<Entry> entries;
 		Time_s total{};
 	};
+	class Scope;
+	using Profiler = Scope;
+
+	ThreadProfiler();
+	ThreadProfiler(CreateInfo const& info);
+	~ThreadProfiler();
+
+	///
+	/// \brief Name the calling thread (applies to profilers it first records into after this call)
+	///
+	static void nameThread(std::string name);
+
+	///
+	/// \brief Open a zone on the calling thread, closed when the returned Scope is destroyed (on the same thread)
+	/// \param name Must outlive the profiler (eg a string literal)
+	///
+	[[nodiscard]] Scope profile(std::string_view name) noexcept;
+	void enable(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+	bool enabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+	///
+	/// \brief Mark the end of a frame on the calling thread
+	///
+	void next(Time_s total);
+	Frame lastFrame() const;
+
+	///
+	/// \brief Snapshot zones of all threads (safe to call while other threads are recording)
+	///
+	std::vector<Thread> capture() const;
+	///
+	/// \brief Write capture() in the Chrome trace event (JSON) format
+	///
+	void chromeTrace(std::ostream& out) const;
+	std::string chromeTrace() const;
 
-	Profiler profile(std::string_view name) noexcept { return Profiler(name, Cacher{&m_active}); }
-	void next(Time_s totalTime) {
-		if (m_record.has_space()) { m_record.push_back({m_active, totalTime}); }
-		m_active.clear();
-	}
+  private:
+	struct Ring;
+
+	Ring* ring();
+
+	std::vector<std::unique_ptr<Ring>> m_rings;
+	Frame m_frame;
+	std::string m_unnamed;
+	time::Point m_epoch;
+	std::size_t m_capacity;
+	u64 m_id;
+	std::atomic<bool> m_enabled;
+	mutable std::mutex m_mutex;
+};
 
-	ktl::fixed_vector<Record, RecordSize> m_record;
+struct ThreadProfiler::CreateInfo {
+	///
+	/// \brief Zones retained per thread
+	///
+	std::size_t ringSize = 4096;
+	///
+	/// \brief Name prefix for threads that did not call nameThread()
+	///
+	std::string unnamed = "thread";
+	bool enabled = levk_debug;
+};
+
+class ThreadProfiler::Scope {
+  public:
+	Scope() = default;
+	Scope(Scope&& rhs) noexcept { exchg(*this, rhs); }
+	Scope& operator=(Scope rhs) noexcept { return (exchg(*this, rhs), *this); }
+	~Scope() {
+		if (m_ring) { close(); }
+	}
 
   private:
-	Entries m_active;
-};
+	Scope(Ring* ring, std::string_view name) noexcept;
+	void close() noexcept;
+	static void exchg(Scope& lhs, Scope& rhs) noexcept;
 
-struct NullProfileDB {
-	using Profiler = DProfiler<ProfileDevNull>;
+	Ring* m_ring{};
+	std::string_view m_name;
+	time::Point m_start{};
+	u32 m_depth{};
 
-	Profiler profile(std::string_view name) noexcept { return Profiler(name); }
-	// void next(Time_s) noexcept {}
+	friend class ThreadProfiler;
 };
 
 // impl
 
-template <std::size_t MaxEntries>
-void ProfileCacher<MaxEntries>::operator()(ProfileEntry const& entry) const {
-	if (entries) {
-		auto it = std::find_if(entries->begin(), entries->end(), [n = entry.name](ProfileEntry const& entry) { return entry.name == n; });
-		if (it != entries->end()) {
-			it->dt += entry.dt;
-			it->stamp = entry.stamp;
-		} else if (entries->has_space()) {
-			entries->push_back(entry);
-		}
-	}
+inline ThreadProfiler::Scope ThreadProfiler::profile(std::string_view name) noexcept {
+	if (!enabled()) { return {}; }
+	return Scope(ring(), name);
+}
+
+inline void ThreadProfiler::Scope::exchg(Scope& lhs, Scope& rhs) noexcept {
+	std::swap(lhs.m_ring, rhs.m_ring);
+	std::swap(lhs.m_name, rhs.m_name);
+	std::swap(lhs.m_start, rhs.m_start);
+	std::swap(lhs.m_depth, rhs.m_depth);
 }
 
 template <typename D>
@@ -0,0 +1,54 @@
+#include <levk/core/io/async_reader.hpp>
+#include <levk/core/log.hpp>
+#include <levk/core/utils/profiler.hpp>
+#include <levk/core/utils/string.hpp>
+#include <algorithm>
+
+namespace le::io {
+namespace {
+AsyncReader::Result load(Media const& media, Path const& uri) {
+	auto ret = media.mapped(uri);
+	// fault in mapped pages here, not on the consumer's thread
+	if (ret) { ret->populate(); }
+	return ret;
+}
+} // namespace
+
+AsyncReader::AsyncReader() : AsyncReader(CreateInfo{}) {}
+
+AsyncReader::AsyncReader(CreateInfo const& info) {
+	auto const count = std::max(info.threads, 1U);
+	for (u32 i = 0; i < count; ++i) {
+		m_threads.push_back(ktl::kthread([this, i]() {
+			utils::ThreadProfiler::nameThread("io::reader " + std::to_string(i));
+			while (auto f = m_queue.pop()) { (*f)(); }
+		}));
+	}
+	logD("[{}] [{}] I/O threads started", utils::tName<AsyncReader>(), count);
+}
+
+AsyncReader::~AsyncReader() { stop(); }
+
+AsyncReader::Future AsyncReader::read(Media const& media, Path uri) {
+	Promise promise;
+	auto ret = promise.get_future();
+	m_queue.push([p = std::move(promise), &media, uri = std::move(uri)]() mutable { p.set_value(load(media, uri)); });
+	return ret;
+}
+
+std::vector<AsyncReader::Future> AsyncReader::read(Media const& media, Span<Path const> uris) {
+	std::vector<Future> ret;
+	ret.reserve(uris.size());
+	if (uris.empty()) { return ret; }
+	// non-blocking hints: queue up OS reads for the whole batch before any thread blocks on one
+	media.prefetch(uris);
+	for (auto const& uri : uris) { ret.push_back(read(media, uri)); }
+	return ret;
+}
+
+void AsyncReader::stop() {
+	m_queue.clear(false);
+	for (auto& thread : m_threads) { thread.join(); }
+	m_threads.clear();
+}
+} // namespace le::io
@@ -0,0 +1,255 @@
+#include <levk/core/io/file_watcher.hpp>
+#include <levk/core/log.hpp>
+#include <levk/core/os.hpp>
+#include <levk/core/utils/string.hpp>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(LEVK_OS_LINUX)
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#define LEVK_INOTIFY
+#endif
+
+namespace le::io {
+namespace stdfs = std::filesystem;
+
+namespace {
+stdfs::file_time_type lwt(stdfs::path const& path) {
+	std::error_code err;
+	auto const ret = stdfs::last_write_time(path, err);
+	return err ? stdfs::file_time_type() : ret;
+}
+
+// approximate time of last change: events carry no timestamp, so derive it from the file's age
+time::Point stamp(stdfs::file_time_type const lastWrite, time::Point const now) {
+	if (lastWrite == stdfs::file_time_type()) { return now; }
+	auto const age = stdfs::file_time_type::clock::now() - lastWrite;
+	if (age <= decltype(age)::zero()) { return now; }
+	return now - stdch::duration_cast<time::Clock::duration>(age);
+}
+} // namespace
+
+struct FileWatcher::Impl {
+	struct File {
+		std::string dir;
+		std::string name;
+		stdfs::file_time_type lastWrite;
+	};
+
+	std::unordered_map<std::string, File> files;
+	std::unordered_map<std::string, time::Point> pending;
+	Time_ms debounce{};
+	time::Point lastPoll{};
+
+	void touch(std::string const& key, stdfs::file_time_type const lastWrite, time::Point const now) {
+		auto& point = pending[key];
+		point = std::max(point, stamp(lastWrite, now));
+	}
+
+#if defined(LEVK_INOTIFY)
+	static constexpr u32 mask_v = IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+	struct Dir {
+		int wd = -1;
+		std::unordered_map<std::string, std::string> names; // filename => key
+	};
+
+	std::unordered_map<std::string, Dir> dirs;
+	std::unordered_map<int, std::string> wds;
+	int fd = -1;
+
+	~Impl() {
+		if (fd >= 0) { ::close(fd); }
+	}
+
+	bool addWatch(std::string const& key, File const& file) {
+		auto& dir = dirs[file.dir];
+		if (dir.wd < 0) {
+			dir.wd = ::inotify_add_watch(fd, file.dir.data(), mask_v);
+			if (dir.wd < 0) {
+				dirs.erase(file.dir);
+				return false;
+			}
+			wds[dir.wd] = file.dir;
+		}
+		dir.names[file.name] = key;
+		return true;
+	}
+
+	void removeWatch(File const& file) {
+		auto it = dirs.find(file.dir);
+		if (it == dirs.end()) { return; }
+		it->second.names.erase(file.name);
+		if (it->second.names.empty()) {
+			if (it->second.wd >= 0) {
+				::inotify_rm_watch(fd, it->second.wd);
+				wds.erase(it->second.wd);
+			}
+			dirs.erase(it);
+		}
+	}
+
+	void drain(time::Point const now) {
+		alignas(inotify_event) char buf[4096];
+		std::unordered_set<std::string> touched;
+		for (;;) {
+			auto const len = ::read(fd, buf, sizeof(buf));
+			if (len <= 0) { break; }
+			for (char const* ptr = buf; ptr < buf + len;) {
+				auto const& event = *reinterpret_cast<inotify_event const*>(ptr);
+				ptr += sizeof(inotify_event) + event.len;
+				if (event.mask & IN_Q_OVERFLOW) {
+					for (auto const& [key, _] : files) { touched.insert(key); }
+					continue;
+				}
+				auto const wd = wds.find(event.wd);
+				if (wd == wds.end()) { continue; }
+				auto const dir = dirs.find(wd->second);
+				if (event.mask & IN_IGNORED) {
+					// directory removed: report all its files
+					if (dir != dirs.end()) {
+						for (auto const& [_, key] : dir->second.names) { touched.insert(key); }
+						dir->second.wd = -1;
+					}
+					wds.erase(wd);
+					continue;
+				}
+				if (event.len == 0 || dir == dirs.end()) { continue; }
+				if (auto const name = dir->second.names.find(event.name); name != dir->second.names.end()) { touched.insert(name->second); }
+			}
+		}
+		// stat only files that had events
+		for (auto const& key : touched) {
+			auto const lastWrite = lwt(key);
+			if (auto it = files.find(key); it != files.end()) { it->second.lastWrite = lastWrite; }
+			touch(key, lastWrite, now);
+		}
+		rewatch(now);
+	}
+
+	// directories whose watch was dropped (removed / moved): retry adding it, polling their files until that succeeds
+	void rewatch(time::Point const now) {
+		if (now - lastPoll < debounce) { return; }
+		bool polled = false;
+		for (auto& [path, dir] : dirs) {
+			if (dir.wd >= 0) { continue; }
+			polled = true;
+			dir.wd = ::inotify_add_watch(fd, path.data(), mask_v);
+			if (dir.wd >= 0) { wds[dir.wd] = path; }
+			// also catches files recreated before the watch was re-added
+			for (auto const& [_, key] : dir.names) {
+				auto& file = files[key];
+				auto const lastWrite = lwt(key);
+				if (lastWrite != file.lastWrite) {
+					file.lastWrite = lastWrite;
+					touch(key, lastWrite, now);
+				}
+			}
+		}
+		if (polled) { lastPoll = now; }
+	}
+#endif
+
+	void poll(time::Point const now) {
+		if (now - lastPoll < debounce) { return; }
+		lastPoll = now;
+		for (auto& [key, file] : files) {
+			auto const lastWrite = lwt(stdfs::path(file.dir) / file.name);
+			if (lastWrite != file.lastWrite) {
+				file.lastWrite = lastWrite;
+				touch(key, lastWrite, now);
+			}
+		}
+	}
+};
+
+FileWatcher::FileWatcher(CreateInfo const& info) : m_impl(std::make_unique<Impl>()) {
+	m_impl->debounce = info.debounce;
+#if defined(LEVK_INOTIFY)
+	if (!info.forcePolling) {
+		m_impl->fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_impl->fd < 0) { logW("[{}] inotify unavailable (errno: {}), falling back to polling", utils::tName<FileWatcher>(), errno); }
+	}
+#endif
+}
+
+FileWatcher::FileWatcher() : FileWatcher(CreateInfo{}) {}
+
+FileWatcher::~FileWatcher() = default;
+
+Path FileWatcher::normalise(Path const& path) { return Path(stdfs::absolute(path.string()).lexically_normal().generic_string()); }
+
+std::optional<Path> FileWatcher::watch(Path const& path) {
+	auto const full = stdfs::absolute(path.string()).lexically_normal();
+	if (!full.has_filename() || !stdfs::is_directory(full.parent_path())) { return std::nullopt; }
+	auto key = full.generic_string();
+	if (m_impl->files.contains(key)) { return Path(key); }
+	Impl::File file{full.parent_path().string(), full.filename().string(), lwt(full)};
+#if defined(LEVK_INOTIFY)
+	if (native() && !m_impl->addWatch(key, file)) {
+		logW("[{}] Failed to watch [{}] (errno: {})", utils::tName<FileWatcher>(), key, errno);
+		return std::nullopt;
+	}
+#endif
+	m_impl->files.emplace(key, std::move(file));
+	return Path(std::move(key));
+}
+
+bool FileWatcher::unwatch(Path const& path) {
+	auto const key = normalise(path).generic_string();
+	auto it = m_impl->files.find(key);
+	if (it == m_impl->files.end()) { return false; }
+#if defined(LEVK_INOTIFY)
+	if (native()) { m_impl->removeWatch(it->second); }
+#endif
+	m_impl->pending.erase(key);
+	m_impl->files.erase(it);
+	return true;
+}
+
+void FileWatcher::clear() {
+#if defined(LEVK_INOTIFY)
+	for (auto const& [wd, _] : m_impl->wds) { ::inotify_rm_watch(m_impl->fd, wd); }
+	m_impl->wds.clear();
+	m_impl->dirs.clear();
+#endif
+	m_impl->files.clear();
+	m_impl->pending.clear();
+}
+
+std::vector<Path> FileWatcher::changed() {
+	auto const now = time::now();
+#if defined(LEVK_INOTIFY)
+	if (native()) {
+		m_impl->drain(now);
+	} else {
+		m_impl->poll(now);
+	}
+#else
+	m_impl->poll(now);
+#endif
+	std::vector<Path> ret;
+	for (auto it = m_impl->pending.begin(); it != m_impl->pending.end();) {
+		if (now - it->second >= m_impl->debounce) {
+			ret.push_back(it->first);
+			it = m_impl->pending.erase(it);
+		} else {
+			++it;
+		}
+	}
+	return ret;
+}
+
+bool FileWatcher::native() const noexcept {
+#if defined(LEVK_INOTIFY)
+	return m_impl->fd >= 0;
+#else
+	return false;
+#endif
+}
+
+std::size_t FileWatcher::size() const noexcept { return m_impl->files.size(); }
+} // namespace le::io
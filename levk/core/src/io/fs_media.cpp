@@ -1,9 +1,17 @@
 #include <levk/core/io/fs_media.hpp>
 #include <levk/core/log.hpp>
 #include <levk/core/utils/string.hpp>
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
 
 namespace le::io {
+namespace stdfs = std::filesystem;
+
+namespace {
+std::string rootString(Path const& dir) { return stdfs::absolute(dir.string()).lexically_normal().generic_string(); }
+} // namespace
+
 std::optional<Path> FSMedia::findUpwards(Path const& leaf, Span<Path const> anyOf, u8 maxHeight) {
 	for (auto const& name : anyOf) {
 		if (io::is_directory(leaf / name) || io::is_regular_file(leaf / name)) {
@@ -23,6 +31,9 @@ Path FSMedia::fullPath(Path const& uri) const {
 
 bool FSMedia::mount(Path path) {
 	auto pathStr = absolute(path).generic_string();
+	std::scoped_lock lock(m_cache.mutex);
+	m_cache.stale = true;
+	++m_cache.generation;
 	if (std::find(m_dirs.begin(), m_dirs.end(), path) == m_dirs.end()) {
 		if (!io::is_directory(path)) {
 			logE("[{}] directory not found on {} [{}]!", utils::tName<FSMedia>(), info_v.name, pathStr);
@@ -37,37 +48,67 @@ bool FSMedia::mount(Path path) {
 }
 
 bool FSMedia::unmount(Path const& path) noexcept {
+	std::scoped_lock lock(m_cache.mutex);
 	if (std::erase_if(m_dirs, [&path](Path const& p) { return p == path; }) > 0) {
+		m_cache.stale = true;
+		++m_cache.generation;
 		logD("[{}] directory umounted [{}]", utils::tName<FSMedia>(), path.generic_string());
 		return true;
 	}
 	return false;
 }
 
-void FSMedia::clear() noexcept { m_dirs.clear(); }
+void FSMedia::clear() noexcept {
+	std::scoped_lock lock(m_cache.mutex);
+	m_dirs.clear();
+	m_cache.stale = true;
+	++m_cache.generation;
+}
+
+template <typename F>
+auto FSMedia::open(Path const& uri, F func) const -> decltype(func(uri)) {
+	auto path = findPrefixed(uri);
+	if (!path) { return std::nullopt; }
+	if (auto ret = func(*path)) { return ret; }
+	if (uri.has_root_directory()) { return std::nullopt; }
+	// cached path may have been deleted: fall through to later mounts
+	invalidate(uri);
+	if (auto retry = findPrefixed(uri); retry && *retry != *path) { return func(*retry); }
+	return std::nullopt;
+}
 
 std::optional<bytearray> FSMedia::bytes(Path const& uri) const {
-	if (auto path = findPrefixed(uri)) {
-		if (auto file = std::ifstream(path->string(), std::ios::binary | std::ios::ate)) {
+	return open(uri, [](Path const& path) -> std::optional<bytearray> {
+		if (auto file = std::ifstream(path.string(), std::ios::binary | std::ios::ate)) {
 			auto pos = file.tellg();
 			auto buf = bytearray((std::size_t)pos);
 			file.seekg(0, std::ios::beg);
 			file.read((char*)buf.data(), (std::streamsize)pos);
 			return buf;
 		}
+		return std::nullopt;
+	});
+}
+
+std::optional<MappedBytes> FSMedia::mapped(Path const& uri) const {
+	return open(uri, [](Path const& path) { return MappedBytes::map(path); });
+}
+
+void FSMedia::prefetch(Span<Path const> uris) const {
+	for (auto const& uri : uris) {
+		if (auto path = findPrefixed(uri)) { MappedBytes::prefetch(*path); }
 	}
-	return std::nullopt;
 }
 
 std::optional<std::stringstream> FSMedia::sstream(Path const& uri) const {
-	if (auto path = findPrefixed(uri)) {
-		if (auto file = std::ifstream(path->generic_string())) {
+	return open(uri, [](Path const& path) -> std::optional<std::stringstream> {
+		if (auto file = std::ifstream(path.generic_string())) {
 			std::stringstream buf;
 			buf << file.rdbuf();
 			return buf;
 		}
-	}
-	return std::nullopt;
+		return std::nullopt;
+	});
 }
 
 bool FSMedia::write(Path const& path, std::string_view str, bool newline) const {
@@ -87,12 +128,97 @@ bool FSMedia::write(Path const& path, Span<std::byte const> bytes) const {
 	return false;
 }
 
+void FSMedia::invalidate(Path const& path) const {
+	auto const str = path.generic_string();
+	std::scoped_lock lock(m_cache.mutex);
+	m_cache.paths.erase(str);
+	for (auto const& root : m_cache.roots) {
+		if (str.size() > root.size() && str.starts_with(root) && str[root.size()] == '/') { m_cache.paths.erase(str.substr(root.size() + 1)); }
+	}
+}
+
+void FSMedia::invalidate() const {
+	std::scoped_lock lock(m_cache.mutex);
+	m_cache.stale = true;
+	++m_cache.generation;
+}
+
+FSMedia::Stats FSMedia::stats() const noexcept { return {m_cache.hits.load(), m_cache.misses.load(), m_cache.probes.load(), m_cache.scans.load()}; }
+
 std::optional<Path> FSMedia::findPrefixed(Path const& uri) const {
-	if (uri.has_root_directory() || m_dirs.empty()) { return uri; }
-	for (auto const& prefix : m_dirs) {
+	if (uri.has_root_directory()) { return uri; }
+	auto key = uri.generic_string();
+	std::vector<Path> dirs;
+	u64 generation{};
+	{
+		std::unique_lock lock(m_cache.mutex);
+		if (m_dirs.empty()) { return uri; }
+		if (m_cache.stale) {
+			lock.unlock();
+			rescan();
+			lock.lock();
+			if (m_dirs.empty()) { return uri; }
+		}
+		// still stale if mounts changed during the rescan: probe instead
+		if (!m_cache.stale) {
+			if (auto it = m_cache.paths.find(key); it != m_cache.paths.end()) {
+				++m_cache.hits;
+				return it->second;
+			}
+		}
+		++m_cache.misses;
+		dirs = m_dirs;
+		generation = m_cache.generation;
+	}
+	// not negatively cached: the file may yet be created (eg compiled SPIR-V)
+	for (auto const& prefix : dirs) {
 		auto path = prefix / uri;
-		if (io::is_regular_file(io::absolute(path))) { return path; }
+		++m_cache.probes;
+		if (io::is_regular_file(io::absolute(path))) {
+			std::scoped_lock lock(m_cache.mutex);
+			if (!m_cache.stale && m_cache.generation == generation) { m_cache.paths.emplace(std::move(key), path); }
+			return path;
+		}
 	}
 	return std::nullopt;
 }
+
+void FSMedia::rescan() const {
+	std::scoped_lock scanLock(m_cache.scanMutex);
+	std::vector<Path> dirs;
+	u64 generation{};
+	{
+		std::scoped_lock lock(m_cache.mutex);
+		// another thread finished a rescan while this one waited
+		if (!m_cache.stale) { return; }
+		dirs = m_dirs;
+		generation = m_cache.generation;
+	}
+	auto result = scan(dirs);
+	++m_cache.scans;
+	std::scoped_lock lock(m_cache.mutex);
+	if (m_cache.generation != generation) { return; }
+	m_cache.paths = std::move(result.paths);
+	m_cache.roots = std::move(result.roots);
+	m_cache.stale = false;
+}
+
+FSMedia::Scan FSMedia::scan(Span<Path const> dirs) {
+	Scan ret;
+	for (auto const& dir : dirs) {
+		auto root = rootString(dir);
+		std::error_code ec;
+		for (auto it = stdfs::recursive_directory_iterator(root, stdfs::directory_options::skip_permission_denied, ec); !ec && it != stdfs::recursive_directory_iterator();
+			 it.increment(ec)) {
+			if (!it->is_regular_file(ec)) { continue; }
+			auto uri = it->path().lexically_relative(root).generic_string();
+			// earlier mounts take precedence
+			if (!ret.paths.contains(uri)) { ret.paths.emplace(uri, dir / Path(uri)); }
+		}
+		if (ec) { logW("[{}] failed to scan [{}]: {}", utils::tName<FSMedia>(), root, ec.message()); }
+		ret.roots.push_back(std::move(root));
+	}
+	logD("[{}] [{}] paths cached from [{}] mounts", utils::tName<FSMedia>(), ret.paths.size(), dirs.size());
+	return ret;
+}
 } // namespace le::io
@@ -0,0 +1,111 @@
+#include <levk/core/io/mapped_bytes.hpp>
+#include <levk/core/os.hpp>
+#include <fstream>
+
+#if defined(LEVK_OS_LINUX) || defined(LEVK_OS_APPLE)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LEVK_MMAP
+#endif
+
+namespace le::io {
+struct MappedBytes::Storage {
+	bytearray owned;
+	void* map{};
+	std::size_t mapSize{};
+
+	Storage() = default;
+	Storage(Storage const&) = delete;
+	Storage& operator=(Storage const&) = delete;
+
+	~Storage() {
+#if defined(LEVK_MMAP)
+		if (map) { ::munmap(map, mapSize); }
+#endif
+	}
+};
+
+namespace {
+std::optional<bytearray> readFile(Path const& path) {
+	if (auto file = std::ifstream(path.string(), std::ios::binary | std::ios::ate)) {
+		auto const pos = file.tellg();
+		auto buf = bytearray((std::size_t)pos);
+		file.seekg(0, std::ios::beg);
+		file.read((char*)buf.data(), (std::streamsize)pos);
+		return buf;
+	}
+	return std::nullopt;
+}
+} // namespace
+
+std::optional<MappedBytes> MappedBytes::map(Path const& path) {
+#if defined(LEVK_MMAP)
+	int const fd = ::open(path.string().data(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) { return std::nullopt; }
+	struct stat st {};
+	if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		::close(fd);
+		return std::nullopt;
+	}
+	if (st.st_size > 0) {
+		auto const size = (std::size_t)st.st_size;
+		void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (map != MAP_FAILED) {
+			auto storage = std::make_shared<Storage>();
+			storage->map = map;
+			storage->mapSize = size;
+			MappedBytes ret;
+			ret.m_bytes = Span<std::byte const>(static_cast<std::byte const*>(map), size);
+			ret.m_storage = std::move(storage);
+			return ret;
+		}
+	} else {
+		::close(fd);
+		return own({});
+	}
+#endif
+	if (auto bytes = readFile(path)) { return own(std::move(*bytes)); }
+	return std::nullopt;
+}
+
+MappedBytes MappedBytes::own(bytearray bytes) {
+	auto storage = std::make_shared<Storage>();
+	storage->owned = std::move(bytes);
+	MappedBytes ret;
+	ret.m_bytes = storage->owned;
+	ret.m_storage = std::move(storage);
+	return ret;
+}
+
+bool MappedBytes::prefetch([[maybe_unused]] Path const& path) {
+#if defined(LEVK_MMAP)
+	int const fd = ::open(path.string().data(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) { return false; }
+#if defined(POSIX_FADV_WILLNEED)
+	bool const ret = ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED) == 0;
+#else
+	bool const ret = false;
+#endif
+	::close(fd);
+	return ret;
+#else
+	return false;
+#endif
+}
+
+bool MappedBytes::mapped() const noexcept { return m_storage && m_storage->map; }
+
+void MappedBytes::populate() const noexcept {
+	if (!mapped()) { return; }
+#if defined(LEVK_MMAP)
+	::madvise(m_storage->map, m_storage->mapSize, MADV_WILLNEED);
+	auto const page = (std::size_t)::sysconf(_SC_PAGESIZE);
+	std::byte sum{};
+	for (std::size_t i = 0; i < m_bytes.size(); i += page) { sum ^= static_cast<std::byte const volatile&>(m_bytes[i]); }
+	[[maybe_unused]] std::byte volatile sink = sum;
+#endif
+}
+} // namespace le::io
@@ -4,10 +4,17 @@
 
 namespace le::io {
 std::optional<std::string> Media::string(Path const& uri) const {
+	if (auto bytes = mapped(uri)) { return std::string(bytes->view()); }
+	// media that only implement sstream()
 	if (auto str = sstream(uri)) { return str->str(); }
 	return std::nullopt;
 }
 
+std::optional<MappedBytes> Media::mapped(Path const& uri) const {
+	if (auto ret = bytes(uri)) { return MappedBytes::own(std::move(*ret)); }
+	return std::nullopt;
+}
+
 bool Media::present(Path const& uri, std::optional<LogLevel> absent) const {
 	if (!findPrefixed(uri)) {
 		if (absent) { log(*absent, "[{}] [{}] not found in {}!", utils::tName(this), uri.generic_string(), info().name); }
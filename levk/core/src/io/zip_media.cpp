@@ -4,6 +4,7 @@
 #include <levk/core/log.hpp>
 #include <levk/core/services.hpp>
 #include <levk/core/utils/string.hpp>
+#include <algorithm>
 
 namespace le::io {
 namespace {
@@ -53,13 +54,19 @@ ZIPMedia::ZIPMedia() { fsInit(); }
 bool ZIPMedia::mount(Path path) {
 	if (!fsActive()) { return false; }
 	auto const str = path.generic_string();
-	if (std::find(m_zips.begin(), m_zips.end(), path) == m_zips.end()) {
-		auto bytes = FSMedia{}.bytes(path);
-		if (!bytes) {
+	if (std::none_of(m_zips.begin(), m_zips.end(), [&path](Zip const& zip) { return zip.path == path; })) {
+		if (!io::is_regular_file(path)) {
 			logE("[{}] not found on {} [{}]!", utils::tName<ZIPMedia>(), FSMedia::info_v.name, str);
 			return false;
 		}
-		return mount(std::move(path), std::move(*bytes));
+		// PhysFS reads the archive through a file handle: only the central directory is resident
+		if (PHYSFS_mount(str.data(), nullptr, 0) == 0) {
+			logE("[{}] failed to mount archive [{}]: {}", utils::tName<ZIPMedia>(), str, PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+			return false;
+		}
+		logD("[{}] archive mounted [{}]", utils::tName<ZIPMedia>(), str);
+		m_zips.emplace_back(std::move(path));
+		return true;
 	}
 	logW("[{}] [{}] archive already mounted", utils::tName<FSMedia>(), str);
 	return false;
@@ -73,18 +80,23 @@ bool ZIPMedia::mount(Path point, Span<std::byte const> bytes) {
 		logE("[{}] failed to decompress archive [{}]!", utils::tName<ZIPMedia>(), str);
 		return false;
 	}
-	PHYSFS_mount(str.data(), nullptr, 0);
 	logD("[{}] archive mounted [{}]", utils::tName<ZIPMedia>(), str);
-	m_zips.push_back(std::move(point));
+	m_zips.emplace_back(std::move(point));
 	return true;
 }
 
 bool ZIPMedia::unmount(Path const& path) noexcept {
 	if (!fsActive()) { return false; }
 	for (auto it = m_zips.begin(); it != m_zips.end(); ++it) {
-		if (*it == path) {
+		if (it->path == path) {
 			auto const str = path.generic_string();
-			PHYSFS_unmount(str.data());
+			// fails while files in the archive are open (eg live streams)
+			if (PHYSFS_unmount(str.data()) == 0) {
+				logW("[{}] failed to unmount archive [{}]: {}", utils::tName<ZIPMedia>(), str, PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+				return false;
+			}
+			// already unmounted
+			it->path = {};
 			m_zips.erase(it);
 			logD("[{}] archive unmounted [{}]", utils::tName<ZIPMedia>(), str);
 			return true;
@@ -101,30 +113,59 @@ std::optional<Path> ZIPMedia::findPrefixed(Path const& uri) const {
 }
 
 std::optional<std::stringstream> ZIPMedia::sstream(Path const& uri) const {
-	if (present(uri, LogLevel::warn)) {
-		if (auto file = PHYSFS_openRead(uri.generic_string().data())) {
-			std::stringstream buf;
-			auto length = PHYSFS_fileLength(file);
-			std::string charBuf((std::size_t)length, 0);
-			PHYSFS_readBytes(file, charBuf.data(), (PHYSFS_uint64)length);
-			buf << charBuf;
-			PHYSFS_close(file);
-			return buf;
-		}
+	if (auto str = stream(uri)) {
+		std::string buf((std::size_t)str->size(), 0);
+		buf.resize(str->read(Span(reinterpret_cast<std::byte*>(buf.data()), buf.size())));
+		return std::stringstream(std::move(buf));
 	}
 	return std::nullopt;
 }
 
 std::optional<bytearray> ZIPMedia::bytes(Path const& uri) const {
+	if (auto str = stream(uri)) {
+		auto buf = bytearray((std::size_t)str->size());
+		buf.resize(str->read(buf));
+		return buf;
+	}
+	return std::nullopt;
+}
+
+std::optional<ZIPMedia::Stream> ZIPMedia::stream(Path const& uri) const {
 	if (present(uri, LogLevel::warn)) {
 		if (auto file = PHYSFS_openRead(uri.generic_string().data())) {
-			auto length = PHYSFS_fileLength(file);
-			auto buf = bytearray((std::size_t)length);
-			PHYSFS_readBytes(file, buf.data(), (PHYSFS_uint64)length);
-			PHYSFS_close(file);
-			return buf;
+			auto const length = PHYSFS_fileLength(file);
+			return Stream(file, length < 0 ? 0U : u64(length));
 		}
 	}
 	return std::nullopt;
 }
+
+ZIPMedia::Stream& ZIPMedia::Stream::operator=(Stream&& rhs) noexcept {
+	if (&rhs != this) {
+		if (m_file) { PHYSFS_close(static_cast<PHYSFS_File*>(m_file)); }
+		m_file = std::exchange(rhs.m_file, nullptr);
+		m_size = rhs.m_size;
+	}
+	return *this;
+}
+
+ZIPMedia::Stream::~Stream() {
+	if (m_file) { PHYSFS_close(static_cast<PHYSFS_File*>(m_file)); }
+}
+
+std::size_t ZIPMedia::Stream::read(Span<std::byte> out) {
+	if (!m_file || out.empty()) { return 0U; }
+	auto const ret = PHYSFS_readBytes(static_cast<PHYSFS_File*>(m_file), out.data(), (PHYSFS_uint64)out.size());
+	return ret < 0 ? 0U : std::size_t(ret);
+}
+
+bool ZIPMedia::Stream::seek(u64 offset) { return m_file && PHYSFS_seek(static_cast<PHYSFS_File*>(m_file), (PHYSFS_uint64)offset) != 0; }
+
+u64 ZIPMedia::Stream::tell() const {
+	if (!m_file) { return 0U; }
+	auto const ret = PHYSFS_tell(static_cast<PHYSFS_File*>(m_file));
+	return ret < 0 ? 0U : u64(ret);
+}
+
+bool ZIPMedia::Stream::eof() const { return !m_file || PHYSFS_eof(static_cast<PHYSFS_File*>(m_file)) != 0; }
 } // namespace le::io
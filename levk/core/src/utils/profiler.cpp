@@ -0,0 +1,221 @@
+#include <levk/core/utils/profiler.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace le::utils {
+namespace {
+std::atomic<u64> g_nextID{1};
+
+struct Local {
+	u64 owner{};
+	void* ring{};
+};
+
+thread_local Local t_local;
+thread_local std::string t_name;
+
+s64 ticks(time::Point point) noexcept { return point.time_since_epoch().count(); }
+time::Point point(s64 ticks) noexcept { return time::Point(time::Clock::duration(ticks)); }
+
+void escape(std::ostream& out, std::string_view str) {
+	for (char const ch : str) {
+		switch (ch) {
+		case '"': out << "\\\""; break;
+		case '\\': out << "\\\\"; break;
+		case '\n': out << "\\n"; break;
+		case '\t': out << "\\t"; break;
+		default: {
+			if (static_cast<unsigned char>(ch) < 0x20) {
+				out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(ch) << std::dec << std::setfill(' ');
+			} else {
+				out << ch;
+			}
+			break;
+		}
+		}
+	}
+}
+} // namespace
+
+struct ThreadProfiler::Ring {
+	// all fields atomic: readers may copy slots being overwritten (and then discard them)
+	struct Slot {
+		std::atomic<char const*> name{};
+		std::atomic<std::size_t> length{};
+		std::atomic<s64> start{};
+		std::atomic<s64> end{};
+		std::atomic<u32> depth{};
+	};
+
+	// one spare slot: the writer may be overwriting it while retained zones are read
+	std::unique_ptr<Slot[]> slots;
+	std::size_t capacity{};
+	std::atomic<u64> head{}; // zones written
+	std::string name;
+	std::thread::id thread;
+	u32 tid{};
+	// owning thread only
+	u32 depth{};
+	u64 frameStart{};
+
+	Ring(std::size_t capacity, std::string name, u32 tid)
+		: slots(std::make_unique<Slot[]>(capacity + 1)), capacity(capacity), name(std::move(name)), thread(std::this_thread::get_id()), tid(tid) {}
+
+	void push(std::string_view zone, time::Point start, time::Point end, u32 zoneDepth) noexcept {
+		auto const h = head.load(std::memory_order_relaxed);
+		// a reader that observes any of these stores also observes head >= h (and discards the slot)
+		std::atomic_thread_fence(std::memory_order_release);
+		auto& slot = slots[h % (capacity + 1)];
+		slot.name.store(zone.data(), std::memory_order_relaxed);
+		slot.length.store(zone.size(), std::memory_order_relaxed);
+		slot.start.store(ticks(start), std::memory_order_relaxed);
+		slot.end.store(ticks(end), std::memory_order_relaxed);
+		slot.depth.store(zoneDepth, std::memory_order_relaxed);
+		head.store(h + 1, std::memory_order_release);
+	}
+
+	Zone read(u64 index) const noexcept {
+		auto const& slot = slots[index % (capacity + 1)];
+		Zone ret;
+		ret.name = std::string_view(slot.name.load(std::memory_order_relaxed), slot.length.load(std::memory_order_relaxed));
+		ret.start = point(slot.start.load(std::memory_order_relaxed));
+		ret.end = point(slot.end.load(std::memory_order_relaxed));
+		ret.depth = slot.depth.load(std::memory_order_relaxed);
+		return ret;
+	}
+
+	// may be called from any thread
+	Thread snapshot() const {
+		Thread ret;
+		ret.name = name;
+		auto const last = head.load(std::memory_order_acquire);
+		auto const first = last > capacity ? last - capacity : 0U;
+		ret.zones.reserve(std::size_t(last - first));
+		for (u64 i = first; i < last; ++i) { ret.zones.push_back(read(i)); }
+		std::atomic_thread_fence(std::memory_order_acquire);
+		// zones the writer may have started overwriting during the copy
+		auto const now = head.load(std::memory_order_relaxed);
+		auto const valid = now > capacity ? now - capacity : 0U;
+		if (valid > first) {
+			auto const stale = std::size_t(std::min(valid, last) - first);
+			ret.zones.erase(ret.zones.begin(), ret.zones.begin() + stale);
+		}
+		ret.dropped = last - ret.zones.size();
+		return ret;
+	}
+};
+
+ThreadProfiler::ThreadProfiler() : ThreadProfiler(CreateInfo{}) {}
+
+ThreadProfiler::ThreadProfiler(CreateInfo const& info)
+	: m_unnamed(info.unnamed), m_epoch(time::now()), m_capacity(std::max(info.ringSize, std::size_t(1))), m_id(g_nextID++), m_enabled(info.enabled) {}
+
+ThreadProfiler::~ThreadProfiler() = default;
+
+void ThreadProfiler::nameThread(std::string name) { t_name = std::move(name); }
+
+void ThreadProfiler::next(Time_s total) {
+	Frame frame;
+	frame.total = total;
+	if (enabled()) {
+		auto& ring = *this->ring();
+		auto const last = ring.head.load(std::memory_order_relaxed);
+		auto const first = std::max(ring.frameStart, last > ring.capacity ? last - ring.capacity : 0U);
+		std::vector<Zone> zones;
+		zones.reserve(std::size_t(last - first));
+		for (u64 i = first; i < last; ++i) { zones.push_back(ring.read(i)); }
+		// zones are written on close (children first): order by start
+		std::sort(zones.begin(), zones.end(), [](Zone const& a, Zone const& b) { return a.start < b.start; });
+		for (auto const& zone : zones) {
+			auto it = std::find_if(frame.entries.begin(), frame.entries.end(), [&zone](Frame::Entry const& e) { return e.name == zone.name && e.depth == zone.depth; });
+			if (it != frame.entries.end()) {
+				it->dt += zone.dt();
+			} else {
+				frame.entries.push_back({zone.name, zone.dt(), zone.depth});
+			}
+		}
+		ring.frameStart = last;
+	}
+	std::scoped_lock lock(m_mutex);
+	m_frame = std::move(frame);
+}
+
+ThreadProfiler::Frame ThreadProfiler::lastFrame() const {
+	std::scoped_lock lock(m_mutex);
+	return m_frame;
+}
+
+std::vector<ThreadProfiler::Thread> ThreadProfiler::capture() const {
+	std::vector<Thread> ret;
+	std::scoped_lock lock(m_mutex);
+	ret.reserve(m_rings.size());
+	for (auto const& ring : m_rings) { ret.push_back(ring->snapshot()); }
+	return ret;
+}
+
+void ThreadProfiler::chromeTrace(std::ostream& out) const {
+	std::vector<std::pair<u32, Thread>> threads;
+	{
+		std::scoped_lock lock(m_mutex);
+		threads.reserve(m_rings.size());
+		for (auto const& ring : m_rings) { threads.emplace_back(ring->tid, ring->snapshot()); }
+	}
+	auto const us = [this](time::Point point) { return stdch::duration<f64, std::micro>(point - m_epoch).count(); };
+	auto const flags = out.flags();
+	auto const precision = out.precision();
+	out << std::fixed << std::setprecision(3) << R"({"displayTimeUnit":"ms","traceEvents":[)";
+	bool first = true;
+	auto const separate = [&out, &first] {
+		if (!first) { out << ','; }
+		out << '\n';
+		first = false;
+	};
+	for (auto const& [tid, thread] : threads) {
+		separate();
+		out << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << tid << R"(,"args":{"name":")";
+		escape(out, thread.name);
+		out << R"("}})";
+		for (auto const& zone : thread.zones) {
+			separate();
+			out << R"({"name":")";
+			escape(out, zone.name);
+			out << R"(","cat":"levk","ph":"X","pid":1,"tid":)" << tid << R"(,"ts":)" << us(zone.start) << R"(,"dur":)" << us(zone.end) - us(zone.start) << '}';
+		}
+	}
+	out << "\n]}\n";
+	out.flags(flags);
+	out.precision(precision);
+}
+
+std::string ThreadProfiler::chromeTrace() const {
+	std::stringstream str;
+	chromeTrace(str);
+	return str.str();
+}
+
+ThreadProfiler::Ring* ThreadProfiler::ring() {
+	if (t_local.owner == m_id) { return static_cast<Ring*>(t_local.ring); }
+	std::scoped_lock lock(m_mutex);
+	auto const id = std::this_thread::get_id();
+	auto it = std::find_if(m_rings.begin(), m_rings.end(), [id](auto const& ring) { return ring->thread == id; });
+	if (it == m_rings.end()) {
+		auto const tid = static_cast<u32>(m_rings.size());
+		auto name = t_name.empty() ? m_unnamed + " " + std::to_string(tid) : t_name;
+		m_rings.push_back(std::make_unique<Ring>(m_capacity, std::move(name), tid));
+		it = m_rings.end() - 1;
+	}
+	t_local = {m_id, it->get()};
+	return it->get();
+}
+
+ThreadProfiler::Scope::Scope(Ring* ring, std::string_view name) noexcept : m_ring(ring), m_name(name), m_start(time::now()), m_depth(ring->depth++) {}
+
+void ThreadProfiler::Scope::close() noexcept {
+	auto const end = time::now();
+	--m_ring->depth;
+	m_ring->push(m_name, m_start, end, m_depth);
+	m_ring = {};
+}
+} // namespace le::utils
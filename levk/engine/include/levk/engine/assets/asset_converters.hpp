@@ -3,6 +3,7 @@
 #include <levk/core/io/converters.hpp>
 #include <levk/core/io/path.hpp>
 #include <levk/engine/render/layer.hpp>
+#include <levk/graphics/packed_vertex.hpp>
 
 namespace le {
 namespace io {
@@ -28,6 +29,12 @@ constexpr ArrayMap<RenderFlag, std::string_view, std::size_t(RenderFlag::eCOUNT_
 	{RenderFlag::eWireframe, "wireframe"},
 }};
 
+constexpr ArrayMap<graphics::VertexFormat, std::string_view, std::size_t(graphics::VertexFormat::eCOUNT_)> vertexFormats = {{
+	{graphics::VertexFormat::eStandard, "standard"},
+	{graphics::VertexFormat::eCompact, "compact"},
+	{graphics::VertexFormat::eQuantized, "quantized"},
+}};
+
 template <>
 struct Jsonify<RenderFlags> : JsonHelper {
 	dj::json operator()(RenderFlags const& flags) const;
@@ -1,12 +1,17 @@
 #pragma once
 #include <ktl/async/kfunction.hpp>
+#include <levk/core/io/file_watcher.hpp>
 #include <levk/engine/assets/asset_store.hpp>
-#include <chrono>
+#include <mutex>
 
 namespace le {
+///
+/// \brief Reloads assets when their source files change
+///
+/// Paths are watched via io::FileWatcher: update() only visits monitors whose files changed.
+///
 class AssetMonitor {
   public:
-	using FTime = std::chrono::file_clock::time_point;
 	using Sign = AssetStore::Sign;
 
 	template <typename T>
@@ -14,32 +19,36 @@ class AssetMonitor {
 
 	template <typename T>
 	void attach(Hash uri, Span<io::Path const> paths, OnModified<T> onModified);
-	void detach(Hash uri) { m_monitors.erase(uri); }
-	void clear() { m_monitors.clear(); }
+	void detach(Hash uri);
+	void clear();
 
 	std::size_t update(AssetStore const& store);
+	///
+	/// \brief Check if backed by OS notifications (else update() polls timestamps of all watched files)
+	///
+	bool native() const noexcept { return m_watcher.native(); }
 
   private:
 	struct Base;
 	template <typename T>
 	struct Monitor;
 
+	void insert(Hash uri, std::unique_ptr<Base>&& monitor);
+	void erase(Hash uri);
+
 	std::unordered_map<Hash, std::unique_ptr<Base>> m_monitors;
+	std::unordered_map<std::string, std::vector<Hash>> m_uris;
+	io::FileWatcher m_watcher;
+	std::mutex m_mutex;
 };
 
 // impl
 
 struct AssetMonitor::Base {
-	struct Entry {
-		std::string path;
-		FTime lastModified;
-	};
-
-	std::vector<Entry> entries;
+	std::vector<io::Path> paths;
 
-	Base(Span<io::Path const> paths);
+	Base(Span<io::Path const> paths) : paths(paths.begin(), paths.end()) {}
 	virtual ~Base() = default;
-	bool modified();
 	virtual bool update(AssetStore const& store, Hash uri) = 0;
 };
 
@@ -49,7 +58,7 @@ struct AssetMonitor::Monitor : Base {
 	Monitor(Span<io::Path const> paths, OnModified<T>&& onModified) : Base(paths), onModified(std::move(onModified)) {}
 	bool update(AssetStore const& store, Hash uri) override {
 		auto t = store.find<T>(uri);
-		if (t && modified() && onModified(*t)) {
+		if (t && onModified(*t)) {
 			logI(LC_EndUser, "[Assets] [{}] modified", store.uri<T>(uri));
 			return true;
 		}
@@ -59,6 +68,6 @@ struct AssetMonitor::Monitor : Base {
 
 template <typename T>
 void AssetMonitor::attach(Hash uri, Span<io::Path const> paths, OnModified<T> onModified) {
-	if (uri != Hash() && !paths.empty() && onModified) { m_monitors.insert_or_assign(uri, std::make_unique<Monitor<T>>(paths, std::move(onModified))); }
+	if (uri != Hash() && !paths.empty() && onModified) { insert(uri, std::make_unique<Monitor<T>>(paths, std::move(onModified))); }
 }
 } // namespace le
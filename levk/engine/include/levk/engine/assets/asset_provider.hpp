@@ -13,7 +13,7 @@ class AssetProvider {
 	AssetProvider(Hash assetURI) noexcept : m_uri(assetURI) {}
 
 	Hash uri() const noexcept { return m_uri; }
-	void uri(Hash assetURI) noexcept { m_uri = assetURI; }
+	void uri(Hash assetURI) noexcept { m_uri = assetURI, m_handle = {}; }
 
 	bool empty() const noexcept { return m_uri == Hash(); }
 	bool ready(AssetStore const& store) const;
@@ -22,6 +22,7 @@ class AssetProvider {
 
   private:
 	Hash m_uri;
+	AssetStore::HandleCache<T> m_handle;
 };
 
 using RenderLayerProvider = AssetProvider<RenderLayer>;
@@ -31,7 +32,7 @@ using RenderPipeProvider = AssetProvider<RenderPipeline>;
 
 template <typename T>
 bool AssetProvider<T>::ready(AssetStore const& store) const {
-	return store.exists<T>(m_uri);
+	return find(store) != nullptr;
 }
 
 template <typename T>
@@ -42,6 +43,6 @@ T const& AssetProvider<T>::get(AssetStore const& store, T const& fallback) const
 
 template <typename T>
 Opt<T const> AssetProvider<T>::find(AssetStore const& store) const {
-	return store.find<T>(m_uri);
+	return store.find(m_uri, m_handle);
 }
 } // namespace le
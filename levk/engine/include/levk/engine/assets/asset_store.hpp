@@ -8,6 +8,8 @@
 #include <levk/core/utils/expect.hpp>
 #include <levk/core/utils/string.hpp>
 #include <levk/core/utils/type_guid.hpp>
+#include <array>
+#include <atomic>
 
 namespace le {
 class AssetStore : public NoCopy {
@@ -15,11 +17,37 @@ class AssetStore : public NoCopy {
 	using Sign = utils::TypeGUID;
 
 	struct Index;
+	template <typename T>
+	struct Handle;
+	template <typename T>
+	struct HandleCache;
 
 	template <typename T>
 	Opt<T> add(std::string uri, T t);
 	template <typename T>
+	Handle<T> addHandle(std::string uri, T t);
+	template <typename T>
 	Opt<T> find(Hash uri) const;
+	///
+	/// \brief Resolve handle in O(1) without locking; returns nullptr if asset was unloaded / replaced
+	///
+	template <typename T>
+	Opt<T> find(Handle<T> handle) const;
+	///
+	/// \brief Resolve cached handle, falling back to (locked) lookup by uri and refreshing the cache on failure
+	///
+	template <typename T>
+	Opt<T> find(Hash uri, Handle<T>& out_cache) const;
+	///
+	/// \brief Resolve cached handle (as above); cache may be shared between concurrent readers
+	///
+	template <typename T>
+	Opt<T> find(Hash uri, HandleCache<T> const& cache) const;
+	///
+	/// \brief Obtain a handle to an existing asset (locked lookup)
+	///
+	template <typename T>
+	Handle<T> handle(Hash uri) const;
 	bool exists(Hash uri) const;
 	template <typename T>
 	bool exists(Hash uri) const;
@@ -31,7 +59,17 @@ class AssetStore : public NoCopy {
 
 	void checkModified();
 	std::size_t size() const;
+	///
+	/// \brief Destroy all assets immediately (including retired ones): no handles may be resolved concurrently
+	///
 	void clear();
+	///
+	/// \brief Destroy assets unloaded / replaced before the previous call
+	///
+	/// Lock-free handle readers may still be dereferencing an asset just after it is unloaded / replaced:
+	/// such assets are retired instead, and only destroyed here, a full call interval later (eg once per frame).
+	///
+	void collect();
 
 	io::Media const& media() const noexcept { return m_customMedia ? *m_customMedia : m_fsMedia; }
 	io::FSMedia const& fsMedia() const noexcept { return m_fsMedia; }
@@ -48,23 +86,70 @@ class AssetStore : public NoCopy {
 
   private:
 	struct Base;
-	using TAssets = std::unordered_map<Hash, std::unique_ptr<Base>>;
+	struct Entry {
+		std::unique_ptr<Base> asset;
+		u32 slot{};
+	};
+	using TAssets = std::unordered_map<Hash, Entry>;
 	template <typename T>
 	struct TAsset;
 
+	// Handles index into fixed size chunks of slots; chunks are never freed / moved before destruction,
+	// so readers can resolve a slot without the lock. Writers (add / unload) serialise on m_assets.
+	struct Slot {
+		std::atomic<Base*> asset{};
+		std::atomic<u32> generation{};
+	};
+	static constexpr std::size_t chunk_size_v = 256;
+	static constexpr std::size_t max_chunks_v = 1024;
+	using Chunk = std::array<Slot, chunk_size_v>;
+	struct Storage {
+		TAssets assets;
+		std::vector<std::unique_ptr<Chunk>> chunks;
+		std::vector<u32> free;
+		// released assets awaiting collect(): retired since the last call, expiring on the next
+		std::vector<std::unique_ptr<Base>> retired;
+		std::vector<std::unique_ptr<Base>> expiring;
+	};
+
 	template <typename T>
-	Opt<T> add(std::unique_ptr<TAsset<T>>&& tasset);
+	Handle<T> add(std::unique_ptr<TAsset<T>>&& tasset);
 	template <typename T>
 	Opt<TAsset<T>> findImpl(Hash uri) const;
 
+	std::pair<u32, u32> acquire(Storage& out_storage, Base* asset);
+	void release(Storage& out_storage, u32 slot) noexcept;
+	void retire(Storage& out_storage, Entry& out_entry);
+	Opt<Base> resolve(u32 slot, u32 generation) const noexcept;
+	u32 generation(u32 slot) const noexcept;
+
 	template <typename T>
 	static TAsset<T>& toTAsset(Base& base) noexcept;
 
-	ktl::strict_tmutex<TAssets> m_assets;
+	ktl::strict_tmutex<Storage> m_assets;
+	std::array<std::atomic<Chunk*>, max_chunks_v> m_chunks{};
 	io::FSMedia m_fsMedia{};
 	Opt<io::Media const> m_customMedia{};
 };
 
+template <typename T>
+struct AssetStore::Handle {
+	u32 slot{};
+	u32 generation{};
+
+	explicit constexpr operator bool() const noexcept { return generation != 0; }
+	constexpr bool operator==(Handle const&) const = default;
+};
+
+template <typename T>
+struct AssetStore::HandleCache {
+	mutable std::atomic<Handle<T>> handle{};
+
+	HandleCache() = default;
+	HandleCache(HandleCache const& rhs) noexcept : handle(rhs.handle.load(std::memory_order_relaxed)) {}
+	HandleCache& operator=(HandleCache const& rhs) noexcept { return (handle.store(rhs.handle.load(std::memory_order_relaxed), std::memory_order_relaxed), *this); }
+};
+
 struct AssetStore::Index {
 	struct Type {
 		std::string_view name;
@@ -100,6 +185,11 @@ struct AssetStore::TAsset : Base {
 
 template <typename T>
 Opt<T> AssetStore::add(std::string uri, T t) {
+	return find(add(std::make_unique<TAsset<T>>(std::move(uri), std::move(t))));
+}
+
+template <typename T>
+auto AssetStore::addHandle(std::string uri, T t) -> Handle<T> {
 	return add(std::make_unique<TAsset<T>>(std::move(uri), std::move(t)));
 }
 
@@ -110,6 +200,44 @@ Opt<T> AssetStore::find(Hash uri) const {
 	return {};
 }
 
+template <typename T>
+Opt<T> AssetStore::find(Handle<T> handle) const {
+	if (!handle) { return {}; }
+	if (auto base = resolve(handle.slot, handle.generation); base && base->sign == sign<T>()) {
+		auto& t = toTAsset<T>(*base);
+		if (t.t) { return &*t.t; }
+	}
+	return {};
+}
+
+template <typename T>
+Opt<T> AssetStore::find(Hash uri, Handle<T>& out_cache) const {
+	if (auto ret = find(out_cache)) { return ret; }
+	out_cache = handle<T>(uri);
+	return find(out_cache);
+}
+
+template <typename T>
+Opt<T> AssetStore::find(Hash uri, HandleCache<T> const& cache) const {
+	// handles are validated on resolve: relaxed ordering suffices, and racing refreshes store equivalent values
+	auto handle = cache.handle.load(std::memory_order_relaxed);
+	if (auto ret = find(handle)) { return ret; }
+	handle = this->handle<T>(uri);
+	cache.handle.store(handle, std::memory_order_relaxed);
+	return find(handle);
+}
+
+template <typename T>
+auto AssetStore::handle(Hash uri) const -> Handle<T> {
+	if (uri == Hash()) { return {}; }
+	ktl::klock lock(m_assets);
+	if (auto it = lock->assets.find(uri); it != lock->assets.end()) {
+		EXPECT(it->second.asset);
+		if (it->second.asset->sign == sign<T>()) { return {it->second.slot, generation(it->second.slot)}; }
+	}
+	return {};
+}
+
 template <typename T>
 bool AssetStore::exists(Hash uri) const {
 	return findImpl<T>(uri) != nullptr;
@@ -124,10 +252,11 @@ std::string_view AssetStore::uri(Hash hash) const {
 template <typename T>
 bool AssetStore::unload(Hash uri) {
 	ktl::klock lock(m_assets);
-	if (auto it = lock->find(uri); it != lock->end()) {
-		EXPECT(it->second);
-		if (it->second->sign == sign<T>()) {
-			lock->erase(it);
+	if (auto it = lock->assets.find(uri); it != lock->assets.end()) {
+		EXPECT(it->second.asset);
+		if (it->second.asset->sign == sign<T>()) {
+			retire(*lock, it->second);
+			lock->assets.erase(it);
 			return true;
 		}
 	}
@@ -135,24 +264,31 @@ bool AssetStore::unload(Hash uri) {
 }
 
 template <typename T>
-Opt<T> AssetStore::add(std::unique_ptr<TAsset<T>>&& tasset) {
+auto AssetStore::add(std::unique_ptr<TAsset<T>>&& tasset) -> Handle<T> {
 	if (!tasset) { return {}; }
 	Hash const key = tasset->uri;
 	if (key == Hash()) { return {}; }
 	ktl::klock lock(m_assets);
-	auto const [it, b] = lock->insert_or_assign(key, std::move(tasset));
-	if (!b) { logW(LC_EndUser, "[Asset] Overwriting [{}]!", it->second->uri); }
-	logI(LC_EndUser, "== [Asset] [{}] added", it->second->uri);
-	return &*toTAsset<T>(*it->second).t;
+	auto it = lock->assets.find(key);
+	if (it != lock->assets.end()) {
+		logW(LC_EndUser, "[Asset] Overwriting [{}]!", it->second.asset->uri);
+		retire(*lock, it->second);
+	} else {
+		it = lock->assets.emplace(key, Entry{}).first;
+	}
+	auto const [slot, gen] = acquire(*lock, tasset.get());
+	it->second = Entry{std::move(tasset), slot};
+	logI(LC_EndUser, "== [Asset] [{}] added", it->second.asset->uri);
+	return {slot, gen};
 }
 
 template <typename T>
 auto AssetStore::findImpl(Hash uri) const -> Opt<TAsset<T>> {
 	if (uri == Hash()) { return {}; }
 	ktl::klock lock(m_assets);
-	if (auto it = lock->find(uri); it != lock->end()) {
-		EXPECT(it->second);
-		if (it->second->sign == sign<T>()) { return &toTAsset<T>(*it->second); }
+	if (auto it = lock->assets.find(uri); it != lock->assets.end()) {
+		EXPECT(it->second.asset);
+		if (it->second.asset->sign == sign<T>()) { return &toTAsset<T>(*it->second.asset); }
 	}
 	return {};
 }
@@ -20,6 +20,7 @@ struct Engine::BootInfo {
 	Device::CreateInfo device;
 	VRAM::CreateInfo vram;
 	std::optional<graphics::VSync> vsync;
+	std::optional<io::Path> pipelineCache = "levk-pipeline-cache.bin";
 };
 
 class Engine::Builder {
@@ -11,7 +11,8 @@ class executor;
 namespace le {
 namespace io {
 class Media;
-}
+class AsyncReader;
+} // namespace io
 
 namespace graphics {
 class Device;
@@ -48,7 +49,7 @@ class Engine {
 	using Context = graphics::RenderContext;
 	using Renderer = graphics::Renderer;
 	using Stats = utils::EngineStats;
-	using Profiler = std::conditional_t<levk_debug, utils::ProfileDB<>, utils::NullProfileDB>;
+	using Profiler = utils::ThreadProfiler;
 	using Executor = dts::executor;
 	using Signal = ktl::delegate<>::signal;
 
@@ -87,7 +88,8 @@ class Engine::Service {
 	void pushReceiver(not_null<input::Receiver*> context) const;
 	void setRenderer(std::unique_ptr<Renderer>&& renderer) const;
 
-	Profiler::Profiler profile(std::string_view name) const;
+	Profiler::Scope profile(std::string_view name) const;
+	Profiler& profiler() const noexcept;
 	window::Manager& windowManager() const noexcept;
 	Device& device() const noexcept;
 	VRAM& vram() const noexcept;
@@ -98,6 +100,7 @@ class Engine::Service {
 	AssetMonitor& monitor() const noexcept;
 	input::Receiver::Store& receiverStore() const noexcept;
 	Executor& executor() const noexcept;
+	io::AsyncReader& reader() const noexcept;
 
 	bool closing() const;
 	Extent2D framebufferSize() const noexcept;
@@ -0,0 +1,18 @@
+#pragma once
+#include <levk/core/std_types.hpp>
+#include <atomic>
+
+namespace le {
+///
+/// \brief Opt-out tag: entities with this component are never frustum culled
+///
+struct NoCull {};
+
+///
+/// \brief Per-frame frustum culling counters (reset by Engine every frame)
+///
+struct Culling {
+	inline static auto s_visible = std::atomic<u32>(0);
+	inline static auto s_culled = std::atomic<u32>(0);
+};
+} // namespace le
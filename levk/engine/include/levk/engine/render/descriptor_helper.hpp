@@ -34,6 +34,8 @@ class DescriptorUpdater : public DescriptorHelper {
 
 	template <typename T>
 	bool update(u32 binding, T const& t, vk::DescriptorType type = vk::DescriptorType::eUniformBuffer) const;
+	template <typename T>
+	bool update(u32 binding, Span<T const> ts, vk::DescriptorType type = vk::DescriptorType::eStorageBuffer) const;
 	bool update(u32 binding, Opt<Texture const> tex, TextureFallback tb = TextureFallback::eWhite) const;
 	bool update(u32 binding, ShaderBuffer const& buffer) const;
 
@@ -52,6 +54,11 @@ class DescriptorMap : public DescriptorHelper {
 
 	bool contains(u32 setNumber);
 	DescriptorUpdater nextSet(DrawBindings const& bindings, u32 setNumber);
+	///
+	/// \brief Index of tex (or its fallback) in the shader's bindless texture array
+	/// \returns nullopt if the shader does not use one
+	///
+	std::optional<u32> textureIndex(Opt<Texture const> tex, TextureFallback fb = TextureFallback::eWhite) const;
 
 	ShaderInput const& shaderInput() const noexcept { return *m_input; }
 	Cache const& cache() const noexcept { return *m_cache; }
@@ -95,4 +102,13 @@ bool DescriptorUpdater::update(u32 bind, T const& t, vk::DescriptorType type) co
 	}
 	return false;
 }
+
+template <typename T>
+bool DescriptorUpdater::update(u32 bind, Span<T const> ts, vk::DescriptorType type) const {
+	if (check(bind, &type)) {
+		m_descriptorSet->writeArray(ts, bind);
+		return true;
+	}
+	return false;
+}
 } // namespace le
@@ -15,6 +15,8 @@ struct RenderLayer {
 	RenderFlags flags = rflags_all;
 	RenderOrder order = RenderOrder::eDefault;
 	f32 lineWidth = 1.0f;
+	// drawn with the camera's view-projection (false for UI / ortho layers): only such lists are frustum culled
+	bool camera = true;
 
 	constexpr bool operator==(RenderLayer const& rhs) const = default;
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include <ktl/fixed_vector.hpp>
 #include <levk/engine/render/layer.hpp>
+#include <levk/graphics/packed_vertex.hpp>
 #include <compare>
 #include <string>
 
@@ -8,6 +9,8 @@ namespace le {
 struct RenderPipeline {
 	ktl::fixed_vector<std::string, 4> shaderURIs;
 	RenderLayer layer;
+	// must match the vertex format of meshes drawn with this pipeline
+	graphics::VertexFormat vertexFormat{};
 
 	bool operator==(RenderPipeline const& rhs) const;
 
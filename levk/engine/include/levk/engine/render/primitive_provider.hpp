@@ -2,10 +2,13 @@
 #include <ktl/async/kfunction.hpp>
 #include <levk/core/services.hpp>
 #include <levk/engine/assets/asset_store.hpp>
+#include <levk/graphics/bounds.hpp>
 #include <levk/graphics/draw_primitive.hpp>
 #include <levk/graphics/render/draw_list.hpp>
 
 namespace le {
+struct TextureRefs;
+
 class PrimitiveProvider {
   public:
 	using DrawPrimitive = graphics::DrawPrimitive;
@@ -20,11 +23,18 @@ class PrimitiveProvider {
 	Hash textureRefsURI() const { return m_texRefsURI; }
 
 	bool addDrawPrimitives(AssetStore const& store, graphics::DrawList& out, glm::mat4 const& matrix);
+	///
+	/// \brief Local space bounds of mesh primitive (invalid if not loaded)
+	///
+	graphics::AABB bounds(AssetStore const& store) const;
 
   private:
 	Hash m_meshURI{};
 	Hash m_materialURI{};
 	Hash m_texRefsURI{};
+	AssetStore::HandleCache<graphics::MeshPrimitive> m_mesh;
+	AssetStore::HandleCache<graphics::BPMaterialData> m_material;
+	AssetStore::HandleCache<TextureRefs> m_texRefs;
 };
 
 class PrimitiveGenerator {
@@ -1,5 +1,6 @@
 #pragma once
 #include <levk/engine/render/render_order.hpp>
+#include <levk/graphics/packed_vertex.hpp>
 #include <levk/graphics/render/draw_list.hpp>
 #include <levk/graphics/render/pipeline.hpp>
 
@@ -8,6 +9,12 @@ struct RenderList {
 	graphics::Pipeline pipeline;
 	graphics::DrawList drawList;
 	RenderOrder order = RenderOrder::eDefault;
+	// for diagnostics (eg GPU timer scopes); must outlive the list
+	std::string_view name{};
+	// pipeline's vertex input: primitives in any other format cannot be drawn
+	graphics::VertexFormat vertexFormat{};
+	// drawn with the camera's view-projection (RenderLayer::camera): meshlets may be culled
+	bool camera = true;
 
 	auto operator<=>(RenderList const& rhs) const { return order <=> rhs.order; }
 };
@@ -1,6 +1,8 @@
 #pragma once
 #include <glm/vec2.hpp>
 #include <levk/core/time.hpp>
+#include <string>
+#include <vector>
 
 namespace le::utils {
 struct EngineStats {
@@ -10,18 +12,62 @@ struct EngineStats {
 		u32 rate;
 		Time_s dt;
 	};
+	struct GpuScope {
+		std::string name;
+		Time_s dt;
+	};
 	struct Gfx {
 		struct {
 			u64 buffers;
 			u64 images;
 		} bytes;
+		// live device allocations
+		struct {
+			u64 buffers;
+			u64 images;
+		} allocations;
+		// GeometryArena usage (mesh vertex / index data)
+		struct {
+			u64 bytes;
+			u32 pages;
+			u32 allocations;
+		} geometry;
 		struct {
 			glm::uvec2 swapchain;
 			glm::uvec2 window;
 			glm::uvec2 renderer;
 		} extents;
+		struct {
+			u32 visible;
+			u32 culled;
+		} objects;
+		// meshlets of drawn primitives (ListRenderer)
+		struct {
+			u32 visible;
+			u32 culled;
+		} clusters;
+		struct {
+			// GPU time per timer scope (main pass, blit, render lists), a few frames behind
+			std::vector<GpuScope> scopes;
+			bool supported;
+		} gpu;
 		u32 drawCalls;
+		// descriptor sets bound over the last frame
+		u32 setBinds;
+		// vertex / index buffers bound over the last frame
+		u32 bufferBinds;
 		u32 triCount;
+		// Vulkan objects created over the last frame (0 in steady state)
+		u32 objectsMade;
+		// descriptor set updates over the last frame
+		struct {
+			// vkUpdateDescriptorSets calls
+			u32 updates;
+			// descriptor bindings written
+			u32 writes;
+			// writes elided (binding contents unchanged)
+			u32 skipped;
+		} descriptors;
 	};
 
 	Frame frame;
@@ -38,7 +38,7 @@ RenderFlags Jsonify<RenderFlags>::operator()(dj::json const& json) const {
 
 dj::json Jsonify<RenderLayer>::operator()(RenderLayer const& layer) const {
 	dj::json ret;
-	insert(ret, "mode", polygonModes[layer.mode], "topology", topologies[layer.topology], "line_width", layer.lineWidth, "order", s64(layer.order));
+	insert(ret, "mode", polygonModes[layer.mode], "topology", topologies[layer.topology], "line_width", layer.lineWidth, "order", s64(layer.order), "camera", layer.camera);
 	ret.insert("flags", to(layer.flags));
 	return ret;
 }
@@ -50,6 +50,7 @@ RenderLayer Jsonify<RenderLayer>::operator()(dj::json const& json) const {
 	ret.flags = to<RenderFlags>(json.get("flags"));
 	ret.lineWidth = json.get_as<f32>("line_width", ret.lineWidth);
 	ret.order = RenderOrder{json.get_as<s64>("order")};
+	ret.camera = json.get_as<bool>("camera", ret.camera);
 	return ret;
 }
 } // namespace le::io
@@ -1,3 +1,4 @@
+#include <levk/core/io/async_reader.hpp>
 #include <levk/core/utils/enumerate.hpp>
 #include <levk/engine/assets/asset_converters.hpp>
 #include <levk/engine/assets/asset_manifest.hpp>
@@ -10,42 +11,87 @@
 #include <levk/graphics/skybox.hpp>
 #include <levk/graphics/texture.hpp>
 #include <levk/graphics/utils/utils.hpp>
+#include <mutex>
+#include <unordered_map>
 
 namespace le {
 namespace {
 bool isGlsl(io::Path const& path) { return path.has_extension() && (path.extension() == ".vert" || path.extension() == ".frag"); }
+bool isGltf(io::Path const& path) { return path.has_extension() && (path.extension() == ".gltf" || path.extension() == ".glb"); }
+
+io::Path spirvPath(io::Path const& glsl, io::FSMedia const& media) {
+	if (auto spv = graphics::utils::cachedSpirV(media.fullPath(glsl))) { return *spv; }
+	for (bool const debug : {levk_debug, false}) {
+		if (auto spv = graphics::utils::spirVpath(glsl, debug); media.present(spv, std::nullopt)) {
+			logW(LC_LibUser, "[Assets] Shader compilation failed, using existing SPIR-V [{}]", spv.generic_string());
+			return spv;
+		}
+	}
+	if constexpr (levk_debug) { ENSURE(false, "Failed to compile GLSL"); }
+	return graphics::utils::spirVpath(glsl);
+}
 
-template <bool D = levk_debug>
-io::Path spirvPath(io::Path const& glsl, io::FSMedia const& media);
+///
+/// \brief Files read ahead on I/O threads during preload; each path is read once and shared by all load tasks that take it
+///
+struct Prefetch {
+	struct Entry {
+		io::AsyncReader::Future future;
+		std::optional<io::AsyncReader::Result> result;
+		std::mutex mutex;
+		// load tasks yet to take this entry
+		std::size_t takers{};
+
+		Entry(io::AsyncReader::Future future, std::size_t takers) noexcept : future(std::move(future)), takers(takers) {}
+
+		io::AsyncReader::Result get() {
+			std::scoped_lock lock(mutex);
+			if (!result) { result = future.get(); }
+			// copies share the mapping
+			return *result;
+		}
+	};
 
-template <>
-[[maybe_unused]] io::Path spirvPath<true>(io::Path const& glsl, io::FSMedia const& media) {
-	auto dbg = graphics::utils::spirVpath(glsl);
-	if (auto res = graphics::utils::compileGlsl(media.fullPath(glsl))) {
-		dbg = *res;
-	} else {
-		if (media.present(dbg)) {
-			logW(LC_LibUser, "[Assets] Shader compilation failed, using existing SPIR-V [{}]", dbg.generic_string());
-			return dbg;
+	std::vector<io::Path> uris;
+	std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+	std::mutex mutex;
+
+	void add(io::Path uri) { uris.push_back(std::move(uri)); }
+
+	void issue(io::AsyncReader& reader, io::Media const& media) {
+		// duplicate paths (eg shared cubemap faces) are read once
+		std::unordered_map<std::string, std::size_t> takers;
+		std::vector<io::Path> unique;
+		for (auto& uri : uris) {
+			if (takers[uri.generic_string()]++ == 0U) { unique.push_back(std::move(uri)); }
 		}
-		if (auto rel = graphics::utils::spirVpath(glsl, false); media.present(rel)) {
-			logW(LC_LibUser, "[Assets] Shader compilation failed, using existing SPIR-V [{}]", rel.generic_string());
-			return rel;
+		auto results = reader.read(media, unique);
+		std::scoped_lock lock(mutex);
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			auto key = unique[i].generic_string();
+			auto const count = takers[key];
+			entries.insert_or_assign(std::move(key), std::make_shared<Entry>(std::move(results[i]), count));
 		}
-		ENSURE(false, "Failed to compile GLSL");
+		uris.clear();
 	}
-	// compile Release shader too
-	graphics::utils::compileGlsl(media.fullPath(glsl), {}, {}, false);
-	return dbg;
-}
 
-template <>
-[[maybe_unused]] io::Path spirvPath<false>(io::Path const& glsl, io::FSMedia const& media) {
-	auto spv = graphics::utils::spirVpath(glsl);
-	if (!media.present(spv, std::nullopt)) {
-		if (auto res = graphics::utils::compileGlsl(media.fullPath(glsl))) { spv = *res; }
+	std::optional<io::MappedBytes> take(io::Media const& media, io::Path const& uri) {
+		std::unique_lock lock(mutex);
+		if (auto it = entries.find(uri.generic_string()); it != entries.end()) {
+			auto entry = it->second;
+			if (--entry->takers == 0U) { entries.erase(it); }
+			lock.unlock();
+			return entry->get();
+		}
+		lock.unlock();
+		return media.mapped(uri);
 	}
-	return spv;
+};
+
+using PrefetchPtr = std::shared_ptr<Prefetch>;
+
+std::optional<io::MappedBytes> fetch(Prefetch* prefetch, io::Media const& media, io::Path const& uri) {
+	return prefetch ? prefetch->take(media, uri) : media.mapped(uri);
 }
 } // namespace
 
@@ -100,7 +146,7 @@ ktl::kfunction<void()> spirVFunc(std::string uri, Engine::Service engine, dj::pt
 			// fallback to previously compiled shader
 			path = graphics::utils::spirVpath(path);
 		}
-		auto res = engine.store().media().bytes(path);
+		auto res = engine.store().media().mapped(path);
 		if (!res) { return; }
 		graphics::SpirV spirV;
 		spirV.spirV = std::vector<u32>(res->size() / 4);
@@ -111,7 +157,7 @@ ktl::kfunction<void()> spirVFunc(std::string uri, Engine::Service engine, dj::pt
 			engine.monitor().attach<graphics::SpirV>(uri, fsMedia->fullPath(uri), [uri, engine](graphics::SpirV& out) {
 				if (auto fsMedia = dynamic_cast<io::FSMedia const*>(&engine.store().media())) {
 					auto path = spirvPath(uri, *fsMedia);
-					if (auto res = fsMedia->bytes(path)) {
+					if (auto res = fsMedia->mapped(path)) {
 						out.spirV = std::vector<u32>(res->size() / 4);
 						std::memcpy(out.spirV.data(), res->data(), res->size());
 						engine.context().pipelineFactory().markStale(uri);
@@ -124,20 +170,20 @@ ktl::kfunction<void()> spirVFunc(std::string uri, Engine::Service engine, dj::pt
 	};
 }
 
-bool constructCubemap(io::Path const& prefix, Span<std::string const> files, io::Media const& media, graphics::Texture& out) {
+bool constructCubemap(io::Path const& prefix, Span<std::string const> files, io::Media const& media, graphics::Texture& out, Prefetch* prefetch = {}) {
 	EXPECT(files.size() == 6U);
-	bytearray bytes[6];
+	io::MappedBytes bytes[6];
 	ImageData cube[6];
 	for (auto const& [file, idx] : utils::enumerate(files)) {
-		auto res = media.bytes(prefix / file);
+		auto res = fetch(prefetch, media, prefix / file);
 		if (!res) { return false; }
 		bytes[idx] = std::move(*res);
-		cube[idx] = bytes[idx];
+		cube[idx] = bytes[idx].span();
 	}
 	return out.construct(cube);
 }
 
-ktl::kfunction<void()> textureFunc(Engine::Service engine, std::string uri, dj::ptr<dj::json> const& json) {
+ktl::kfunction<void()> textureFunc(Engine::Service engine, std::string uri, dj::ptr<dj::json> const& json, PrefetchPtr const& prefetch) {
 	std::vector<std::string> files = json->get_as<std::vector<std::string>>("files");
 	if (files.empty()) {
 		if (auto file = json->find_as<std::string>("file")) {
@@ -148,12 +194,17 @@ ktl::kfunction<void()> textureFunc(Engine::Service engine, std::string uri, dj::
 	}
 	Hash samplerURI = json->get_as<std::string>("sampler", "samplers/default");
 	io::Path prefix = json->get_as<std::string>("prefix");
-	return [uri, samplerURI, prefix, files, engine]() {
+	if (files.size() > 1U) {
+		for (auto const& file : files) { prefetch->add(prefix / file); }
+	} else {
+		prefetch->add(files[0]);
+	}
+	return [uri, samplerURI, prefix, files, engine, prefetch]() {
 		auto sampler = engine.store().find<graphics::Sampler>(samplerURI);
 		if (!sampler) { return; }
 		graphics::Texture texture(&engine.vram(), sampler->sampler());
 		if (files.size() > 1U) {
-			if (constructCubemap(prefix, files, engine.store().media(), texture)) {
+			if (constructCubemap(prefix, files, engine.store().media(), texture, prefetch.get())) {
 				engine.store().add(std::move(uri), std::move(texture));
 				if (ManifestLoader::s_attachMonitors) {
 					if (auto fsMedia = dynamic_cast<io::FSMedia const*>(&engine.store().media())) {
@@ -167,14 +218,14 @@ ktl::kfunction<void()> textureFunc(Engine::Service engine, std::string uri, dj::
 				}
 			}
 		} else {
-			auto res = engine.store().media().bytes(files[0]);
+			auto res = prefetch->take(engine.store().media(), files[0]);
 			if (!res) { return; }
-			if (texture.construct(*res)) {
+			if (texture.construct(res->span())) {
 				engine.store().add(uri, std::move(texture));
 				if (ManifestLoader::s_attachMonitors) {
 					if (auto fsMedia = dynamic_cast<io::FSMedia const*>(&engine.store().media())) {
 						auto f = [engine, file = files[0]](graphics::Texture& out) {
-							if (auto res = engine.store().media().bytes(file)) { return out.construct(*res); }
+							if (auto res = engine.store().media().mapped(file)) { return out.construct(res->span()); }
 							return false;
 						};
 						engine.monitor().attach<graphics::Texture>(uri, fsMedia->fullPath(files[0]), f);
@@ -185,7 +236,7 @@ ktl::kfunction<void()> textureFunc(Engine::Service engine, std::string uri, dj::
 	};
 }
 
-ktl::kfunction<void()> fontFunc(Engine::Service engine, std::string uri, dj::ptr<dj::json> const& json) {
+ktl::kfunction<void()> fontFunc(Engine::Service engine, std::string uri, dj::ptr<dj::json> const& json, PrefetchPtr const& prefetch) {
 	io::Path ttfURI;
 	if (auto file = json->find("file"); file && file->is_string()) {
 		ttfURI = file->as<std::string_view>();
@@ -195,20 +246,22 @@ ktl::kfunction<void()> fontFunc(Engine::Service engine, std::string uri, dj::ptr
 	}
 	bool mipMaps = json->get_as<bool>("mip_maps", true);
 	auto height = graphics::Font::Height{json->get_as<u32>("height", u32(graphics::Font::Height::eDefault))};
-	return [uri, ttfURI, mipMaps, height, engine] {
-		auto ttf = engine.store().media().bytes(ttfURI);
+	prefetch->add(ttfURI);
+	return [uri, ttfURI, mipMaps, height, engine, prefetch] {
+		auto ttf = prefetch->take(engine.store().media(), ttfURI);
 		if (!ttf) { return; }
 		graphics::Font::Info fi;
 		fi.name = ttfURI.filename().string();
-		fi.ttf = *ttf;
+		fi.ttf = ttf->span();
 		fi.height = height;
 		fi.atlas.mipMaps = mipMaps;
 		engine.store().add(std::move(uri), graphics::Font(&engine.vram(), std::move(fi)));
 	};
 }
 
-ktl::kfunction<void()> renderPipelineFunc(Engine::Service engine, std::string uri, std::string layer, std::vector<std::string> shaders) {
-	return [e = engine, uri = std::move(uri), st = std::move(layer), sh = std::move(shaders)]() {
+ktl::kfunction<void()> renderPipelineFunc(Engine::Service engine, std::string uri, std::string layer, std::vector<std::string> shaders,
+										  graphics::VertexFormat format) {
+	return [e = engine, uri = std::move(uri), st = std::move(layer), sh = std::move(shaders), format]() {
 		auto layer = e.store().find<RenderLayer>(st);
 		if (!layer) {
 			logW(LC_LibUser, "[Asset] Failed to find RenderLayer [{}]", st);
@@ -217,6 +270,7 @@ ktl::kfunction<void()> renderPipelineFunc(Engine::Service engine, std::string ur
 		RenderPipeline rp;
 		rp.layer = *layer;
 		rp.shaderURIs = {sh.begin(), sh.end()};
+		rp.vertexFormat = format;
 		e.store().add(std::move(uri), rp);
 	};
 }
@@ -287,7 +341,7 @@ ktl::kfunction<void()> skyboxFunc(Engine::Service engine, std::string uri, std::
 	};
 }
 
-ktl::kfunction<void()> objMeshFunc(Engine::Service engine, std::string uri, dj::ptr<dj::json> const& json) {
+ktl::kfunction<void()> objMeshFunc(Engine::Service engine, std::string uri, dj::ptr<dj::json> const& json, graphics::VertexFormat format) {
 	std::string meshJSON = json->get_as<std::string>("file");
 	if (meshJSON.empty()) {
 		io::Path path = uri;
@@ -295,8 +349,8 @@ ktl::kfunction<void()> objMeshFunc(Engine::Service engine, std::string uri, dj::
 		path += ".json";
 		meshJSON = path.generic_string();
 	}
-	return [engine, json = std::move(meshJSON), uri = std::move(uri)] {
-		if (auto mesh = graphics::Mesh::fromObjMtl(json, engine.store().media(), &engine.vram())) {
+	return [engine, json = std::move(meshJSON), uri = std::move(uri), format] {
+		if (auto mesh = graphics::Mesh::fromObjMtl(json, engine.store().media(), &engine.vram(), {}, format)) {
 			engine.store().add(std::move(uri), std::move(*mesh));
 		} else {
 			logW(LC_LibUser, "[Asset] Failed to load Mesh from OBJ [{}]", json);
@@ -304,8 +358,27 @@ ktl::kfunction<void()> objMeshFunc(Engine::Service engine, std::string uri, dj::
 	};
 }
 
+ktl::kfunction<void()> gltfMeshFunc(Engine::Service engine, std::string uri, std::string file, PrefetchPtr const& prefetch, graphics::VertexFormat format) {
+	prefetch->add(file);
+	return [engine, file = std::move(file), uri = std::move(uri), prefetch, format] {
+		auto bytes = prefetch->take(engine.store().media(), file);
+		if (!bytes) {
+			logW(LC_LibUser, "[Asset] Failed to read glTF [{}]", file);
+			return;
+		}
+		if (auto mesh = graphics::Mesh::fromGltf(file, bytes->span(), engine.store().media(), &engine.vram(), &engine.executor(), format)) {
+			engine.store().add(std::move(uri), std::move(*mesh));
+		} else {
+			logW(LC_LibUser, "[Asset] Failed to load Mesh from glTF [{}]", file);
+		}
+	};
+}
+
 struct DefaultParser : AssetManifest::Parser {
-	using Parser::Parser;
+	DefaultParser(Engine::Service engine, not_null<Stages*> stages, Opt<Parser const> next, PrefetchPtr prefetch)
+		: Parser(engine, stages, next), m_prefetch(std::move(prefetch)) {}
+
+	PrefetchPtr m_prefetch;
 
 	std::optional<std::size_t> operator()(std::string_view name, Group const& group) const override {
 		if (name == "samplers") { return samplers(group); }
@@ -355,7 +428,7 @@ struct DefaultParser : AssetManifest::Parser {
 	std::size_t textures(Group const& group) const {
 		std::size_t ret{};
 		for (auto& [uri, json] : group) {
-			enqueue(order<graphics::Texture>(), textureFunc(m_engine, std::move(uri), json));
+			enqueue(order<graphics::Texture>(), textureFunc(m_engine, std::move(uri), json, m_prefetch));
 			++ret;
 		}
 		return ret;
@@ -366,8 +439,9 @@ struct DefaultParser : AssetManifest::Parser {
 		for (auto& [uri, json] : group) {
 			auto layer = json->get_as<std::string>("layer");
 			auto shaders = json->get_as<std::vector<std::string>>("shaders");
+			auto const format = io::vertexFormats[json->get_as<std::string_view>("vertex_format")];
 			if (!layer.empty() && !shaders.empty()) {
-				enqueue(order<RenderPipeline>(), renderPipelineFunc(m_engine, std::move(uri), std::move(layer), std::move(shaders)));
+				enqueue(order<RenderPipeline>(), renderPipelineFunc(m_engine, std::move(uri), std::move(layer), std::move(shaders), format));
 				++ret;
 			}
 		}
@@ -399,7 +473,7 @@ struct DefaultParser : AssetManifest::Parser {
 	std::size_t fonts(Group const& group) const {
 		std::size_t ret{};
 		for (auto& [uri, json] : group) {
-			enqueue(order<graphics::Font>(), fontFunc(m_engine, std::move(uri), json));
+			enqueue(order<graphics::Font>(), fontFunc(m_engine, std::move(uri), json, m_prefetch));
 			++ret;
 		}
 		return ret;
@@ -419,7 +493,13 @@ struct DefaultParser : AssetManifest::Parser {
 	std::size_t meshes(Group const& group) const {
 		std::size_t ret{};
 		for (auto& [uri, json] : group) {
-			enqueue(order<graphics::Mesh>(), objMeshFunc(m_engine, std::move(uri), json));
+			// vertex layout primitives are converted to on import
+			auto const format = io::vertexFormats[json->get_as<std::string_view>("vertex_format")];
+			if (auto file = json->get_as<std::string>("file"); isGltf(file)) {
+				enqueue(order<graphics::Mesh>(), gltfMeshFunc(m_engine, std::move(uri), std::move(file), m_prefetch, format));
+			} else {
+				enqueue(order<graphics::Mesh>(), objMeshFunc(m_engine, std::move(uri), json, format));
+			}
 			++ret;
 		}
 		return ret;
@@ -472,9 +552,12 @@ static std::size_t recurse(std::string_view name, AssetManifest::Group const& gr
 
 std::size_t ManifestLoader::preload(dj::json const& root, Opt<Parser const> custom) {
 	m_manifest.list = AssetManifest::populate(root);
-	DefaultParser parser(m_engine, &m_stages, custom);
+	auto prefetch = std::make_shared<Prefetch>();
+	DefaultParser parser(m_engine, &m_stages, custom, prefetch);
 	std::size_t ret = {};
 	for (auto const& [id, group] : m_manifest.list) { ret += recurse(id, group, parser); }
+	// start reading files off disk now: load tasks block on (or skip) reads instead of issuing them serially
+	prefetch->issue(m_engine.reader(), m_engine.store().media());
 	if (ret > 0U) { logI(LC_EndUser, "[Asset] [{}] Assets preloaded into manifest", ret); }
 	return ret;
 }
@@ -1,45 +1,63 @@
 #include <levk/engine/assets/asset_monitor.hpp>
-#include <filesystem>
+#include <algorithm>
 
 namespace le {
-namespace {
-AssetMonitor::FTime ftime(std::string_view const path) {
-	auto const p = std::filesystem::path(path);
-	if (std::filesystem::is_regular_file(p)) { return std::filesystem::last_write_time(p); }
-	return {};
+void AssetMonitor::detach(Hash uri) {
+	std::scoped_lock lock(m_mutex);
+	erase(uri);
 }
-} // namespace
 
-AssetMonitor::Base::Base(Span<io::Path const> paths) {
-	for (auto& path : paths) {
-		auto str = path.generic_string();
-		auto const ft = ftime(str);
-		entries.push_back({std::move(str), ft});
+void AssetMonitor::clear() {
+	std::scoped_lock lock(m_mutex);
+	m_monitors.clear();
+	m_uris.clear();
+	m_watcher.clear();
+}
+
+void AssetMonitor::insert(Hash uri, std::unique_ptr<Base>&& monitor) {
+	std::scoped_lock lock(m_mutex);
+	erase(uri);
+	for (auto& path : monitor->paths) {
+		if (auto watched = m_watcher.watch(path)) {
+			path = std::move(*watched);
+			m_uris[path.generic_string()].push_back(uri);
+		}
 	}
+	m_monitors.emplace(uri, std::move(monitor));
 }
 
-bool AssetMonitor::Base::modified() {
-	bool ret{};
-	for (auto& entry : entries) {
-		if (auto const lm = ftime(entry.path); lm != entry.lastModified) {
-			entry.lastModified = lm;
-			ret = true;
+void AssetMonitor::erase(Hash uri) {
+	auto it = m_monitors.find(uri);
+	if (it == m_monitors.end()) { return; }
+	for (auto const& path : it->second->paths) {
+		if (auto uris = m_uris.find(path.generic_string()); uris != m_uris.end()) {
+			std::erase(uris->second, uri);
+			if (uris->second.empty()) {
+				m_uris.erase(uris);
+				m_watcher.unwatch(path);
+			}
 		}
 	}
-	return ret;
+	m_monitors.erase(it);
 }
 
 std::size_t AssetMonitor::update(AssetStore const& store) {
+	std::scoped_lock lock(m_mutex);
+	std::vector<Hash> dirty;
+	for (auto const& path : m_watcher.changed()) {
+		// a changed file may have been created / deleted: drop its cached resolution
+		store.fsMedia().invalidate(path);
+		if (auto it = m_uris.find(path.generic_string()); it != m_uris.end()) { dirty.insert(dirty.end(), it->second.begin(), it->second.end()); }
+	}
+	std::sort(dirty.begin(), dirty.end(), [](Hash a, Hash b) { return a.hash < b.hash; });
+	dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
 	std::size_t ret{};
-	for (auto it = m_monitors.begin(); it != m_monitors.end();) {
-		if (!store.exists(it->first)) {
-			it = m_monitors.erase(it);
-		} else {
-			++it;
+	for (Hash const uri : dirty) {
+		if (!store.exists(uri)) {
+			erase(uri);
+			continue;
 		}
-	}
-	for (auto const& [uri, monitor] : m_monitors) {
-		if (monitor->update(store, uri)) { ++ret; }
+		if (auto it = m_monitors.find(uri); it != m_monitors.end() && it->second->update(store, uri)) { ++ret; }
 	}
 	if (ret > 0U) { logI(LC_EndUser, "[Assets] [{}] monitors updated", ret); }
 	return ret;
@@ -1,25 +1,45 @@
+#include <levk/core/utils/error.hpp>
 #include <levk/engine/assets/asset_store.hpp>
+#include <utility>
 
 namespace le {
-bool AssetStore::exists(Hash uri) const { return ktl::klock(m_assets)->contains(uri); }
+bool AssetStore::exists(Hash uri) const { return ktl::klock(m_assets)->assets.contains(uri); }
 
 bool AssetStore::unload(Hash uri) {
 	ktl::klock lock(m_assets);
-	if (auto it = lock->find(uri); it != lock->end()) {
-		lock->erase(it);
+	if (auto it = lock->assets.find(uri); it != lock->assets.end()) {
+		retire(*lock, it->second);
+		lock->assets.erase(it);
 		return true;
 	}
 	return false;
 }
 
-std::size_t AssetStore::size() const { return ktl::klock(m_assets)->size(); }
+std::size_t AssetStore::size() const { return ktl::klock(m_assets)->assets.size(); }
 
-void AssetStore::clear() { ktl::klock(m_assets)->clear(); }
+void AssetStore::clear() {
+	ktl::klock lock(m_assets);
+	for (auto const& [_, entry] : lock->assets) { release(*lock, entry.slot); }
+	lock->assets.clear();
+	lock->retired.clear();
+	lock->expiring.clear();
+}
+
+void AssetStore::collect() {
+	std::vector<std::unique_ptr<Base>> expired;
+	{
+		ktl::klock lock(m_assets);
+		expired = std::exchange(lock->expiring, std::move(lock->retired));
+		lock->retired.clear();
+	}
+	// destroyed outside the lock
+}
 
 AssetStore::Index AssetStore::index(Span<Sign const> signs, std::string_view filter) const {
 	ktl::klock lock(m_assets);
 	std::unordered_map<Sign, std::vector<Base*>, std::hash<Sign::type>> mapped;
-	for (auto const& [hash, asset] : *lock) {
+	for (auto const& [hash, entry] : lock->assets) {
+		auto const& asset = entry.asset;
 		EXPECT(asset);
 		if (!filter.empty() && asset->uri.find(filter) == std::string_view::npos) { continue; }
 		if (!signs.empty() && std::find(signs.begin(), signs.end(), asset->sign) == signs.end()) { continue; }
@@ -36,4 +56,55 @@ AssetStore::Index AssetStore::index(Span<Sign const> signs, std::string_view fil
 	}
 	return ret;
 }
+
+std::pair<u32, u32> AssetStore::acquire(Storage& out_storage, Base* asset) {
+	u32 index{};
+	if (!out_storage.free.empty()) {
+		index = out_storage.free.back();
+		out_storage.free.pop_back();
+	} else {
+		std::size_t const chunk = out_storage.chunks.size();
+		ENSURE(chunk < max_chunks_v, "AssetStore slots exhausted");
+		auto& c = out_storage.chunks.emplace_back(std::make_unique<Chunk>());
+		m_chunks[chunk].store(c.get(), std::memory_order_release);
+		// push in reverse so that lower indices are handed out first
+		for (std::size_t i = chunk_size_v; i > 1; --i) { out_storage.free.push_back(u32(chunk * chunk_size_v + i - 1)); }
+		index = u32(chunk * chunk_size_v);
+	}
+	auto& slot = (*m_chunks[index / chunk_size_v].load(std::memory_order_relaxed))[index % chunk_size_v];
+	u32 gen = slot.generation.load(std::memory_order_relaxed) + 1;
+	if (gen == 0) { gen = 1; } // 0 is reserved for null handles
+	slot.generation.store(gen, std::memory_order_release);
+	slot.asset.store(asset, std::memory_order_release);
+	return {index, gen};
+}
+
+void AssetStore::release(Storage& out_storage, u32 index) noexcept {
+	auto& slot = (*m_chunks[index / chunk_size_v].load(std::memory_order_relaxed))[index % chunk_size_v];
+	slot.asset.store(nullptr, std::memory_order_release);
+	slot.generation.fetch_add(1, std::memory_order_acq_rel);
+	out_storage.free.push_back(index);
+}
+
+void AssetStore::retire(Storage& out_storage, Entry& out_entry) {
+	release(out_storage, out_entry.slot);
+	out_storage.retired.push_back(std::move(out_entry.asset));
+}
+
+auto AssetStore::resolve(u32 index, u32 gen) const noexcept -> Opt<Base> {
+	if (index / chunk_size_v >= max_chunks_v) { return {}; }
+	auto const chunk = m_chunks[index / chunk_size_v].load(std::memory_order_acquire);
+	if (!chunk) { return {}; }
+	auto const& slot = (*chunk)[index % chunk_size_v];
+	if (slot.generation.load(std::memory_order_acquire) != gen) { return {}; }
+	auto const ret = slot.asset.load(std::memory_order_acquire);
+	// re-validate: slot may have been released / reused between the two loads
+	if (!ret || slot.generation.load(std::memory_order_acquire) != gen) { return {}; }
+	return ret;
+}
+
+u32 AssetStore::generation(u32 index) const noexcept {
+	auto const chunk = m_chunks[index / chunk_size_v].load(std::memory_order_acquire);
+	return chunk ? (*chunk)[index % chunk_size_v].generation.load(std::memory_order_acquire) : 0;
+}
 } // namespace le
@@ -1,6 +1,9 @@
 #include <dumb_tasks/executor.hpp>
+#include <ktl/fixed_vector.hpp>
 #include <levk/core/build_version.hpp>
 #include <levk/core/io.hpp>
+#include <levk/core/io/async_reader.hpp>
+#include <levk/core/io/fs_media.hpp>
 #include <levk/core/io/zip_media.hpp>
 #include <levk/core/log_channel.hpp>
 #include <levk/core/services.hpp>
@@ -12,13 +15,16 @@
 #include <levk/engine/engine.hpp>
 #include <levk/engine/input/driver.hpp>
 #include <levk/engine/input/receiver.hpp>
+#include <levk/engine/render/culling.hpp>
 #include <levk/engine/render/frame.hpp>
 #include <levk/engine/render/layer.hpp>
 #include <levk/engine/utils/engine_config.hpp>
 #include <levk/engine/utils/engine_stats.hpp>
 #include <levk/engine/utils/error_handler.hpp>
+#include <levk/graphics/device/geometry_arena.hpp>
 #include <levk/graphics/material_data.hpp>
 #include <levk/graphics/mesh.hpp>
+#include <levk/graphics/meshlet.hpp>
 #include <levk/graphics/render/context.hpp>
 #include <levk/graphics/utils/utils.hpp>
 #include <levk/window/glue.hpp>
@@ -34,11 +40,6 @@ struct GFX {
 
 ktl::fixed_vector<graphics::PhysicalDevice, 8> s_devices;
 
-template <typename T>
-void profilerNext(T& out_profiler, Time_s total) {
-	if constexpr (!std::is_same_v<T, utils::NullProfileDB>) { out_profiler.next(total); }
-}
-
 std::optional<utils::EngineConfig> load(io::Path const& path) {
 	if (path.empty()) { return std::nullopt; }
 	if (auto json = dj::json(); json.load(path.generic_string())) { return io::fromJson<utils::EngineConfig>(json); }
@@ -85,13 +86,33 @@ std::optional<GFX> makeGFX(Engine::BootInfo const& info, window::Window const& w
 		return std::nullopt;
 	}
 	auto vr = vram.get();
-	graphics::RenderContext rc(vr, getShader(store), info.vsync, window.framebufferSize());
+	bytearray cache;
+	if (info.pipelineCache && io::is_regular_file(*info.pipelineCache)) {
+		if (auto bytes = io::FSMedia{}.bytes(*info.pipelineCache)) { cache = std::move(*bytes); }
+	}
+	graphics::RenderContext rc(vr, getShader(store), info.vsync, window.framebufferSize(), graphics::Buffering::eDouble, cache);
 	return std::optional<GFX>(GFX{std::move(device), std::move(vram), std::move(rc)});
 }
 
+void savePipelineCache(graphics::PipelineCache const& cache, io::Path const& path) {
+	auto const& stats = cache.stats();
+	logI("[Engine] Pipelines created: [{}] (cache hits: [{}], misses: [{}]) in [{:.2f}ms]", stats.created, stats.hits, stats.misses, stats.elapsed.count() * 1000.0f);
+	if (path.empty()) { return; }
+	if (auto const data = cache.data(); !data.empty() && io::FSMedia{}.write(path, data)) {
+		logI("[Engine] Pipeline cache saved to [{}] ({} bytes)", path.generic_string(), data.size());
+	}
+}
+
 struct Delegates {
 	ktl::delegate<> rendererChanged;
 };
+
+Engine::Profiler::CreateInfo profilerInfo() {
+	Engine::Profiler::CreateInfo ret;
+	// threads that record zones without naming themselves are the executor's workers
+	ret.unnamed = "dts::worker";
+	return ret;
+}
 } // namespace
 
 struct Engine::Impl {
@@ -101,6 +122,8 @@ struct Engine::Impl {
 	std::optional<GFX> gfx;
 	AssetStore store;
 	AssetMonitor monitor;
+	Profiler profiler;      // outlives threadPool: workers cache pointers to their rings
+	io::AsyncReader reader; // outlives threadPool: tasks may wait on reads
 	dts::thread_pool threadPool;
 	Executor executor = Executor(&threadPool);
 	Delegates delegates;
@@ -108,14 +131,16 @@ struct Engine::Impl {
 	input::ReceiverStore receivers;
 	input::Frame inputFrame;
 	graphics::ScreenView view;
-	Profiler profiler;
 	time::Point lastPoll{};
 	utils::EngineStats::Counter stats;
 	utils::ErrorHandler errorHandler;
 	Service service;
 	io::Path configPath;
+	io::Path pipelineCachePath;
 
-	Impl(std::optional<io::Path> logPath, LogChannel active) : io(logPath.value_or("levk-log.txt"), active), service(this) {}
+	Impl(std::optional<io::Path> logPath, LogChannel active) : io(logPath.value_or("levk-log.txt"), active), profiler(profilerInfo()), service(this) {
+		Profiler::nameThread("main");
+	}
 };
 
 BuildVersion Engine::buildVersion() noexcept { return g_buildVersion; }
@@ -139,6 +164,7 @@ bool Engine::boot(BootInfo info) {
 	if (auto gpuOverride = DataObject<CustomDevice>("gpuOverride")) { info.device.customDeviceName = gpuOverride->name; }
 	m_impl->gfx = makeGFX(info, *m_impl->win, m_impl->store);
 	if (!m_impl->gfx) { return false; }
+	m_impl->pipelineCachePath = info.pipelineCache.value_or(io::Path());
 	auto const& surface = m_impl->gfx->context.surface();
 	logI("[Engine] Swapchain image count: [{}] VSync: [{}]", surface.imageCount(), graphics::vSyncNames[surface.format().vsync]);
 	logD("[Engine] Device supports lazily allocated memory: {}", m_impl->gfx->device->physicalDevice().supportsLazyAllocation());
@@ -157,6 +183,7 @@ bool Engine::unboot() noexcept {
 		m_impl->monitor.clear();
 		Services::untrack<Context, VRAM, AssetStore, Profiler>();
 		m_impl->gfx->vram->shutdown();
+		savePipelineCache(m_impl->gfx->context.pipelineFactory().pipelineCache(), m_impl->pipelineCachePath);
 		m_impl->gfx.reset();
 		io::ZIPMedia::fsDeinit();
 		return true;
@@ -222,6 +249,7 @@ void Engine::addDefaultAssets() {
 		m_impl->store.add("render_layers/default", layer);
 		layer.flags = RenderFlag::eAlphaBlend;
 		layer.order = RenderOrder{100};
+		layer.camera = false;
 		m_impl->store.add("render_layers/ui", layer);
 		layer.flags = {};
 		layer.order = RenderOrder{-100};
@@ -265,14 +293,14 @@ std::optional<Engine> Engine::Builder::operator()() {
 	impl->errorHandler.deleteFile();
 	impl->configPath = std::move(m_configPath);
 	if (!impl->errorHandler.activeHandler()) { impl->errorHandler.setActive(); }
-	std::vector<bytearray> iconBytes;
+	std::vector<io::MappedBytes> iconBytes;
 	std::vector<graphics::utils::STBImg> icons;
 	iconBytes.reserve(m_iconURIs.size());
 	icons.reserve(m_iconURIs.size());
 	for (io::Path& uri : m_iconURIs) {
-		if (auto bytes = impl->store.media().bytes(std::move(uri))) {
+		if (auto bytes = impl->store.media().mapped(std::move(uri))) {
 			iconBytes.push_back(std::move(*bytes));
-			icons.push_back(graphics::utils::STBImg(iconBytes.back()));
+			icons.push_back(graphics::utils::STBImg(iconBytes.back().span()));
 		}
 	}
 	if (!icons.empty()) {
@@ -297,13 +325,17 @@ void Engine::Service::poll(Viewport const& view, Opt<input::EventParser> custom)
 	for (auto it = m_impl->receivers.rbegin(); it != m_impl->receivers.rend(); ++it) {
 		if ((*it)->block(m_impl->inputFrame.state)) { break; }
 	}
-	if (m_impl->inputFrame.state.focus == input::Focus::eGained) { m_impl->monitor.update(m_impl->store); }
-	profilerNext(m_impl->profiler, time::diffExchg(m_impl->lastPoll));
+	// native watches cost O(changes) per update: poll every frame; else only stat all files on regaining focus
+	if (m_impl->monitor.native() || m_impl->inputFrame.state.focus == input::Focus::eGained) { m_impl->monitor.update(m_impl->store); }
+	// assets unloaded / replaced over the last frame are no longer being resolved
+	m_impl->store.collect();
+	m_impl->profiler.next(time::diffExchg(m_impl->lastPoll));
 	m_impl->executor.rethrow();
 }
 
 void Engine::Service::pushReceiver(not_null<input::Receiver*> context) const { context->attach(m_impl->receivers); }
-Engine::Profiler::Profiler Engine::Service::profile(std::string_view name) const { return m_impl->profiler.profile(name); }
+Engine::Profiler::Scope Engine::Service::profile(std::string_view name) const { return m_impl->profiler.profile(name); }
+Engine::Profiler& Engine::Service::profiler() const noexcept { return m_impl->profiler; }
 window::Manager& Engine::Service::windowManager() const noexcept { return *m_impl->wm; }
 Engine::Device& Engine::Service::device() const noexcept { return *m_impl->gfx->device; }
 Engine::VRAM& Engine::Service::vram() const noexcept { return *m_impl->gfx->vram; }
@@ -318,6 +350,7 @@ AssetStore& Engine::Service::store() const noexcept { return m_impl->store; }
 AssetMonitor& Engine::Service::monitor() const noexcept { return m_impl->monitor; }
 input::Receiver::Store& Engine::Service::receiverStore() const noexcept { return m_impl->receivers; }
 dts::executor& Engine::Service::executor() const noexcept { return m_impl->executor; }
+io::AsyncReader& Engine::Service::reader() const noexcept { return m_impl->reader; }
 
 bool Engine::Service::closing() const { return window().closing(); }
 glm::vec2 Engine::Service::sceneSpace() const noexcept { return m_impl->inputFrame.space.display.swapchain; }
@@ -333,16 +366,49 @@ void Engine::Service::updateStats() const {
 	m_impl->stats.update();
 	m_impl->stats.stats.gfx.bytes.buffers = m_impl->gfx->vram->bytes(graphics::Memory::Type::eBuffer);
 	m_impl->stats.stats.gfx.bytes.images = m_impl->gfx->vram->bytes(graphics::Memory::Type::eImage);
+	m_impl->stats.stats.gfx.allocations.buffers = m_impl->gfx->vram->count(graphics::Memory::Type::eBuffer);
+	m_impl->stats.stats.gfx.allocations.images = m_impl->gfx->vram->count(graphics::Memory::Type::eImage);
+	m_impl->stats.stats.gfx.geometry = {};
+	for (auto const type : {graphics::GeometryArena::Type::eStatic, graphics::GeometryArena::Type::eDynamic}) {
+		auto const geometry = m_impl->gfx->vram->geometry().stats(type);
+		m_impl->stats.stats.gfx.geometry.bytes += geometry.used;
+		m_impl->stats.stats.gfx.geometry.pages += geometry.pages;
+		m_impl->stats.stats.gfx.geometry.allocations += geometry.allocations;
+	}
 	m_impl->stats.stats.gfx.drawCalls = graphics::CommandBuffer::s_drawCalls.load();
+	m_impl->stats.stats.gfx.setBinds = graphics::CommandBuffer::s_setBinds.load();
+	m_impl->stats.stats.gfx.bufferBinds = graphics::CommandBuffer::s_bufferBinds.load();
 	m_impl->stats.stats.gfx.triCount = graphics::MeshPrimitive::s_trisDrawn.load();
+	m_impl->stats.stats.gfx.objectsMade = graphics::Device::s_objectsMade.load();
+	m_impl->stats.stats.gfx.descriptors.updates = graphics::DescriptorWriter::s_updates.load();
+	m_impl->stats.stats.gfx.descriptors.writes = graphics::DescriptorWriter::s_writes.load();
+	m_impl->stats.stats.gfx.descriptors.skipped = graphics::DescriptorSet::s_skipped.load();
+	m_impl->stats.stats.gfx.objects.visible = Culling::s_visible.load();
+	m_impl->stats.stats.gfx.objects.culled = Culling::s_culled.load();
+	m_impl->stats.stats.gfx.clusters.visible = graphics::ClusterCuller::s_visible.load();
+	m_impl->stats.stats.gfx.clusters.culled = graphics::ClusterCuller::s_culled.load();
 	m_impl->stats.stats.gfx.extents.window = m_impl->win->windowSize();
 	if (m_impl->gfx) {
+		auto const& timer = m_impl->gfx->context.renderer().gpuTimer();
+		m_impl->stats.stats.gfx.gpu.supported = timer.supported();
+		m_impl->stats.stats.gfx.gpu.scopes.clear();
+		for (auto const& scope : timer.results()) { m_impl->stats.stats.gfx.gpu.scopes.push_back({scope.name, scope.dt}); }
 		m_impl->stats.stats.gfx.extents.swapchain = m_impl->gfx->context.surface().extent();
 		m_impl->stats.stats.gfx.extents.renderer =
 			Renderer::scaleExtent(m_impl->stats.stats.gfx.extents.swapchain, m_impl->gfx->context.renderer().renderScale());
 	}
 	graphics::CommandBuffer::s_drawCalls.store(0);
+	graphics::CommandBuffer::s_setBinds.store(0);
+	graphics::CommandBuffer::s_bufferBinds.store(0);
+	graphics::Device::s_objectsMade.store(0);
+	graphics::DescriptorWriter::s_updates.store(0);
+	graphics::DescriptorWriter::s_writes.store(0);
+	graphics::DescriptorSet::s_skipped.store(0);
 	graphics::MeshPrimitive::s_trisDrawn.store(0);
+	Culling::s_visible.store(0);
+	Culling::s_culled.store(0);
+	graphics::ClusterCuller::s_visible.store(0);
+	graphics::ClusterCuller::s_culled.store(0);
 }
 
 RenderFrame::RenderFrame(Engine::Service engine, graphics::RenderBegin const& rb) : m_engine(std::move(engine)) {
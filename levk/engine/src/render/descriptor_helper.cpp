@@ -54,6 +54,16 @@ DescriptorUpdater DescriptorMap::nextSet(DrawBindings const& bindings, u32 setNu
 	return {};
 }
 
+std::optional<u32> DescriptorMap::textureIndex(Opt<Texture const> tex, TextureFallback fb) const {
+	auto bindless = m_input->bindless();
+	if (!bindless) { return std::nullopt; }
+	if (tex) {
+		if (auto const ret = bindless->index(*tex)) { return ret; }
+	}
+	// defaults are only unavailable if the array is full
+	return bindless->index(*m_cache->defaults[fb]).value_or(graphics::BindlessTextures::fallback_v);
+}
+
 void DescriptorBinder::bind(DrawBindings const& indices) const {
 	for (auto const [di, set] : utils::enumerate(indices.indices)) {
 		if (di && m_input->contains((u32)set)) { m_cb.bindSet(m_layout, m_input->set((u32)set, *di)); }
@@ -12,15 +12,20 @@ PrimitiveProvider::PrimitiveProvider(Hash meshPrimitiveURI, Hash materialURI, Ha
 	: m_meshURI(meshPrimitiveURI), m_materialURI(materialURI), m_texRefsURI(textureRefsURI) {}
 
 bool PrimitiveProvider::addDrawPrimitives(AssetStore const& store, graphics::DrawList& out, glm::mat4 const& matrix) {
-	auto const mesh = store.find<graphics::MeshPrimitive>(m_meshURI);
-	auto const mat = store.find<graphics::BPMaterialData>(m_materialURI);
+	auto const mesh = store.find(m_meshURI, m_mesh);
+	auto const mat = store.find(m_materialURI, m_material);
 	if (!mesh || !mat) { return false; }
 	graphics::MaterialTextures matTex;
 	if (m_texRefsURI != Hash()) {
-		if (auto refs = store.find<TextureRefs>(m_texRefsURI); !refs || !refs->fill(store, matTex)) { return false; }
+		if (auto refs = store.find(m_texRefsURI, m_texRefs); !refs || !refs->fill(store, matTex)) { return false; }
 	}
 	DrawPrimitive dp{matTex, mesh, mat};
 	out.push(dp, matrix);
 	return true;
 }
+
+graphics::AABB PrimitiveProvider::bounds(AssetStore const& store) const {
+	if (auto const mesh = store.find(m_meshURI, m_mesh)) { return mesh->bounds(); }
+	return {};
+}
 } // namespace le
@@ -14,13 +14,14 @@
 namespace le {
 namespace {
 struct Parser : clap::option_parser {
-	enum Flag { eVSync };
+	enum Flag { eVSync, eStress };
 
 	Parser() {
 		static constexpr clap::option opts[] = {
 			{eVSync, "vSync", "override vSync", "VSYNC"},
 			{'v', "validation", "force Vulkan validation layers on/off", "VALIDN", clap::option::flag_optional},
 			{'t', "test", "quote test", "ARG"},
+			{eStress, "stress", "spawn COUNT instanced entities (demo)", "COUNT"},
 		};
 		spec.options = opts;
 		spec.doc_desc = "VSYNC\t: off, on, adaptive, triple-buffer/triple"
@@ -54,6 +55,12 @@ struct Parser : clap::option_parser {
 			std::cout << "arg: " << arg << '\n';
 			return true;
 		}
+		case eStress: {
+			s64 const count = utils::toS64(arg, -1);
+			if (count < 0) { return false; }
+			DataStore::set("stress", u32(count));
+			return true;
+		}
 		case no_end: return true;
 		default: return false;
 		}
@@ -40,6 +40,11 @@ struct Trigger {
 		cflags |= set;
 	}
 
+	///
+	/// \brief Obtain world space centre of trigger box (uses SceneNode hierarchy if attached)
+	///
+	glm::vec3 worldPosition(dens::registry const& registry, dens::entity entity, Transform const& transform) const;
+
 	static dens::entity_view<Transform, Trigger> attach(dens::entity entity, dens::registry& out_registry);
 };
 
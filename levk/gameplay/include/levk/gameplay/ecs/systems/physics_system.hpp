@@ -1,8 +1,11 @@
 #pragma once
 #include <levk/gameplay/ecs/systems/component_system.hpp>
+#include <levk/gameplay/physics/broadphase.hpp>
 
 namespace le {
 class PhysicsSystem : public ComponentSystem {
 	void update(dens::registry const& registry) override;
+
+	physics::Broadphase m_broadphase;
 };
 } // namespace le
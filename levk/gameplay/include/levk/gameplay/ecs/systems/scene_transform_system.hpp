@@ -0,0 +1,14 @@
+#pragma once
+#include <levk/gameplay/ecs/systems/component_system.hpp>
+#include <levk/gameplay/scene/scene_node.hpp>
+
+namespace le {
+class SceneTransformSystem : public ComponentSystem {
+	void update(dens::registry const& registry) override;
+
+	SceneGraph m_graph;
+
+  public:
+	static constexpr Order order_v = 1000;
+};
+} // namespace le
@@ -0,0 +1,83 @@
+#pragma once
+#include <dens/entity.hpp>
+#include <glm/vec3.hpp>
+#include <levk/gameplay/ecs/components/trigger.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace le::physics {
+///
+/// \brief Persistent sweep-and-prune broadphase over Trigger boxes
+///
+/// Proxies are kept sorted on the x axis across frames: coherent motion only needs an (almost linear) insertion sort.
+/// Channel masks are tested before any box overlap
+///
+class Broadphase {
+  public:
+	struct Box {
+		glm::vec3 lo{};
+		glm::vec3 hi{};
+
+		static constexpr Box make(glm::vec3 const& centre, glm::vec3 const& size) noexcept { return {centre - size * 0.5f, centre + size * 0.5f}; }
+		constexpr bool overlaps(Box const& rhs) const noexcept;
+	};
+
+	///
+	/// \brief Add / update entity's proxy for the current frame
+	///
+	void update(dens::entity entity, Trigger& trigger, Box const& box);
+	///
+	/// \brief Drop proxies not updated since last call and sort the rest
+	///
+	void prune();
+	///
+	/// \brief Invoke f(Trigger&, Trigger&) for each overlapping pair with common channels
+	///
+	template <typename F>
+	std::size_t pairs(F&& f) const;
+
+	std::size_t size() const noexcept { return m_order.size(); }
+
+  private:
+	struct Proxy {
+		Box box;
+		dens::entity entity;
+		Trigger* trigger{};
+		Trigger::CFlags cflags{};
+		u64 stamp{};
+	};
+
+	Proxy const& proxy(std::size_t index) const noexcept { return m_proxies[m_order[index]]; }
+
+	std::vector<Proxy> m_proxies;
+	std::vector<std::size_t> m_order;
+	std::vector<std::size_t> m_free;
+	std::unordered_map<dens::entity, std::size_t, dens::entity::hasher> m_slots;
+	u64 m_stamp = 1;
+	std::size_t m_added{};
+};
+
+// impl
+
+constexpr bool Broadphase::Box::overlaps(Box const& rhs) const noexcept {
+	return lo.x <= rhs.hi.x && rhs.lo.x <= hi.x && lo.y <= rhs.hi.y && rhs.lo.y <= hi.y && lo.z <= rhs.hi.z && rhs.lo.z <= hi.z;
+}
+
+template <typename F>
+std::size_t Broadphase::pairs(F&& f) const {
+	std::size_t ret{};
+	for (std::size_t i = 0; i < m_order.size(); ++i) {
+		auto const& lhs = proxy(i);
+		for (std::size_t j = i + 1; j < m_order.size(); ++j) {
+			auto const& rhs = proxy(j);
+			if (rhs.box.lo.x > lhs.box.hi.x) { break; }
+			if ((lhs.cflags & rhs.cflags) == 0) { continue; }
+			if (lhs.box.overlaps(rhs.box)) {
+				f(*lhs.trigger, *rhs.trigger);
+				++ret;
+			}
+		}
+	}
+	return ret;
+}
+} // namespace le::physics
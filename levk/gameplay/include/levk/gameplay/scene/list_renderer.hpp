@@ -2,12 +2,16 @@
 #include <levk/engine/render/descriptor_helper.hpp>
 #include <levk/engine/render/pipeline.hpp>
 #include <levk/engine/render/render_list.hpp>
+#include <levk/graphics/bounds.hpp>
 #include <levk/graphics/render/pipeline_factory.hpp>
 #include <levk/graphics/render/renderer.hpp>
 
 namespace dens {
 class registry;
 }
+namespace dts {
+class executor;
+}
 
 namespace le {
 class ListRenderer {
@@ -21,18 +25,30 @@ class ListRenderer {
 
 	static graphics::PipelineSpec pipelineSpec(RenderPipeline const& rp);
 
-	void render(RenderPass& out_rp, AssetStore const& store, RenderMap map);
+	///
+	/// \brief Write descriptor sets and record draw lists (in RenderOrder) into the render pass
+	/// \param executor If set, recording is split across the pass' secondary command buffers on worker threads
+	///
+	void render(RenderPass& out_rp, AssetStore const& store, RenderMap map, Opt<dts::executor> executor = {});
 
   protected:
 	virtual void writeSets(DescriptorMap map, graphics::DrawList const& list) = 0;
 
 	virtual void fill(RenderMap& out_map, AssetStore const& store, dens::registry const& registry) const;
-	virtual void draw(DescriptorBinder bind, graphics::DrawList const& list, graphics::CommandBuffer const& cb) const;
+	// May be called concurrently (on different command buffers) when rendering with an executor
+	virtual void draw(DescriptorBinder bind, RenderList const& list, graphics::DrawList::Range range, graphics::CommandBuffer const& cb) const;
 
 	vk::Rect2D m_scissor{};
+	// Set to enable frustum culling in fill() and of meshlets in draw() (of RenderLayer::camera lists only)
+	std::optional<graphics::Frustum> m_frustum{};
+	// Set (with m_frustum) to also cull back-facing meshlets: pipelines don't cull back faces, so only for closed meshes
+	std::optional<glm::vec3> m_eye{};
 };
 
 struct DrawListGen {
+	// Culls Mesh / PrimitiveProvider entities of RenderLayer::camera pipelines against frustum (if set), unless NoCull is attached
+	Opt<graphics::Frustum const> frustum{};
+
 	// Populates DrawGroup + [DynamicMesh, MeshProvider, gui::ViewStack]
 	void operator()(ListRenderer::RenderMap& map, AssetStore const& store, dens::registry const& registry) const;
 };
@@ -2,6 +2,7 @@
 #include <dens/entity.hpp>
 #include <levk/core/span.hpp>
 #include <levk/core/transform.hpp>
+#include <atomic>
 
 namespace dens {
 class registry;
@@ -20,13 +21,60 @@ class SceneNode {
 	dens::entity entity() const noexcept { return m_entity; }
 	Span<dens::entity const> nodes() const noexcept { return m_nodes; }
 
+	///
+	/// \brief Obtain cached world isotropy / matrices
+	///
+	/// Caches are refreshed by SceneGraph::update() (once per frame, in SceneRegistry::updateSystems());
+	/// changes since to a node's own / its parent's Transform (or parent) are picked up lazily on access (in O(1)),
+	/// changes to further ancestors only by the next update
+	///
 	bool isotropic(dens::registry const& registry) const;
 	glm::mat4 model(dens::registry const& registry) const;
 	glm::mat4 normalModel(dens::registry const& registry) const;
 
   private:
+	struct World {
+		glm::mat4 model = glm::mat4(1.0f);
+		u64 revision{};
+		u64 parentRevision{};
+		u32 localRevision{};
+		bool isotropic = true;
+	};
+
+	inline static auto s_revision = std::atomic<u64>(0);
+
+	World const& world(dens::registry const& registry) const;
+	bool stale(Transform const& transform, SceneNode const* parent) const noexcept;
+	void refresh(Transform const& transform, SceneNode const* parent) const noexcept;
+
 	std::vector<dens::entity> m_nodes;
 	dens::entity m_parent;
 	dens::entity m_entity;
+	mutable World m_world;
+
+	friend class SceneGraph;
+};
+
+///
+/// \brief Flat, topologically ordered (parents before children) world matrix update
+///
+/// Only nodes whose Transform or ancestors changed since the last update are recomputed
+///
+class SceneGraph {
+  public:
+	void update(dens::registry const& registry);
+
+	std::size_t size() const noexcept { return m_order.size(); }
+	std::size_t refreshed() const noexcept { return m_refreshed; }
+
+  private:
+	struct Entry {
+		SceneNode const* node{};
+		SceneNode const* parent{};
+		Transform const* transform{};
+	};
+
+	std::vector<Entry> m_order;
+	std::size_t m_refreshed{};
 };
 } // namespace le
@@ -2,6 +2,7 @@
 #include <levk/core/transform.hpp>
 #include <levk/engine/assets/asset_store.hpp>
 #include <levk/gameplay/ecs/components/trigger.hpp>
+#include <levk/gameplay/scene/scene_node.hpp>
 #include <levk/graphics/mesh_primitive.hpp>
 #include <levk/graphics/render/draw_list.hpp>
 
@@ -13,12 +14,17 @@ dens::entity_view<Transform, Trigger> Trigger::attach(dens::entity entity, dens:
 	return {entity, ret};
 }
 
+glm::vec3 Trigger::worldPosition(dens::registry const& registry, dens::entity entity, Transform const& transform) const {
+	if (auto node = registry.find<SceneNode>(entity); node && node->valid(registry)) { return Matrix::worldPosition(node->model(registry)) + offset; }
+	return transform.position() + offset;
+}
+
 bool Trigger::Debug::addDrawPrimitives(AssetStore const& store, dens::registry const& registry, graphics::DrawList& out) const {
 	if (auto mesh = store.find<graphics::MeshPrimitive>("wireframes/cube")) {
 		for (auto const& [e, c] : registry.view<Trigger, Transform>()) {
 			auto& [trigger, transform] = c;
 			static constexpr auto idty = glm::mat4(1.0f);
-			auto const matrix = glm::translate(idty, transform.position() + trigger.offset) * glm::scale(idty, trigger.scale);
+			auto const matrix = glm::translate(idty, trigger.worldPosition(registry, e, transform)) * glm::scale(idty, trigger.scale);
 			out.push(graphics::DrawPrimitive{{}, mesh, &trigger.data.material}, matrix);
 		}
 		return true;
@@ -0,0 +1,5 @@
+#include <levk/gameplay/ecs/systems/scene_transform_system.hpp>
+
+namespace le {
+void SceneTransformSystem::update(dens::registry const& registry) { m_graph.update(registry); }
+} // namespace le
@@ -41,6 +41,7 @@ struct FrameTime {
 	Span<f32 const> samples;
 	f32 average{};
 	u32 rate{};
+	Opt<utils::EngineStats::Gfx const> gfx{};
 };
 
 void drawLog(glm::vec2 fbSize, f32 logHeight, FrameTime ft) {
@@ -68,6 +69,20 @@ void drawLog(glm::vec2 fbSize, f32 logHeight, FrameTime ft) {
 			ImGui::PlotLines(title.data(), ft.samples.data(), (s32)ft.samples.size(), 0, overlay.data());
 			s(Style::eSeparator);
 		}
+		// GPU time
+		if (ft.gfx) {
+			if (!ft.gfx->gpu.supported) {
+				Text("GPU timestamps unsupported");
+			} else {
+				bool first = true;
+				for (auto const& scope : ft.gfx->gpu.scopes) {
+					if (!first) { ImGui::SameLine(); }
+					Text(CStr<64>("{}: {.3f}ms", scope.name.data(), time::cast<stdch::duration<f32, std::milli>>(scope.dt).count()).data());
+					first = false;
+				}
+			}
+			Styler s(Style::eSeparator);
+		}
 		// TWidgets
 		{
 			Text title("Log");
@@ -144,7 +159,7 @@ void LogStats::operator()([[maybe_unused]] glm::vec2 fbSize, [[maybe_unused]] f3
 		}
 		avg /= (f32)m_frameTime.fts.size();
 		u32 const rate = stats.rate == 0 ? (u32)stats.count : stats.rate;
-		drawLog(fbSize, height, {m_frameTime.samples, avg.count(), rate});
+		drawLog(fbSize, height, {m_frameTime.samples, avg.count(), rate, &eng->stats().gfx});
 	}
 #endif
 }
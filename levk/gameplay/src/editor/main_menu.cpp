@@ -2,6 +2,7 @@
 
 #if defined(LEVK_USE_IMGUI)
 #include <imgui.h>
+#include <levk/core/io/fs_media.hpp>
 #include <levk/core/services.hpp>
 #include <levk/core/utils/string.hpp>
 #include <levk/engine/assets/asset_store.hpp>
@@ -30,7 +31,6 @@ struct Panes {
 	void operator()();
 
 	void showStats() const;
-	template <typename T>
 	void showProfiler() const;
 };
 
@@ -47,8 +47,18 @@ void Panes::showStats() const {
 			auto const [isize, iunit] = utils::friendlySize(s.gfx.bytes.images);
 			t = Text(CStr<32>("Buffers: {.1f}{}", bsize, bunit.data()));
 			t = Text(CStr<32>("Images: {.1f}{}", isize, iunit.data()));
+			t = Text(CStr<48>("Allocations: {} buffers, {} images", s.gfx.allocations.buffers, s.gfx.allocations.images));
+			auto const [gsize, gunit] = utils::friendlySize(s.gfx.geometry.bytes);
+			t = Text(CStr<64>("Geometry: {.1f}{} ({} allocations, {} pages)", gsize, gunit.data(), s.gfx.geometry.allocations, s.gfx.geometry.pages));
 			t = Text(CStr<32>("Draw calls: {}", s.gfx.drawCalls));
+			t = Text(CStr<32>("Descriptor set binds: {}", s.gfx.setBinds));
+			t = Text(CStr<32>("Buffer binds: {}", s.gfx.bufferBinds));
 			t = Text(CStr<32>("Triangles: {}", s.gfx.triCount));
+			t = Text(CStr<32>("Vulkan objects made: {}", s.gfx.objectsMade));
+			t = Text(CStr<48>("Descriptor writes: {} ({} updates)", s.gfx.descriptors.writes, s.gfx.descriptors.updates));
+			t = Text(CStr<32>("Descriptor writes skipped: {}", s.gfx.descriptors.skipped));
+			t = Text(CStr<32>("Visible: {} Culled: {}", s.gfx.objects.visible, s.gfx.objects.culled));
+			t = Text(CStr<48>("Meshlets: {} visible, {} culled", s.gfx.clusters.visible, s.gfx.clusters.culled));
 			t = Text(CStr<32>("Window: {}x{}", s.gfx.extents.window.x, s.gfx.extents.window.y));
 			t = Text(CStr<32>("Swapchain: {}x{}", s.gfx.extents.swapchain.x, s.gfx.extents.swapchain.y));
 			t = Text(CStr<32>("Renderer: {}x{}", s.gfx.extents.renderer.x, s.gfx.extents.renderer.y));
@@ -61,30 +71,37 @@ void Panes::showStats() const {
 	}
 }
 
-template <typename T>
 void Panes::showProfiler() const {
-	if (auto profiler = Services::find<T>()) {
+	if (auto profiler = Services::find<Engine::Profiler>()) {
 		if (auto p = Pane("Profiler", {600.0f, 400.0f}, {300.0f, 300.0f}, &g_panes.flag(Flag::eProfiler))) {
-			auto const& record = profiler->m_record.back();
+			bool enabled = profiler->enabled();
+			if (ImGui::Checkbox("Enabled", &enabled)) { profiler->enable(enabled); }
+			ImGui::SameLine();
+			if (ImGui::Button("Save Trace")) {
+				static constexpr std::string_view path = "levk-trace.json";
+				if (io::FSMedia{}.write(path, profiler->chromeTrace(), false)) { logI("[Profiler] Chrome trace saved to [{}]", path); }
+			}
+			Styler st(Style::eSeparator);
+			auto const record = profiler->lastFrame();
 			Time_s const total = record.total;
+			static constexpr f32 indent = 10.0f;
 			f32 maxLength{};
-			for (auto const& profile : record.entries) { maxLength = std::max(maxLength, ImGui::CalcTextSize(profile.name.data()).x); }
 			for (auto const& profile : record.entries) {
+				maxLength = std::max(maxLength, ImGui::CalcTextSize(profile.name.data(), profile.name.data() + profile.name.size()).x + f32(profile.depth) * indent);
+			}
+			for (auto const& profile : record.entries) {
+				ImGui::SetCursorPosX(ImGui::GetCursorPosX() + f32(profile.depth) * indent);
 				Text t(profile.name);
 				ImGui::SameLine(maxLength + 20.0f);
 				ImGui::ProgressBar(profile.dt / total, ImVec2{-1.0f, 0.0f}, CStr<16>("{1.2f}ms", profile.dt.count() * 1000.0f).data());
 			}
 		}
-		profiler->m_record.clear();
 	}
 }
 
-template <>
-MU void Panes::showProfiler<utils::NullProfileDB>() const {}
-
 void Panes::operator()() {
 	if (flag(Flag::eStats)) { showStats(); }
-	if (flag(Flag::eProfiler)) { showProfiler<Engine::Profiler>(); }
+	if (flag(Flag::eProfiler)) { showProfiler(); }
 	if (flag(Flag::eAssetIndex)) {
 		if (auto p = Pane("Asset Index", {425.0f, 250.0f}, {50.0f, 100.0f}, &flag(Flag::eAssetIndex))) {
 			if (auto store = Services::find<AssetStore>()) { AssetIndex::list(*store); }
@@ -0,0 +1,48 @@
+#include <levk/gameplay/physics/broadphase.hpp>
+#include <algorithm>
+
+namespace le::physics {
+void Broadphase::update(dens::entity entity, Trigger& trigger, Box const& box) {
+	auto [it, added] = m_slots.emplace(entity, m_proxies.size());
+	if (added) {
+		if (!m_free.empty()) {
+			it->second = m_free.back();
+			m_free.pop_back();
+		} else {
+			m_proxies.emplace_back();
+		}
+		m_order.push_back(it->second);
+		++m_added;
+	}
+	auto& proxy = m_proxies[it->second];
+	proxy = {box, entity, &trigger, trigger.cflags, m_stamp};
+}
+
+void Broadphase::prune() {
+	auto const stale = [this](std::size_t slot) { return m_proxies[slot].stamp != m_stamp; };
+	for (std::size_t const slot : m_order) {
+		if (stale(slot)) {
+			m_slots.erase(m_proxies[slot].entity);
+			m_proxies[slot].trigger = {};
+			m_free.push_back(slot);
+		}
+	}
+	std::erase_if(m_order, stale);
+	auto const lo = [this](std::size_t slot) { return m_proxies[slot].box.lo.x; };
+	if (m_added * 8 > m_order.size()) {
+		// bulk insertion: full sort
+		std::sort(m_order.begin(), m_order.end(), [lo](std::size_t a, std::size_t b) { return lo(a) < lo(b); });
+	} else {
+		// coherent motion: insertion sort is near linear
+		for (std::size_t i = 1; i < m_order.size(); ++i) {
+			auto const slot = m_order[i];
+			auto const x = lo(slot);
+			std::size_t j = i;
+			for (; j > 0 && lo(m_order[j - 1]) > x; --j) { m_order[j] = m_order[j - 1]; }
+			m_order[j] = slot;
+		}
+	}
+	m_added = {};
+	++m_stamp;
+}
+} // namespace le::physics
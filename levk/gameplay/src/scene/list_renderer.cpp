@@ -1,6 +1,9 @@
 #include <dens/registry.hpp>
+#include <dumb_tasks/executor.hpp>
+#include <levk/core/log_channel.hpp>
 #include <levk/engine/assets/asset_provider.hpp>
 #include <levk/engine/assets/asset_store.hpp>
+#include <levk/engine/render/culling.hpp>
 #include <levk/engine/render/no_draw.hpp>
 #include <levk/engine/render/primitive_provider.hpp>
 #include <levk/gameplay/ecs/components/trigger.hpp>
@@ -10,8 +13,11 @@
 #include <levk/gameplay/scene/scene_node.hpp>
 #include <levk/graphics/mesh.hpp>
 #include <levk/graphics/mesh_primitive.hpp>
+#include <levk/graphics/meshlet.hpp>
+#include <levk/graphics/render/gpu_timer.hpp>
 #include <levk/graphics/skybox.hpp>
 #include <levk/graphics/utils/utils.hpp>
+#include <atomic>
 #include <unordered_set>
 
 namespace le {
@@ -21,12 +27,57 @@ constexpr EnumArray<Topology, vk::PrimitiveTopology> topologies = {
 	vk::PrimitiveTopology::ePointList,	  vk::PrimitiveTopology::eLineList,		vk::PrimitiveTopology::eLineStrip,
 	vk::PrimitiveTopology::eTriangleList, vk::PrimitiveTopology::eTriangleList, vk::PrimitiveTopology::eTriangleFan,
 };
+
+// below this many draw objects, worker dispatch costs more than it saves
+constexpr std::size_t parallel_threshold_v = 256;
+
+// cluster culling costs meshlets x instances and draws the union for every instance: past a few instances
+// the union is close to the whole mesh, so such objects rely on per object culling only
+constexpr std::size_t cluster_cull_instances_v = 4;
+
+// warn about vertex format mismatches once (draw() runs every frame, possibly on several threads)
+std::atomic<bool> g_formatWarned{};
+
+struct Batch {
+	RenderList const* list{};
+	std::size_t first{};
+	std::size_t count{};
+};
+
+using Batches = std::vector<Batch>;
+
+// split sorted lists into (up to) count contiguous, roughly equal sized chunks; splitting lists across chunks if required
+std::vector<Batches> partition(Span<RenderList const> lists, std::size_t count) {
+	std::size_t total{};
+	for (auto const& list : lists) { total += list.drawList.size(); }
+	std::vector<Batches> ret(1);
+	if (count <= 1U || total < parallel_threshold_v) {
+		for (auto const& list : lists) { ret.back().push_back({&list, 0U, list.drawList.size()}); }
+		return ret;
+	}
+	std::size_t const target = (total + count - 1) / count;
+	std::size_t filled{};
+	for (auto const& list : lists) {
+		std::size_t first{};
+		do {
+			if (filled == target && ret.size() < count) {
+				ret.emplace_back();
+				filled = 0U;
+			}
+			std::size_t const take = ret.size() < count ? std::min(list.drawList.size() - first, target - filled) : list.drawList.size() - first;
+			ret.back().push_back({&list, first, take});
+			first += take;
+			filled += take;
+		} while (first < list.drawList.size());
+	}
+	return ret;
+}
 } // namespace
 
 graphics::PipelineSpec ListRenderer::pipelineSpec(RenderPipeline const& rp) {
 	graphics::ShaderSpec ss;
 	for (auto const& uri : rp.shaderURIs) { ss.moduleURIs.push_back(uri); }
-	graphics::PipelineSpec ret = graphics::PipelineFactory::spec(ss, rp.layer.flags);
+	graphics::PipelineSpec ret = graphics::PipelineFactory::spec(ss, rp.layer.flags, graphics::vertexInput(rp.vertexFormat));
 	ret.fixedState.lineWidth = rp.layer.lineWidth;
 	ret.fixedState.mode = polygonModes[rp.layer.mode];
 	ret.fixedState.topology = topologies[rp.layer.topology];
@@ -34,48 +85,111 @@ graphics::PipelineSpec ListRenderer::pipelineSpec(RenderPipeline const& rp) {
 }
 
 void ListRenderer::fill(RenderMap& out_map, AssetStore const& store, dens::registry const& registry) const {
-	DrawListGen{}(out_map, store, registry);
+	DrawListGen{m_frustum ? &*m_frustum : nullptr}(out_map, store, registry);
 	DebugDrawListGen{}(out_map, store, registry);
 }
 
-void ListRenderer::draw(DescriptorBinder binder, graphics::DrawList const& list, graphics::CommandBuffer const& cb) const {
+void ListRenderer::draw(DescriptorBinder binder, RenderList const& list, graphics::DrawList::Range range, graphics::CommandBuffer const& cb) const {
 	// binder.bindNext(0);
-	binder.bind(list.m_bindings);
-	for (auto const& drawObj : list) {
+	binder.bind(list.drawList.m_bindings);
+	// vertex / index buffers are shared between primitives (GeometryArena pages)
+	graphics::MeshPrimitive::Bindings bound;
+	std::optional<graphics::ClusterCuller> culler;
+	if (m_frustum && list.camera) { culler = graphics::ClusterCuller{*m_frustum, m_eye}; }
+	std::vector<graphics::ClusterCuller::Range> ranges;
+	for (auto const& drawObj : range) {
 		// binder.bindNext(1);
 		binder.bind(drawObj.bindings);
 		cb.setScissor(drawObj.scissor ? *drawObj.scissor : m_scissor);
 		for (auto const& obj : drawObj.objs) {
 			auto const& primitive = obj.primitive;
+			if (primitive.primitive->vertexFormat() != list.vertexFormat) {
+				// pipeline would read vertices with the wrong layout
+				if (!g_formatWarned.exchange(true)) {
+					logW(LC_LibUser, "[ListRenderer] Skipping primitive(s) whose vertex format does not match pipeline [{}]", list.name);
+				}
+				continue;
+			}
 			// binder.bindNext(2, 3);
 			binder.bind(obj.bindings);
-			primitive.primitive->draw(cb);
+			ranges.clear();
+			auto const meshlets = primitive.primitive->meshlets();
+			if (culler && !meshlets.empty() && drawObj.matrices.size() <= cluster_cull_instances_v) {
+				// every instance is drawn with the union of meshlets visible to any of them
+				if ((*culler)(meshlets, drawObj.matrices, ranges) == 0U) { continue; }
+			}
+			if (list.vertexFormat != graphics::VertexFormat::eStandard) {
+				// packed vertex shaders dequantize positions
+				cb.push<graphics::Dequantize>(binder.pipelineLayout(), vk::ShaderStageFlagBits::eVertex, 0U, primitive.primitive->dequantize());
+			}
+			primitive.primitive->draw(cb, drawObj.instances(), 0, &bound, ranges);
 		}
 	}
 }
 
-void ListRenderer::render(RenderPass& out_rp, AssetStore const& store, RenderMap map) {
+void ListRenderer::render(RenderPass& out_rp, AssetStore const& store, RenderMap map, Opt<dts::executor> executor) {
 	EXPECT(!out_rp.commandBuffers().empty());
 	if (out_rp.commandBuffers().empty()) { return; }
 	std::vector<RenderList> drawLists;
 	drawLists.reserve(map.size());
 	for (auto& [rpipe, list] : map) {
 		if (auto pipe = out_rp.pipelineFactory().get(pipelineSpec(rpipe), out_rp.renderPass()); pipe.valid()) {
-			drawLists.push_back(RenderList{pipe, std::move(list), rpipe.layer.order});
+			// opaque depth tested draws are order independent (blended ones are not): collapse identical primitives into instanced draws
+			if (rpipe.layer.flags.test(RenderFlag::eDepthTest) && !rpipe.layer.flags.test(RenderFlag::eAlphaBlend)) { list.batch(); }
+			std::string_view const name = rpipe.shaderURIs.empty() ? std::string_view("(none)") : rpipe.shaderURIs.front();
+			drawLists.push_back(RenderList{pipe, std::move(list), rpipe.layer.order, name, rpipe.vertexFormat, rpipe.layer.camera});
 		}
 	}
 	auto const cache = DescriptorHelper::Cache::make(&store);
 	std::unordered_set<graphics::ShaderInput*> pipes;
-	auto const& cb = out_rp.commandBuffers().front();
 	m_scissor = out_rp.scissor();
-	cb.setViewportScissor(out_rp.viewport(), out_rp.scissor());
-	std::sort(drawLists.begin(), drawLists.end());
+	std::stable_sort(drawLists.begin(), drawLists.end());
+	// descriptor sets are written serially: recording below only reads them
+	// batch all descriptor writes into one update, submitted before any command buffer binds the sets
+	auto& writer = out_rp.pipelineFactory().descriptorWriter();
+	writer.defer();
 	for (auto const& list : drawLists) {
 		EXPECT(list.pipeline.valid());
-		cb.m_cb.bindPipeline(vk::PipelineBindPoint::eGraphics, list.pipeline.pipeline);
 		pipes.insert(list.pipeline.shaderInput);
 		writeSets(DescriptorMap(&cache, list.pipeline.shaderInput), list.drawList);
-		draw(DescriptorBinder(list.pipeline.layout, list.pipeline.shaderInput, cb), list.drawList, cb);
+	}
+	writer.flush();
+	if (auto bindless = out_rp.pipelineFactory().bindless()) { bindless->update(); }
+	// one GPU timer scope per list: started before its first batch, stopped after its last (possibly on different command buffers)
+	std::vector<std::optional<graphics::GpuTimer::Query>> queries(drawLists.size());
+	if (auto timer = out_rp.gpuTimer()) {
+		for (std::size_t i = 0; i < drawLists.size(); ++i) {
+			auto const& list = drawLists[i];
+			queries[i] = timer->scope(std::string(list.name) + " [" + std::to_string(s64(list.order)) + "]");
+		}
+	}
+	auto const cbs = out_rp.commandBuffers();
+	auto const record = [this, &out_rp, &queries, &drawLists](Batches const& batches, graphics::CommandBuffer const& cb) {
+		auto const timer = out_rp.gpuTimer();
+		cb.setViewportScissor(out_rp.viewport(), out_rp.scissor());
+		for (auto const& batch : batches) {
+			auto const& list = *batch.list;
+			auto const& query = queries[std::size_t(batch.list - drawLists.data())];
+			if (query && batch.first == 0U) { timer->start(cb, *query); }
+			cb.m_cb.bindPipeline(vk::PipelineBindPoint::eGraphics, list.pipeline.pipeline);
+			// shared texture array: bound once per list instead of per-object texture sets
+			if (auto bindless = list.pipeline.shaderInput->bindless()) { bindless->bind(cb, list.pipeline.layout, list.pipeline.shaderInput->bindlessSet()); }
+			auto const range = list.drawList.range(batch.first, batch.count);
+			draw(DescriptorBinder(list.pipeline.layout, list.pipeline.shaderInput, cb), list, range, cb);
+			if (query && batch.first + batch.count == list.drawList.size()) { timer->stop(cb, *query); }
+		}
+	};
+	// chunks are recorded into secondary command buffers in order, preserving RenderOrder on execution
+	auto const chunks = partition(drawLists, executor ? cbs.size() : 1U);
+	if (chunks.size() > 1U) {
+		std::vector<dts::future_t> futures;
+		futures.reserve(chunks.size());
+		for (std::size_t i = 0; i < chunks.size(); ++i) {
+			futures.push_back(executor->enqueue([&record, &chunks, &cbs, i] { record(chunks[i], cbs[i]); }));
+		}
+		for (auto& future : futures) { future.wait(); }
+	} else {
+		record(chunks.front(), cbs.front());
 	}
 	for (auto pipe : pipes) { pipe->swap(); }
 }
@@ -101,17 +215,36 @@ void DrawListGen::operator()(ListRenderer::RenderMap& map, AssetStore const& sto
 		}
 		return glm::mat4(1.0f);
 	};
+	u32 visible{}, culled{};
+	// the frustum is the camera's: lists drawn with any other projection (UI / ortho) are not culled
+	auto inFrustum = [&](dens::entity e, RenderPipeline const& rp, graphics::AABB const& bounds, glm::mat4 const& mat) {
+		if (!frustum || !rp.layer.camera || !bounds.valid() || registry.attached<NoCull>(e)) { return true; }
+		if (frustum->intersects(bounds.transform(mat))) {
+			++visible;
+			return true;
+		}
+		++culled;
+		return false;
+	};
 	for (auto [e, c] : registry.view<RenderPipeProvider, AssetProvider<graphics::Skybox>>(exclude)) {
 		auto& [rp, skybox] = c;
 		if (auto s = skybox.find(store); s && rp.ready(store)) { map[rp.get(store)].add(*s, modelMat(e)); }
 	}
 	for (auto [e, c] : registry.view<RenderPipeProvider, AssetProvider<graphics::Mesh>>(exclude)) {
 		auto& [rp, mesh] = c;
-		if (auto m = mesh.find(store); m && rp.ready(store)) { map[rp.get(store)].add(*m, modelMat(e)); }
+		if (auto m = mesh.find(store); m && rp.ready(store)) {
+			auto const& pipe = rp.get(store);
+			auto const mat = modelMat(e);
+			if (inFrustum(e, pipe, m->bounds(), mat)) { map[pipe].add(*m, mat); }
+		}
 	}
 	for (auto [e, c] : registry.view<RenderPipeProvider, PrimitiveProvider>(exclude)) {
 		auto& [rp, prim] = c;
-		if (rp.ready(store)) { prim.addDrawPrimitives(store, map[rp.get(store)], modelMat(e)); }
+		if (rp.ready(store)) {
+			auto const& pipe = rp.get(store);
+			auto const mat = modelMat(e);
+			if (inFrustum(e, pipe, prim.bounds(store), mat)) { prim.addDrawPrimitives(store, map[pipe], mat); }
+		}
 	}
 	for (auto [e, c] : registry.view<RenderPipeProvider, PrimitiveGenerator>(exclude)) {
 		auto& [rp, prim] = c;
@@ -123,6 +256,8 @@ void DrawListGen::operator()(ListRenderer::RenderMap& map, AssetStore const& sto
 			for (auto const& view : stack.views()) { addNodes(map, *r, *view); }
 		}
 	}
+	Culling::s_visible.fetch_add(visible);
+	Culling::s_culled.fetch_add(culled);
 }
 
 void DebugDrawListGen::operator()(ListRenderer::RenderMap& map, AssetStore const& store, dens::registry const& registry) const {
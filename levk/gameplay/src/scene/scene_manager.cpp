@@ -38,7 +38,7 @@ void SceneManager::render(graphics::RGBA clear) {
 			auto const view = ShaderSceneView::make(m_active->scene->camera(), m_engine.sceneSpace());
 			m_active->scene->render(frame.renderPass(), view);
 		}
-		if constexpr (levk_editor) { editor::render(frame.renderPass().commandBuffers().front()); }
+		if constexpr (levk_editor) { editor::render(frame.renderPass().commandBuffers().back()); }
 		m_shaderBufferMap.swap();
 	}
 }
@@ -28,6 +28,7 @@ bool SceneNode::parent(dens::registry const& registry, dens::entity parent) {
 	if (auto node = registry.find<SceneNode>(parent)) {
 		if (auto p = registry.find<SceneNode>(m_parent)) { std::erase(p->m_nodes, m_entity); }
 		m_parent = parent;
+		m_world.revision = {};
 		if (!find(node->m_nodes, m_entity)) { node->m_nodes.push_back(m_entity); }
 		return true;
 	}
@@ -45,19 +46,68 @@ void SceneNode::clean(dens::registry const& registry) {
 	}
 }
 
-bool SceneNode::isotropic(dens::registry const& registry) const {
-	if (!transform(registry).isotropic()) { return false; }
-	if (auto e = registry.find<SceneNode>(m_parent)) { return e->isotropic(registry); }
-	return true;
+bool SceneNode::isotropic(dens::registry const& registry) const { return world(registry).isotropic; }
+
+glm::mat4 SceneNode::model(dens::registry const& registry) const { return world(registry).model; }
+
+glm::mat4 SceneNode::normalModel(dens::registry const& registry) const {
+	auto const& w = world(registry);
+	return w.isotropic ? w.model : glm::mat4(glm::inverse(glm::transpose(glm::mat3(w.model))));
 }
 
-glm::mat4 SceneNode::model(dens::registry const& registry) const {
-	auto ret = transform(registry).matrix();
-	if (auto node = registry.find<SceneNode>(m_parent)) { return node->model(registry) * ret; }
-	return ret;
+SceneNode::World const& SceneNode::world(dens::registry const& registry) const {
+	auto const& t = transform(registry);
+	auto const p = parent(registry);
+	// O(1): only the direct parent is brought up to date (against its parent's cached world); SceneGraph::update() covers the rest
+	if (p && p->valid(registry)) {
+		auto const& pt = p->transform(registry);
+		auto const pp = p->parent(registry);
+		if (p->stale(pt, pp)) { p->refresh(pt, pp); }
+	}
+	if (stale(t, p)) { refresh(t, p); }
+	return m_world;
 }
 
-glm::mat4 SceneNode::normalModel(dens::registry const& registry) const {
-	return isotropic(registry) ? transform(registry).matrix() : glm::mat4(glm::inverse(glm::transpose(glm::mat3(transform(registry).matrix()))));
+bool SceneNode::stale(Transform const& transform, SceneNode const* parent) const noexcept {
+	if (m_world.revision == 0 || m_world.localRevision != transform.revision()) { return true; }
+	return m_world.parentRevision != (parent ? parent->m_world.revision : 0);
+}
+
+void SceneNode::refresh(Transform const& transform, SceneNode const* parent) const noexcept {
+	m_world.model = transform.matrix();
+	m_world.isotropic = transform.isotropic();
+	m_world.parentRevision = {};
+	if (parent) {
+		m_world.model = parent->m_world.model * m_world.model;
+		m_world.isotropic &= parent->m_world.isotropic;
+		m_world.parentRevision = parent->m_world.revision;
+	}
+	m_world.localRevision = transform.revision();
+	// globally unique: a node refreshed after being reset (reparented) never reuses a revision its children cached
+	m_world.revision = ++s_revision;
+}
+
+void SceneGraph::update(dens::registry const& registry) {
+	m_order.clear();
+	m_refreshed = {};
+	// roots first, then breadth-first: every parent precedes all its children
+	for (auto [e, c] : registry.view<SceneNode, Transform>()) {
+		auto& [node, transform] = c;
+		if (!node.parent(registry)) { m_order.push_back({&node, nullptr, &transform}); }
+	}
+	for (std::size_t i = 0; i < m_order.size(); ++i) {
+		auto const entry = m_order[i];
+		for (dens::entity const child : entry.node->m_nodes) {
+			if (auto node = registry.find<SceneNode>(child)) {
+				if (auto transform = registry.find<Transform>(child)) { m_order.push_back({node, entry.node, transform}); }
+			}
+		}
+	}
+	for (auto const& entry : m_order) {
+		if (entry.node->stale(*entry.transform, entry.parent)) {
+			entry.node->refresh(*entry.transform, entry.parent);
+			++m_refreshed;
+		}
+	}
 }
 } // namespace le
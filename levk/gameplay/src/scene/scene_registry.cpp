@@ -4,6 +4,7 @@
 #include <levk/gameplay/ecs/systems/gui_system.hpp>
 #include <levk/gameplay/ecs/systems/physics_system.hpp>
 #include <levk/gameplay/ecs/systems/scene_clean_system.hpp>
+#include <levk/gameplay/ecs/systems/scene_transform_system.hpp>
 #include <levk/gameplay/ecs/systems/spring_arm_system.hpp>
 #include <levk/gameplay/ecs/systems/system_groups.hpp>
 #include <levk/gameplay/editor/scene_ref.hpp>
@@ -31,6 +32,7 @@ SceneRegistry::SceneRegistry() {
 	tick.attach<SpringArmSystem>();
 	tick.attach<GuiSystem>(GuiSystem::order_v);
 	tick.attach<SceneCleanSystem>(SceneCleanSystem::order_v);
+	tick.attach<SceneTransformSystem>(SceneTransformSystem::order_v);
 }
 
 void SceneRegistry::attach(dens::entity entity, RenderPipeProvider&& rp) { m_registry.attach<RenderPipeProvider>(entity, std::move(rp)); }
@@ -1,5 +1,6 @@
 target_sources(${PROJECT_NAME} PRIVATE
   include/levk/graphics/basis.hpp
+  include/levk/graphics/bounds.hpp
   include/levk/graphics/buffer.hpp
   include/levk/graphics/command_buffer.hpp
   include/levk/graphics/common.hpp
@@ -12,6 +13,9 @@ target_sources(${PROJECT_NAME} PRIVATE
   include/levk/graphics/mesh_primitive.hpp
   include/levk/graphics/draw_primitive.hpp
   include/levk/graphics/mesh.hpp
+  include/levk/graphics/mesh_optimizer.hpp
+  include/levk/graphics/meshlet.hpp
+  include/levk/graphics/packed_vertex.hpp
   include/levk/graphics/qtype.hpp
   include/levk/graphics/rgba.hpp
   include/levk/graphics/screen_rect.hpp
@@ -21,8 +25,12 @@ target_sources(${PROJECT_NAME} PRIVATE
 
   include/levk/graphics/device/defer_queue.hpp
   include/levk/graphics/device/device.hpp
+  include/levk/graphics/device/free_list_allocator.hpp
+  include/levk/graphics/device/geometry_arena.hpp
   include/levk/graphics/device/physical_device.hpp
   include/levk/graphics/device/queue.hpp
+  include/levk/graphics/device/linear_allocator.hpp
+  include/levk/graphics/device/ring_allocator.hpp
   include/levk/graphics/device/transfer.hpp
   include/levk/graphics/device/vram.hpp
 
@@ -35,10 +43,13 @@ target_sources(${PROJECT_NAME} PRIVATE
   include/levk/graphics/gltf/data_builder.hpp
   include/levk/graphics/gltf/gltf.hpp
 
+  include/levk/graphics/render/bindless_textures.hpp
   include/levk/graphics/render/buffering.hpp
   include/levk/graphics/render/camera.hpp
   include/levk/graphics/render/context.hpp
   include/levk/graphics/render/descriptor_set.hpp
+  include/levk/graphics/render/gpu_timer.hpp
+  include/levk/graphics/render/pipeline_cache.hpp
   include/levk/graphics/render/pipeline_factory.hpp
   include/levk/graphics/render/pipeline_flags.hpp
   include/levk/graphics/render/pipeline_spec.hpp
@@ -46,6 +57,8 @@ target_sources(${PROJECT_NAME} PRIVATE
   include/levk/graphics/render/render_pass.hpp
   include/levk/graphics/render/renderer.hpp
   include/levk/graphics/render/shader_buffer.hpp
+  include/levk/graphics/render/descriptor_writer.hpp
+  include/levk/graphics/render/uniform_allocator.hpp
   include/levk/graphics/render/surface.hpp
   include/levk/graphics/render/framebuffer.hpp
   include/levk/graphics/render/vertex_input.hpp
@@ -0,0 +1,46 @@
+#pragma once
+#include <glm/mat4x4.hpp>
+#include <levk/core/span.hpp>
+#include <levk/core/std_types.hpp>
+#include <limits>
+
+namespace le::graphics {
+///
+/// \brief Axis aligned bounding box (default constructed instances are empty / invalid)
+///
+struct AABB {
+	glm::vec3 min = glm::vec3(std::numeric_limits<f32>::max());
+	glm::vec3 max = glm::vec3(std::numeric_limits<f32>::lowest());
+
+	static AABB make(Span<glm::vec3 const> points) noexcept;
+
+	bool valid() const noexcept { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+	glm::vec3 centre() const noexcept { return (min + max) * 0.5f; }
+	glm::vec3 halfExtent() const noexcept { return (max - min) * 0.5f; }
+
+	AABB& add(glm::vec3 const& point) noexcept;
+	AABB& add(AABB const& rhs) noexcept;
+	///
+	/// \brief Obtain (conservative) bounds of this box transformed by mat
+	///
+	AABB transform(glm::mat4 const& mat) const noexcept;
+};
+
+///
+/// \brief Six planes (normals pointing inwards) of a view-projection volume
+///
+struct Frustum {
+	enum Plane { eLeft, eRight, eBottom, eTop, eNear, eFar, eCOUNT_ };
+
+	glm::vec4 planes[eCOUNT_]{};
+
+	///
+	/// \brief Extract planes from a view-projection matrix (expects [0, 1] clip depth)
+	///
+	static Frustum make(glm::mat4 const& viewProj) noexcept;
+
+	bool contains(glm::vec3 const& point) const noexcept;
+	bool intersects(AABB const& aabb) const noexcept;
+	bool intersects(glm::vec3 const& centre, f32 radius) const noexcept;
+};
+} // namespace le::graphics
@@ -29,6 +29,10 @@ class CommandBuffer {
 	};
 
 	inline static auto s_drawCalls = std::atomic<u32>(0);
+	// descriptor sets bound since last reset
+	inline static auto s_setBinds = std::atomic<u32>(0);
+	// vertex / index buffers bound since last reset
+	inline static auto s_bufferBinds = std::atomic<u32>(0);
 
 	static std::vector<CommandBuffer> make(not_null<Device*> device, vk::CommandPool pool, u32 count);
 	static void make(std::vector<CommandBuffer>& out, not_null<Device*> device, vk::CommandPool pool, u32 count);
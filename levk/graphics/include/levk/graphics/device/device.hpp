@@ -9,6 +9,7 @@
 #include <levk/graphics/device/physical_device.hpp>
 #include <levk/graphics/device/queue.hpp>
 #include <levk/graphics/utils/layout_state.hpp>
+#include <atomic>
 
 namespace le::graphics {
 enum class Validation { eOn, eOff };
@@ -31,8 +32,22 @@ class Device final : public Pinned {
 		"VK_KHR_portability_subset"
 #endif
 	};
+	// enabled if supported by the selected physical device; query via supports()
+	static constexpr std::string_view optionalExtensions[] = {
+		VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME,
+	};
+	// enabled (along with their dependencies) if supported, for bindless descriptor arrays; query via descriptorIndexing()
+	static constexpr std::string_view descriptorIndexingExtensions[] = {
+		VK_KHR_MAINTENANCE3_EXTENSION_NAME,
+		VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+	};
 	static constexpr stdch::nanoseconds fenceWait = 1s;
 
+	// Vulkan objects (incl. swapchain views, VMA buffers / images) created since last reset
+	inline static auto s_objectsMade = std::atomic<u32>(0);
+	// bumped whenever a handle descriptors can reference (buffer, image view, sampler) is destroyed (its value may then be reused)
+	inline static auto s_destroyEpoch = std::atomic<u64>(0);
+
 	struct CreateInfo;
 
 	static ktl::fixed_vector<PhysicalDevice, 8> physicalDevices();
@@ -44,6 +59,7 @@ class Device final : public Pinned {
 
 	void waitIdle();
 	bool valid(vk::SurfaceKHR surface) const;
+	bool supports(std::string_view extension) const noexcept;
 
 	vk::UniqueSurfaceKHR makeSurface() const;
 	vk::Semaphore makeSemaphore() const;
@@ -60,10 +76,10 @@ class Device final : public Pinned {
 	vk::ImageView makeImageView(vk::Image image, vk::Format format, vk::ImageAspectFlags aspectFlags = vk::ImageAspectFlagBits::eColor,
 								vk::ImageViewType type = vk::ImageViewType::e2D, u32 mipLevels = 1U) const;
 
-	vk::PipelineCache makePipelineCache() const;
+	vk::PipelineCache makePipelineCache(Span<std::byte const> initialData = {}) const;
 	vk::PipelineLayout makePipelineLayout(vAP<vk::PushConstantRange> pushConstants, vAP<vk::DescriptorSetLayout> setLayouts) const;
 
-	vk::DescriptorSetLayout makeDescriptorSetLayout(vAP<vk::DescriptorSetLayoutBinding> bindings) const;
+	vk::DescriptorSetLayout makeDescriptorSetLayout(vAP<vk::DescriptorSetLayoutBinding> bindings, vAP<vk::DescriptorBindingFlagsEXT> flags = {}) const;
 	vk::DescriptorPool makeDescriptorPool(Span<vk::DescriptorPoolSize const> poolSizes, u32 maxSets = 1) const;
 	std::vector<vk::DescriptorSet> allocateDescriptorSets(vk::DescriptorPool pool, vAP<vk::DescriptorSetLayout> layouts, u32 setCount = 1) const;
 
@@ -92,6 +108,11 @@ class Device final : public Pinned {
 	vk::Device device() const noexcept { return *m_device; }
 	TPair<f32> lineWidthLimit() const noexcept { return {m_metadata.limits.lineWidthRange[0], m_metadata.limits.lineWidthRange[1]}; }
 	f32 maxAnisotropy() const noexcept { return m_metadata.limits.maxSamplerAnisotropy; }
+	vk::PhysicalDeviceLimits const& limits() const noexcept { return m_metadata.limits; }
+	///
+	/// \brief Whether partially bound, dynamically indexed sampler arrays are enabled (VK_EXT_descriptor_indexing)
+	///
+	bool descriptorIndexing() const noexcept { return m_metadata.descriptorIndexing; }
 
 	LayoutState m_layouts;
 
@@ -112,6 +133,7 @@ class Device final : public Pinned {
 		std::vector<char const*> extensions;
 		ktl::fixed_vector<PhysicalDevice, 8> available;
 		vk::PhysicalDeviceLimits limits;
+		bool descriptorIndexing{};
 	} m_metadata;
 
 	friend class FontFace;
@@ -178,6 +200,7 @@ template <typename T, typename... Ts>
 void Device::destroy(T& out_t, Ts&... out_ts) {
 	if (!default_v(out_t)) {
 		m_device->destroy(out_t);
+		if constexpr (std::is_same_v<T, vk::ImageView> || std::is_same_v<T, vk::Sampler> || std::is_same_v<T, vk::BufferView>) { s_destroyEpoch.fetch_add(1); }
 		out_t = T();
 	}
 	if constexpr (sizeof...(Ts) > 0) { destroy(out_ts...); }
@@ -0,0 +1,40 @@
+#pragma once
+#include <levk/core/std_types.hpp>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+namespace le::graphics {
+///
+/// \brief First fit offset allocator over a fixed capacity range (not thread safe)
+///
+/// Blocks may be released in any order; freed neighbours are coalesced immediately.
+///
+class FreeListAllocator {
+  public:
+	using size_type = u64;
+
+	explicit FreeListAllocator(size_type capacity = 0);
+
+	std::optional<size_type> allocate(size_type size, size_type alignment = 1);
+	bool release(size_type offset);
+
+	size_type capacity() const noexcept { return m_capacity; }
+	size_type used() const noexcept { return m_used; }
+	std::size_t count() const noexcept { return m_live.size(); }
+	///
+	/// \brief Number of disjoint free ranges
+	///
+	std::size_t fragments() const noexcept { return m_free.size(); }
+	bool empty() const noexcept { return m_live.empty(); }
+
+  private:
+	void free(size_type begin, size_type end);
+
+	// begin => end
+	std::map<size_type, size_type> m_free;
+	std::unordered_map<size_type, size_type> m_live;
+	size_type m_capacity{};
+	size_type m_used{};
+};
+} // namespace le::graphics
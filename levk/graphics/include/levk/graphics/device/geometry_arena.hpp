@@ -0,0 +1,70 @@
+#pragma once
+#include <ktl/async/kmutex.hpp>
+#include <levk/graphics/device/free_list_allocator.hpp>
+#include <levk/graphics/device/vram.hpp>
+#include <memory>
+
+namespace le::graphics {
+///
+/// \brief Suballocates vertex and index data of many meshes from a few large shared buffers (thread safe)
+///
+/// Static geometry lives in device local pages (staged), dynamic geometry in persistently mapped host visible pages
+/// (written directly). Draws from the same page share buffer bindings and address their data via base vertex / first index.
+/// Allocations larger than a page get a dedicated one; pages other than the first of each type are destroyed once empty.
+/// Released regions are reused immediately: callers must defer release until in-flight frames no longer use them.
+///
+class GeometryArena {
+  public:
+	enum class Type { eStatic, eDynamic };
+
+	struct Alloc {
+		Opt<Buffer> buffer{};
+		vk::DeviceSize offset{};
+		vk::DeviceSize size{};
+		Type type{};
+
+		explicit operator bool() const noexcept { return buffer != nullptr; }
+	};
+
+	struct Stats {
+		u32 pages{};
+		u32 allocations{};
+		u64 used{};
+		u64 capacity{};
+	};
+
+	static constexpr vk::DeviceSize page_size_v = 4 * 1024 * 1024;
+
+	GeometryArena(not_null<VRAM*> vram, vk::DeviceSize pageSize = page_size_v) noexcept : m_vram(vram), m_pageSize(pageSize) {}
+
+	///
+	/// \brief Allocate size bytes at a multiple of alignment (eg vertex stride: offset / stride is then a valid base vertex)
+	///
+	Alloc allocate(Type type, vk::DeviceSize size, vk::DeviceSize alignment);
+	void release(Alloc const& alloc);
+	///
+	/// \brief Copy data into a dynamic allocation
+	///
+	bool write(Alloc const& alloc, void const* data, vk::DeviceSize size) const;
+	///
+	/// \brief Stage data into a static allocation
+	///
+	[[nodiscard]] VRAM::Future stage(Alloc const& alloc, void const* data, vk::DeviceSize size) const;
+
+	Stats stats(Type type) const;
+
+  private:
+	struct Page {
+		Buffer buffer;
+		FreeListAllocator allocator;
+	};
+	using Pages = std::vector<std::unique_ptr<Page>>;
+	struct Storage {
+		EnumArray<Type, Pages, 2> pages;
+	};
+
+	ktl::strict_tmutex<Storage> m_storage;
+	not_null<VRAM*> m_vram;
+	vk::DeviceSize m_pageSize;
+};
+} // namespace le::graphics
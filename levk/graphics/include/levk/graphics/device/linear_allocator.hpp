@@ -0,0 +1,39 @@
+#pragma once
+#include <levk/core/std_types.hpp>
+#include <optional>
+
+namespace le::graphics {
+///
+/// \brief Bump offset allocator over a fixed number of equally sized frame regions (not thread safe)
+///
+/// Each frame allocates linearly from its own region; next() moves to the following region and discards all of its
+/// previous allocations. Offsets are absolute (region base included).
+///
+class LinearAllocator {
+  public:
+	using size_type = u64;
+
+	explicit LinearAllocator(size_type capacity = 0, u32 frames = 1) noexcept : m_capacity(capacity), m_frames(frames > 0U ? frames : 1U) {}
+
+	std::optional<size_type> allocate(size_type size, size_type alignment = 1);
+	void next() noexcept;
+
+	///
+	/// \brief Capacity of each frame region
+	///
+	size_type capacity() const noexcept { return m_capacity; }
+	size_type size() const noexcept { return m_capacity * m_frames; }
+	u32 frames() const noexcept { return m_frames; }
+	u32 frame() const noexcept { return m_frame; }
+	///
+	/// \brief Bytes allocated in the current frame (including alignment padding)
+	///
+	size_type used() const noexcept { return m_head; }
+
+  private:
+	size_type m_capacity{};
+	size_type m_head{};
+	u32 m_frames{};
+	u32 m_frame{};
+};
+} // namespace le::graphics
@@ -0,0 +1,39 @@
+#pragma once
+#include <levk/core/std_types.hpp>
+#include <deque>
+#include <optional>
+
+namespace le::graphics {
+///
+/// \brief Offset allocator over a fixed capacity ring (not thread safe)
+///
+/// Blocks may be released in any order; space is reclaimed once all older blocks have been released.
+///
+class RingAllocator {
+  public:
+	using size_type = u64;
+
+	explicit RingAllocator(size_type capacity = 0) noexcept : m_capacity(capacity) {}
+
+	std::optional<size_type> allocate(size_type size, size_type alignment = 1);
+	void release(size_type offset);
+
+	size_type capacity() const noexcept { return m_capacity; }
+	///
+	/// \brief Bytes between oldest and newest live blocks (including alignment / wrap padding)
+	///
+	size_type used() const noexcept;
+	bool empty() const noexcept { return m_blocks.empty(); }
+
+  private:
+	struct Block {
+		size_type begin{};
+		size_type end{};
+		bool released{};
+	};
+
+	std::deque<Block> m_blocks;
+	size_type m_capacity{};
+	size_type m_head{};
+};
+} // namespace le::graphics
@@ -7,7 +7,8 @@
 #include <levk/core/span.hpp>
 #include <levk/core/time.hpp>
 #include <levk/graphics/buffer.hpp>
-#include <list>
+#include <levk/graphics/device/ring_allocator.hpp>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -20,11 +21,26 @@ class Transfer final : public Pinned {
 	using Promise = ktl::kpromise<notify_t>;
 	using Future = ktl::kfuture<notify_t>;
 
-	struct MemRange final {
-		vk::DeviceSize size = 2;
-		std::size_t count = 1;
+	///
+	/// \brief Mapped staging memory for one upload
+	///
+	/// Suballocated from the persistently mapped ring buffer; uses a dedicated buffer if the ring is too small / full.
+	///
+	struct Staging final {
+		std::optional<Buffer> buffer;
+		vk::Buffer src;
+		vk::DeviceSize offset{};
+		vk::DeviceSize size{};
+		std::byte* data{};
+
+		Span<std::byte> span() const noexcept { return Span<std::byte>(data, (std::size_t)size); }
+	};
+
+	struct Stats {
+		u64 bytes{};
+		u64 ring{};
+		u64 dedicated{};
 	};
-	static constexpr std::array<MemRange, 1> defaultReserve = {{{8_MB, 4}}};
 
 	struct CreateInfo;
 
@@ -32,12 +48,17 @@ class Transfer final : public Pinned {
 	~Transfer();
 
 	Buffer makeStagingBuffer(vk::DeviceSize size) const;
+	///
+	/// \brief Obtain staging memory to write into (thread safe); ring memory is reclaimed once its batch's fence is signalled
+	///
+	Staging allocate(vk::DeviceSize size);
 	std::size_t update();
 	bool polling() const noexcept { return m_sync.poll.active(); }
+	Stats stats() const noexcept { return {m_stats.bytes.load(), m_stats.ring.load(), m_stats.dedicated.load()}; }
 
   private:
 	struct Stage final {
-		std::optional<Buffer> buffer;
+		Staging staging;
 		vk::CommandBuffer command;
 	};
 
@@ -50,11 +71,11 @@ class Transfer final : public Pinned {
 	};
 
 	Stage newStage(vk::DeviceSize bufferSize);
+	Stage newStage(Staging&& staging);
 	void addStage(Stage&& stage, Promise&& promise);
 
 	void scavenge(Stage&& stage, vk::Fence fence);
 	vk::Fence nextFence();
-	std::optional<Buffer> nextBuffer(vk::DeviceSize size);
 	vk::CommandBuffer nextCommand();
 	void stopPolling();
 	void stopTransfer();
@@ -63,8 +84,19 @@ class Transfer final : public Pinned {
 		vk::CommandPool pool;
 		std::vector<vk::CommandBuffer> commands;
 		std::vector<vk::Fence> fences;
-		std::list<Buffer> buffers;
 	} m_data;
+	struct {
+		std::optional<Buffer> buffer;
+		std::byte* data{};
+		RingAllocator allocator;
+		vk::DeviceSize alignment = 16;
+		std::mutex mutex;
+	} m_ring;
+	struct {
+		std::atomic<u64> bytes{};
+		std::atomic<u64> ring{};
+		std::atomic<u64> dedicated{};
+	} m_stats;
 	struct {
 		ktl::kthread staging;
 		ktl::kthread poll;
@@ -81,7 +113,7 @@ class Transfer final : public Pinned {
 };
 
 struct Transfer::CreateInfo {
-	Span<MemRange const> reserve = defaultReserve;
+	vk::DeviceSize ringSize = 32_MB;
 	std::optional<Time_ms> autoPollRate = 3ms;
 };
 } // namespace le::graphics
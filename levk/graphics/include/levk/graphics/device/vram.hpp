@@ -5,11 +5,13 @@
 #include <levk/graphics/image.hpp>
 #include <levk/graphics/image_ref.hpp>
 #include <levk/graphics/utils/command_pool.hpp>
+#include <memory>
 #include <unordered_map>
 
 namespace le::graphics {
 class Device;
 class CommandBuffer;
+class GeometryArena;
 namespace utils {
 class STBImg;
 }
@@ -47,7 +49,13 @@ class VRAM final : public Memory {
 	template <typename T>
 	Buffer makeBO(T const& t, vk::BufferUsageFlags usage);
 
-	[[nodiscard]] Future stage(Buffer& out_deviceBuffer, void const* pData, vk::DeviceSize size = 0);
+	[[nodiscard]] Future stage(Buffer& out_deviceBuffer, void const* pData, vk::DeviceSize size = 0, vk::DeviceSize dstOffset = 0);
+	///
+	/// \brief Stage size bytes into out_deviceBuffer (at dstOffset) by invoking write on mapped staging memory (on the calling thread)
+	///
+	template <typename F>
+		requires(std::is_invocable_v<F, Span<std::byte>>)
+	[[nodiscard]] Future stage(Buffer& out_deviceBuffer, vk::DeviceSize size, F&& write, vk::DeviceSize dstOffset = 0);
 	[[nodiscard]] Future clearAsync(ImageRef const& image, LayerMip const& layerMip, Colour colour, std::optional<vk::ImageLayout> dst = std::nullopt);
 	[[nodiscard]] Future copyAsync(Span<BmpView const> bitmaps, Image const& out_dst, LayoutPair fromTo, vk::ImageAspectFlags aspects = vIAFB::eColor);
 	[[nodiscard]] Future copyAsync(Images&& imgs, Image const& out_dst, LayoutPair fromTo, vk::ImageAspectFlags aspects = vIAFB::eColor);
@@ -57,6 +65,11 @@ class VRAM final : public Memory {
 	bool makeMipMaps(CommandBuffer cb, Image const& out_dst, LayoutPair fromTo, vk::ImageAspectFlags aspects = vIAFB::eColor) const;
 
 	CommandPool& commandPool();
+	///
+	/// \brief Shared vertex / index buffers backing MeshPrimitives
+	///
+	GeometryArena& geometry() const noexcept { return *m_geometry; }
+	Transfer::Stats transferStats() const noexcept { return m_transfer.stats(); }
 
 	template <typename Cont>
 	void wait(Cont const& futures) const;
@@ -73,7 +86,11 @@ class VRAM final : public Memory {
 	template <typename T>
 	struct ImageCopier;
 
+	Future stageCopy(Buffer& out_deviceBuffer, Transfer::Staging&& staging, vk::DeviceSize dstOffset);
+
 	Transfer m_transfer;
+	// destroyed before m_transfer (which flushes deferred deletions)
+	std::unique_ptr<GeometryArena> m_geometry;
 	ktl::strict_tmutex<std::unordered_map<std::thread::id, CommandPool>> m_commandPools;
 	struct {
 		vk::PipelineStageFlags stages = vk::PipelineStageFlagBits::eBottomOfPipe | vk::PipelineStageFlagBits::eVertexShader;
@@ -90,6 +107,15 @@ Buffer VRAM::makeBO(T const& t, vk::BufferUsageFlags usage) {
 	return ret;
 }
 
+template <typename F>
+	requires(std::is_invocable_v<F, Span<std::byte>>)
+VRAM::Future VRAM::stage(Buffer& out_deviceBuffer, vk::DeviceSize size, F&& write, vk::DeviceSize dstOffset) {
+	if (size == 0) { size = out_deviceBuffer.writeSize() - dstOffset; }
+	auto staging = m_transfer.allocate(size);
+	if (staging.data) { write(staging.span()); }
+	return stageCopy(out_deviceBuffer, std::move(staging), dstOffset);
+}
+
 template <typename Cont>
 void VRAM::wait(Cont const& futures) const {
 	for (Future const& f : futures) { f.wait(); }
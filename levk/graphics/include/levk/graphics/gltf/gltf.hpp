@@ -18,6 +18,7 @@ enum class error_t {
 	invalid_accessor,
 	out_of_range,
 	unsupported,
+	invalid_glb,
 	none,
 };
 
@@ -40,6 +41,8 @@ struct buffer_t {
 	std::string name{};
 
 	std::vector<std::byte> storage{};
+	// points into storage, or into borrowed GLB bytes
+	buffer_span bytes{};
 };
 
 struct buffer_view_t {
@@ -144,9 +147,9 @@ struct material_t {
 	std::string name;
 
 	pbr_metallic_roughness_t pbr_metallic_roughness{};
-	normal_texture_info_t normal_texture{};
-	occlusion_texture_info_t occlusion_texture{};
-	texture_info_t emissive_texture{};
+	std::optional<normal_texture_info_t> normal_texture{};
+	std::optional<occlusion_texture_info_t> occlusion_texture{};
+	std::optional<texture_info_t> emissive_texture{};
 	tvec3<float> emissive_factor{};
 	alpha_mode_t alpha_mode = alpha_mode_t::opaque;
 	float alpha_cutoff = 0.5f;
@@ -191,6 +194,8 @@ struct node_t {
 	tvec3<float> translation{};
 	tvec3<float> scale = scale_v;
 	quat_t rotation = orient_v;
+	// column major local transform: replaces translation / rotation / scale when present
+	std::optional<tmat4<float>> matrix{};
 	std::optional<std::size_t> mesh_index{};
 	std::optional<std::size_t> camera_index{};
 	std::vector<std::size_t> child_indices{};
@@ -222,6 +227,8 @@ struct asset_t {
 	std::size_t scene{};
 
 	static result_t parse(char const* json_uri, get_bytes_t get_bytes = {});
+	// borrow_bin: reference the GLB BIN chunk in place instead of copying it (bytes must outlive the asset)
+	static result_t parse_bytes(std::span<std::byte const> bytes, get_bytes_t const& get_bytes, bool borrow_bin = false);
 };
 
 struct result_t {
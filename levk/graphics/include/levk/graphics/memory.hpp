@@ -43,7 +43,7 @@ class Memory : public Pinned {
 
 	static vk::SharingMode sharingMode(Queues const& queues, QCaps const caps);
 	static void clear(vk::CommandBuffer cb, ImageRef const& image, LayerMip const& layerMip, vk::ImageLayout layout, Colour colour);
-	static void copy(vk::CommandBuffer cb, vk::Buffer src, vk::Buffer dst, vk::DeviceSize size);
+	static void copy(vk::CommandBuffer cb, vk::Buffer src, vk::Buffer dst, vk::DeviceSize size, vk::DeviceSize srcOffset = 0, vk::DeviceSize dstOffset = 0);
 	static void copy(vk::CommandBuffer cb, vk::Buffer src, vk::Image dst, vAP<vk::BufferImageCopy> regions, ImgMeta const& meta);
 	static void copy(vk::CommandBuffer cb, TPair<vk::Image> images, vk::Extent3D extent, vk::ImageAspectFlags aspects);
 	static void blit(vk::CommandBuffer cb, TPair<vk::Image> images, TPair<vk::Extent3D> extents, TPair<vk::ImageAspectFlags> aspects, BlitFilter filter);
@@ -58,12 +58,17 @@ class Memory : public Pinned {
 	void unmap(Resource& out_resource) const;
 
 	u64 bytes(Type type) const noexcept { return m_allocations[type].load(); }
+	///
+	/// \brief Number of live allocations of type
+	///
+	u64 count(Type type) const noexcept { return m_counts[type].load(); }
 
 	not_null<Device*> m_device;
 
   protected:
 	VmaAllocator m_allocator;
 	mutable EnumArray<Type, std::atomic<u64>, 2> m_allocations;
+	mutable EnumArray<Type, std::atomic<u64>, 2> m_counts;
 };
 
 struct Memory::AllocInfo {
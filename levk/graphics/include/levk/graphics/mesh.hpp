@@ -1,4 +1,5 @@
 #pragma once
+#include <dumb_tasks/executor.hpp>
 #include <ktl/either.hpp>
 #include <levk/graphics/draw_primitive.hpp>
 #include <levk/graphics/material_data.hpp>
@@ -23,9 +24,26 @@ struct Mesh {
 	std::vector<Material> materials{};
 	std::vector<MeshPrimitive> primitives{};
 
-	static std::optional<Mesh> fromObjMtl(io::Path const& jsonURI, io::Media const& media, not_null<VRAM*> vram, vk::Sampler sampler = {});
+	///
+	/// \param format Vertex layout primitives are converted to
+	///
+	static std::optional<Mesh> fromObjMtl(io::Path const& jsonURI, io::Media const& media, not_null<VRAM*> vram, vk::Sampler sampler = {},
+										  VertexFormat format = {});
+	///
+	/// \brief Load a glTF 2.0 (.gltf / .glb) asset; node transforms of the default scene are baked into primitives
+	/// \param executor If set, images are decoded in parallel on it
+	/// \param format Vertex layout primitives are converted to
+	///
+	static std::optional<Mesh> fromGltf(io::Path const& uri, io::Media const& media, not_null<VRAM*> vram, Opt<dts::executor> executor = {},
+										VertexFormat format = {});
+	///
+	/// \brief Load a glTF 2.0 asset from bytes already read from uri (external buffers / images are read from media)
+	///
+	static std::optional<Mesh> fromGltf(io::Path const& uri, Span<std::byte const> bytes, io::Media const& media, not_null<VRAM*> vram,
+										Opt<dts::executor> executor = {}, VertexFormat format = {});
 
 	Opt<Texture const> texture(std::optional<std::size_t> idx) const noexcept { return idx && *idx < textures.size() ? &textures[*idx] : nullptr; }
+	AABB bounds() const noexcept;
 };
 
 template <>
@@ -0,0 +1,64 @@
+#pragma once
+#include <levk/graphics/geometry.hpp>
+#include <vector>
+
+namespace le::graphics {
+///
+/// \brief Import time reordering of indexed triangle lists for the GPU (Tipsify: Sander, Nehab, Barczak 2007)
+///
+/// Triangles are reordered for the post-transform vertex cache; the resulting clusters (split where reordering hits a dead end)
+/// are sorted by outward facing to reduce overdraw; finally vertices are renumbered in first use order for fetch locality.
+/// Triangles and their winding are preserved: only their order and vertex numbering change.
+///
+struct MeshOptimizer {
+	struct Stats {
+		// average cache miss ratio: vertex shader invocations per triangle (0.5 - 3.0)
+		f32 acmr{};
+		// average transform to vertex ratio: vertex shader invocations per referenced vertex (1.0 is optimal)
+		f32 atvr{};
+	};
+
+	static constexpr u32 cache_size_v = 16;
+
+	u32 cacheSize = cache_size_v;
+	bool overdraw = true;
+
+	///
+	/// \brief Simulate a FIFO post-transform cache of cacheSize entries over indices
+	///
+	static Stats analyze(Span<u32 const> indices, u32 vertexCount, u32 cacheSize = cache_size_v);
+
+	///
+	/// \brief Reorder triangles for vertex cache locality
+	/// \returns Cluster start offsets (in triangles), first is always 0
+	///
+	std::vector<u32> reorderTriangles(std::vector<u32>& out_indices, u32 vertexCount) const;
+	///
+	/// \brief Sort clusters (from reorderTriangles) so that outward facing ones are drawn first
+	///
+	void reorderClusters(std::vector<u32>& out_indices, Span<glm::vec3 const> positions, Span<u32 const> clusters) const;
+	///
+	/// \brief Renumber vertices in order of first use (unreferenced vertices go last)
+	/// \returns New index of each vertex
+	///
+	std::vector<u32> remapVertices(std::vector<u32>& out_indices, u32 vertexCount) const;
+
+	template <VertType V>
+	void operator()(Geom<V>& out_geom) const;
+};
+
+// impl
+
+template <VertType V>
+void MeshOptimizer::operator()(Geom<V>& out_geom) const {
+	auto const vertexCount = u32(out_geom.vertices.size());
+	auto const clusters = reorderTriangles(out_geom.indices, vertexCount);
+	if (clusters.empty()) { return; }
+	if (overdraw) { reorderClusters(out_geom.indices, out_geom.positions(), clusters); }
+	auto const remap = remapVertices(out_geom.indices, vertexCount);
+	if (remap.empty()) { return; }
+	std::vector<Vert<V>> vertices(out_geom.vertices.size());
+	for (std::size_t i = 0; i < remap.size(); ++i) { vertices[remap[i]] = out_geom.vertices[i]; }
+	out_geom.vertices = std::move(vertices);
+}
+} // namespace le::graphics
@@ -1,20 +1,35 @@
 #pragma once
 #include <levk/core/ref.hpp>
+#include <levk/graphics/bounds.hpp>
+#include <levk/graphics/device/geometry_arena.hpp>
 #include <levk/graphics/device/vram.hpp>
 #include <levk/graphics/geometry.hpp>
+#include <levk/graphics/meshlet.hpp>
+#include <levk/graphics/packed_vertex.hpp>
 
 namespace le::graphics {
 class Device;
 class CommandBuffer;
 struct BlinnPhongMaterial;
 
+///
+/// \brief Vertex (and optional index) data suballocated from VRAM's GeometryArena
+///
 class MeshPrimitive {
   public:
 	enum class Type { eStatic, eDynamic };
 	struct Data {
 		Ref<Buffer const> buffer;
+		vk::DeviceSize offset{};
 		u32 count = 0;
 	};
+	///
+	/// \brief Currently bound vertex / index buffers: pass the same instance to consecutive draws to skip redundant binds
+	///
+	struct Bindings {
+		vk::Buffer vbo;
+		vk::Buffer ibo;
+	};
 
 	inline static auto s_trisDrawn = std::atomic<u32>(0);
 
@@ -27,7 +42,14 @@ class MeshPrimitive {
 	void construct(Span<T const> vertices, Span<u32 const> indices);
 	template <VertType V>
 	void construct(Geom<V> const& geom);
-	bool draw(CommandBuffer cb, u32 instances = 1, u32 first = 0) const;
+	///
+	/// \brief Convert geometry to format before uploading
+	///
+	void construct(Geometry const& geom, VertexFormat format);
+	///
+	/// \brief Draw all indices, or only ranges (from ClusterCuller) if passed
+	///
+	bool draw(CommandBuffer cb, u32 instances = 1, u32 first = 0, Opt<Bindings> out_bound = {}, Span<ClusterCuller::Range const> ranges = {}) const;
 
 	bool valid() const noexcept;
 	bool busy() const;
@@ -37,6 +59,20 @@ class MeshPrimitive {
 	Data vbo() const noexcept;
 	Data ibo() const noexcept;
 	Type type() const noexcept;
+	VertexFormat vertexFormat() const noexcept { return m_format; }
+	///
+	/// \brief Push constant for packed vertex formats' shaders
+	///
+	Dequantize const& dequantize() const noexcept { return m_dequantize; }
+	///
+	/// \brief Local space bounds of vertex positions (computed on construct)
+	///
+	AABB const& bounds() const noexcept { return m_bounds; }
+	///
+	/// \brief Clusters of the index buffer for per-meshlet culling (cleared on construct)
+	///
+	Span<Meshlet const> meshlets() const noexcept { return m_meshlets; }
+	void meshlets(std::vector<Meshlet> meshlets) noexcept { m_meshlets = std::move(meshlets); }
 
 	bool hasIndices() const noexcept;
 
@@ -45,17 +81,23 @@ class MeshPrimitive {
 
   private:
 	struct Storage {
-		std::optional<Buffer> buffer;
+		GeometryArena::Alloc alloc;
 		u32 count = 0;
 		VRAM::Future transfer;
 	};
 
 	static void exchg(MeshPrimitive& lhs, MeshPrimitive& rhs) noexcept;
-	Storage construct(vk::BufferUsageFlags usage, void* pData, std::size_t size) const;
+	Storage construct(void const* pData, std::size_t size, std::size_t alignment) const;
+	void release();
 
 	Storage m_vbo;
 	Storage m_ibo;
+	AABB m_bounds;
+	std::vector<Meshlet> m_meshlets;
 	u32 m_triCount = 0;
+	u32 m_stride = 0;
+	VertexFormat m_format{};
+	Dequantize m_dequantize;
 
 	Type m_type;
 };
@@ -65,12 +107,23 @@ class MeshPrimitive {
 template <typename T>
 void MeshPrimitive::construct(Span<T const> vertices, Span<u32 const> indices) {
 	wait();
-	if (vertices.empty()) {
-		m_vbo = {};
-		m_ibo = {};
-	} else {
-		m_vbo = construct(vk::BufferUsageFlagBits::eVertexBuffer, (void*)vertices.data(), vertices.size() * sizeof(T));
-		if (!indices.empty()) { m_ibo = construct(vk::BufferUsageFlagBits::eIndexBuffer, (void*)indices.data(), indices.size() * sizeof(u32)); }
+	release();
+	m_bounds = {};
+	m_meshlets.clear();
+	m_format = {};
+	m_dequantize = {};
+	if (!vertices.empty()) {
+		for (auto const& vertex : vertices) {
+			if constexpr (std::is_same_v<T, glm::vec3>) {
+				m_bounds.add(vertex);
+			} else if constexpr (!std::is_same_v<T, QuantizedVertex>) {
+				m_bounds.add(vertex.position);
+			}
+		}
+		// stride alignment makes offset / stride a valid base vertex
+		m_vbo = construct(vertices.data(), vertices.size() * sizeof(T), sizeof(T));
+		if (!indices.empty()) { m_ibo = construct(indices.data(), indices.size() * sizeof(u32), sizeof(u32)); }
+		m_stride = u32(sizeof(T));
 		m_vbo.count = (u32)vertices.size();
 		m_ibo.count = (u32)indices.size();
 		m_triCount = indices.empty() ? u32(vertices.size() / 3) : u32(indices.size() / 3);
@@ -82,8 +135,8 @@ void MeshPrimitive::construct(Geom<V> const& geom) {
 	construct<Vert<V>>(geom.vertices, geom.indices);
 }
 
-inline MeshPrimitive::Data MeshPrimitive::vbo() const noexcept { return {*m_vbo.buffer, m_vbo.count}; }
-inline MeshPrimitive::Data MeshPrimitive::ibo() const noexcept { return {*m_ibo.buffer, m_ibo.count}; }
+inline MeshPrimitive::Data MeshPrimitive::vbo() const noexcept { return {*m_vbo.alloc.buffer, m_vbo.alloc.offset, m_vbo.count}; }
+inline MeshPrimitive::Data MeshPrimitive::ibo() const noexcept { return {*m_ibo.alloc.buffer, m_ibo.alloc.offset, m_ibo.count}; }
 inline MeshPrimitive::Type MeshPrimitive::type() const noexcept { return m_type; }
-inline bool MeshPrimitive::hasIndices() const noexcept { return m_ibo.count > 0 && m_ibo.buffer && m_ibo.buffer->buffer() != vk::Buffer(); }
+inline bool MeshPrimitive::hasIndices() const noexcept { return m_ibo.count > 0 && m_ibo.alloc; }
 } // namespace le::graphics
@@ -0,0 +1,69 @@
+#pragma once
+#include <glm/mat4x4.hpp>
+#include <levk/graphics/bounds.hpp>
+#include <levk/graphics/geometry.hpp>
+#include <atomic>
+#include <optional>
+#include <vector>
+
+namespace le::graphics {
+///
+/// \brief Cluster of contiguous triangles in a primitive's index buffer, with bounds for culling (model space)
+///
+struct Meshlet {
+	u32 firstIndex{};
+	u32 indexCount{};
+	// bounding sphere
+	glm::vec3 centre{};
+	f32 radius{};
+	// normal cone: every triangle faces away from eyes where dot(centre - eye, axis) >= cutoff * |centre - eye| + radius
+	glm::vec3 coneAxis{};
+	// sine of the cone's half angle; 1 (or more) disables cone culling
+	f32 coneCutoff = 1.0f;
+};
+
+///
+/// \brief Splits an indexed triangle list into meshlets in index order (run MeshOptimizer first for compact clusters)
+///
+struct MeshletBuilder {
+	static constexpr u32 max_vertices_v = 64;
+	static constexpr u32 max_triangles_v = 124;
+
+	u32 maxVertices = max_vertices_v;
+	u32 maxTriangles = max_triangles_v;
+
+	std::vector<Meshlet> operator()(Span<glm::vec3 const> positions, Span<u32 const> indices) const;
+
+	template <VertType V>
+	std::vector<Meshlet> operator()(Geom<V> const& geom) const {
+		return (*this)(geom.positions(), geom.indices);
+	}
+};
+
+///
+/// \brief Culls meshlets against a view frustum and their normal cones (world space)
+///
+struct ClusterCuller {
+	struct Range {
+		u32 firstIndex{};
+		u32 indexCount{};
+	};
+
+	// meshlets tested since last reset
+	inline static auto s_visible = std::atomic<u32>(0);
+	inline static auto s_culled = std::atomic<u32>(0);
+
+	Frustum frustum{};
+	// Set to also cull meshlets facing away from eye (only valid if back faces are culled or hidden by front faces)
+	std::optional<glm::vec3> eye{};
+
+	bool visible(Meshlet const& meshlet, glm::mat4 const& model) const noexcept;
+	///
+	/// \brief Append index ranges of meshlets visible to any instance (adjacent ranges are merged)
+	///
+	/// Tests every meshlet against every instance: intended for a handful of instances
+	/// \returns Number of visible meshlets
+	///
+	u32 operator()(Span<Meshlet const> meshlets, Span<glm::mat4 const> instances, std::vector<Range>& out_ranges) const;
+};
+} // namespace le::graphics
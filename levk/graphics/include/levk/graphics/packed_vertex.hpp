@@ -0,0 +1,71 @@
+#pragma once
+#include <levk/graphics/bounds.hpp>
+#include <levk/graphics/geometry.hpp>
+#include <levk/graphics/render/vertex_input.hpp>
+#include <array>
+
+namespace le::graphics {
+///
+/// \brief GPU vertex layout of a MeshPrimitive (selected per mesh, converted from Vertex at import)
+///
+/// eStandard: Vertex (48 bytes).
+/// eCompact: float3 position, UNORM8 colour, octahedral SNORM16 normal, half float UV (24 bytes).
+/// eQuantized: as eCompact but SNORM16 positions, dequantized by a per-mesh Dequantize push constant (20 bytes).
+/// Packed formats require a vertex shader that decodes normals and dequantizes positions (see demo's lit_packed.vert).
+///
+enum class VertexFormat { eStandard, eCompact, eQuantized, eCOUNT_ };
+
+struct CompactVertex {
+	glm::vec3 position{};
+	u32 colour{};
+	u32 normal{};
+	u32 texCoord{};
+};
+
+struct QuantizedVertex {
+	// w is padding
+	std::array<s16, 4> position{};
+	u32 colour{};
+	u32 normal{};
+	u32 texCoord{};
+};
+
+static_assert(sizeof(CompactVertex) == 24 && sizeof(QuantizedVertex) == 20);
+
+///
+/// \brief Vertex shader push constant: position = quantized * scale + offset (identity for non quantized formats)
+///
+struct Dequantize {
+	glm::vec4 offset = glm::vec4(0.0f);
+	glm::vec4 scale = glm::vec4(1.0f);
+
+	static Dequantize make(AABB const& bounds) noexcept;
+};
+
+namespace packing {
+u32 colour(glm::vec4 const& colour) noexcept;
+///
+/// \brief Octahedral encoding of a unit vector into two SNORM16s
+///
+u32 normal(glm::vec3 const& normal) noexcept;
+glm::vec3 unpackNormal(u32 packed) noexcept;
+u32 texCoord(glm::vec2 const& uv) noexcept;
+std::array<s16, 4> position(glm::vec3 const& position, Dequantize const& dequantize) noexcept;
+glm::vec3 unpackPosition(std::array<s16, 4> const& packed, Dequantize const& dequantize) noexcept;
+
+CompactVertex compact(Vertex const& vertex) noexcept;
+QuantizedVertex quantize(Vertex const& vertex, Dequantize const& dequantize) noexcept;
+} // namespace packing
+
+template <>
+struct VertexInfoFactory<CompactVertex> {
+	VertexInputInfo operator()(u32 binding) const;
+};
+
+template <>
+struct VertexInfoFactory<QuantizedVertex> {
+	VertexInputInfo operator()(u32 binding) const;
+};
+
+VertexInputInfo vertexInput(VertexFormat format, u32 binding = 0);
+} // namespace le::graphics
@@ -0,0 +1,76 @@
+#pragma once
+#include <levk/graphics/render/buffering.hpp>
+#include <levk/graphics/render/descriptor_writer.hpp>
+#include <levk/graphics/texture.hpp>
+#include <levk/graphics/utils/defer.hpp>
+#include <optional>
+#include <unordered_map>
+
+namespace le::graphics {
+class CommandBuffer;
+
+///
+/// \brief Registry of 2D textures in one partially bound combined image sampler array (requires descriptor indexing)
+///
+/// Shaders opt in by declaring a set whose only binding is a sampler2D array of exactly capacity_v elements;
+/// PipelineFactory then uses layout() for that set, and materials pass texture indices (eg via uniforms) instead of
+/// binding per-object texture sets. Descriptors are written into the current buffered set in update(): register
+/// textures and update() before recording command buffers that bind set() in a frame. Slots of destroyed textures
+/// are reclaimed (and point to the fallback until reused). Not thread safe.
+///
+class BindlessTextures : public Pinned {
+  public:
+	static constexpr u32 capacity_v = 1024;
+	///
+	/// \brief Index of a slot that always holds a (magenta) fallback texture
+	///
+	static constexpr u32 fallback_v = 0;
+
+	static bool supported(Device const& device) noexcept;
+
+	BindlessTextures(not_null<VRAM*> vram, Buffering buffering = Buffering::eDouble);
+
+	///
+	/// \brief Obtain the array index of texture (registering it if required)
+	/// \returns nullopt if texture is not a ready 2D texture or the array is full (use fallback_v)
+	///
+	std::optional<u32> index(Texture const& texture);
+	///
+	/// \brief Write new / changed textures into the current set
+	///
+	void update();
+	///
+	/// \brief Advance to the next buffered set (call once per frame, in lockstep with frame fences)
+	///
+	void next() noexcept;
+	void bind(CommandBuffer const& cb, vk::PipelineLayout layout, u32 setNumber) const;
+
+	vk::DescriptorSetLayout layout() const noexcept { return m_layout; }
+	vk::DescriptorSet set() const noexcept { return m_sets[m_index]; }
+	std::size_t size() const noexcept { return m_indices.size(); }
+	static bool matches(vk::DescriptorSetLayoutBinding const& binding) noexcept;
+
+  private:
+	struct Slot {
+		vk::ImageView view;
+		vk::Sampler sampler;
+		// buffered sets yet to be written
+		u32 pending{};
+		Texture::OnDestroy::signal onDestroy;
+	};
+
+	void release(Texture const* texture);
+
+	std::vector<Slot> m_slots;
+	std::vector<u32> m_free;
+	std::unordered_map<Texture const*, u32> m_indices;
+	std::vector<vk::DescriptorSet> m_sets;
+	Defer<vk::DescriptorSetLayout> m_layout;
+	Defer<vk::DescriptorPool> m_pool;
+	DescriptorWriter m_writer;
+	not_null<VRAM*> m_vram;
+	Sampler m_sampler;
+	Texture m_fallback;
+	u32 m_index{};
+};
+} // namespace le::graphics
@@ -29,7 +29,8 @@ class RenderContext {
 	static VertexInputInfo vertexInput(VertexInputCreateInfo const& info);
 	static VertexInputInfo vertexInput(QuickVertexInput const& info);
 
-	RenderContext(not_null<VRAM*> vram, GetSpirV&& gs, std::optional<VSync> vsync, Extent2D fbSize, Buffering bf = Buffering::eDouble);
+	RenderContext(not_null<VRAM*> vram, GetSpirV&& gs, std::optional<VSync> vsync, Extent2D fbSize, Buffering bf = Buffering::eDouble,
+				  Span<std::byte const> pipelineCache = {});
 
 	std::unique_ptr<Renderer> defaultRenderer();
 	void setRenderer(std::unique_ptr<Renderer>&& renderer) noexcept;
@@ -60,10 +61,10 @@ class RenderContext {
 	PipelineFactory m_pipelineFactory;
 	TRotator<Sync> m_syncs;
 	std::optional<Acquire> m_acquired;
-	Defer<vk::PipelineCache> m_pipelineCache;
 	not_null<VRAM*> m_vram;
 	std::unique_ptr<Renderer> m_renderer;
 	Buffering m_buffering;
+	u32 m_surfaceGeneration{};
 };
 
 struct RenderContext::Sync {
@@ -1,7 +1,10 @@
 #pragma once
 #include <levk/graphics/memory.hpp>
+#include <levk/graphics/render/descriptor_writer.hpp>
+#include <levk/graphics/render/uniform_allocator.hpp>
 #include <levk/graphics/texture.hpp>
 #include <levk/graphics/utils/trotator.hpp>
+#include <atomic>
 
 namespace le::graphics {
 class ShaderBuffer;
@@ -29,17 +32,41 @@ class DescriptorSet {
 		Texture::Type textureType{};
 	};
 
+	// writes elided since last reset (binding already holds identical descriptors)
+	inline static auto s_skipped = std::atomic<u32>(0);
+
+	static constexpr bool dynamic(vk::DescriptorType type) noexcept;
+
 	DescriptorSet(not_null<VRAM*> vram, CreateInfo const& info);
 	DescriptorSet(DescriptorSet&&) = default;
 	DescriptorSet& operator=(DescriptorSet&&) = default;
 
 	vk::DescriptorSet descriptorSet() const { return m_sets.get().set; }
+	///
+	/// \brief Offsets of all dynamic descriptors (in binding order), to be passed when binding this set
+	///
+	Span<u32 const> dynamicOffsets() const { return m_sets.get().offsets; }
 	void swap() { m_sets.next(); }
 
 	void updateBuffers(u32 binding, Span<Buf const> buffers);
 	void updateImages(u32 binding, Span<Img const> images);
+	///
+	/// \brief Write a payload to a uniform binding; dynamic bindings suballocate from the UniformAllocator (if set)
+	///
 	template <typename T>
 	void writeUpdate(T const& payload, u32 binding);
+	///
+	/// \brief Write a variable length array of payloads (eg storage buffer of instance data)
+	///
+	/// Dynamic bindings suballocate a power of two range from the UniformAllocator (if set), so the descriptor is only
+	/// rewritten when the array outgrows it; other bindings use a per-set buffer that grows as needed.
+	///
+	template <typename T>
+	void writeArray(Span<T const> payload, u32 binding);
+	///
+	/// \brief Write one payload per descriptor array element to a suballocated binding (see suballocated())
+	///
+	void writeElements(u32 binding, Span<bytearray const> elements);
 	void update(u32 binding, Buffer const& buffer);
 	void update(u32 binding, Texture const& texture);
 
@@ -48,20 +75,35 @@ class DescriptorSet {
 	BindingData binding(u32 binding) const noexcept { return binding < max_bindings_v ? m_bindingData[binding] : BindingData(); }
 	bool contains(u32 binding, vk::DescriptorType const* type = {}, Texture::Type const* texType = {}) const noexcept;
 	bool unassigned() const noexcept { return m_sets.empty(); }
+	///
+	/// \brief Whether writes to binding are suballocated from the UniformAllocator (and selected via dynamic offsets)
+	///
+	bool suballocated(u32 binding) const noexcept { return m_uniforms && dynamic(this->binding(binding).layoutBinding.descriptorType); }
 
   private:
 	static constexpr vk::BufferUsageFlags usage(vk::DescriptorType type) noexcept;
 	void updateBuffersImpl(u32 binding, Span<Buf const> buffers, vk::DescriptorType type);
-	template <typename T>
-	void update(u32 binding, vk::DescriptorType type, Span<T const> writes);
+	void updateDynamic(u32 binding, Span<UniformAllocator::Alloc const> allocs, std::size_t range);
+	void writeBuffers(u32 binding, Span<Buf const> buffers);
+	template <typename F>
+	void write(F&& fill);
 
 	struct Binding {
 		vk::DescriptorType type{};
 		Texture::Type texType{};
 		u32 count = 1;
+		u32 dynamicIndex = 0;
+		// content hash of the last write, valid while no buffer / view / sampler has been destroyed since (Device::s_destroyEpoch)
+		u64 hash{};
+		u64 epoch{};
+
+		// the epoch is global (handle values are all a hash sees): destroying any such resource, even one this binding never
+		// referenced (eg a reloaded texture), rewrites every binding once
+		bool elide(u64 hash) noexcept;
 	};
 	struct Set {
 		Binding bindings[max_bindings_v];
+		std::vector<u32> offsets;
 		std::optional<Buffer> buffer;
 		vk::DescriptorSet set;
 	};
@@ -69,6 +111,8 @@ class DescriptorSet {
 	BindingData m_bindingData[max_bindings_v]{};
 	TRotator<Set> m_sets{};
 	u32 m_setNumber = 0;
+	UniformAllocator* m_uniforms{};
+	DescriptorWriter* m_writer{};
 	not_null<VRAM*> m_vram;
 
 	std::pair<Set&, Binding&> setBind(u32 bind, u32 count = 1, vk::DescriptorType const* type = {});
@@ -77,6 +121,9 @@ class DescriptorSet {
 struct DescriptorSet::CreateInfo {
 	Span<BindingData const> bindingData;
 	Span<vk::DescriptorSet> descriptorSets;
+	UniformAllocator* uniforms{};
+	// writes are submitted immediately if null or not deferred
+	DescriptorWriter* writer{};
 	u32 setNumber = 0;
 };
 
@@ -86,6 +133,8 @@ class DescriptorPool {
 		ktl::fixed_vector<DescriptorSet::BindingData, max_bindings_v> bindingData{};
 		vk::DescriptorSetLayout layout{};
 		Buffering buffering = Buffering::eDouble;
+		UniformAllocator* uniforms{};
+		DescriptorWriter* writer{};
 		u32 setNumber = 0;
 		u32 setsPerPool = 32;
 	};
@@ -117,14 +166,23 @@ class DescriptorPool {
 
 // impl
 
+constexpr bool DescriptorSet::dynamic(vk::DescriptorType type) noexcept {
+	return type == vk::DescriptorType::eUniformBufferDynamic || type == vk::DescriptorType::eStorageBufferDynamic;
+}
+
 constexpr vk::BufferUsageFlags DescriptorSet::usage(vk::DescriptorType type) noexcept {
-	if (type == vk::DescriptorType::eStorageBuffer) { return vk::BufferUsageFlagBits::eStorageBuffer; }
+	if (type == vk::DescriptorType::eStorageBuffer || type == vk::DescriptorType::eStorageBufferDynamic) { return vk::BufferUsageFlagBits::eStorageBuffer; }
 	return vk::BufferUsageFlagBits::eUniformBuffer;
 }
 
 template <typename T>
 void DescriptorSet::writeUpdate(T const& payload, u32 binding) {
 	auto [s, b] = setBind(binding);
+	if (m_uniforms && dynamic(b.type)) {
+		auto const alloc = m_uniforms->write(payload);
+		updateDynamic(binding, alloc, sizeof(T));
+		return;
+	}
 	if (!s.buffer) {
 		s.buffer.emplace(m_vram->makeBO(payload, usage(b.type)));
 	} else {
@@ -135,19 +193,25 @@ void DescriptorSet::writeUpdate(T const& payload, u32 binding) {
 }
 
 template <typename T>
-void DescriptorSet::update(u32 binding, vk::DescriptorType type, Span<T const> writes) {
-	vk::WriteDescriptorSet write;
-	write.dstSet = descriptorSet();
-	write.dstBinding = binding;
-	write.dstArrayElement = 0;
-	write.descriptorType = type;
-	write.descriptorCount = (u32)writes.size();
-	if constexpr (std::is_same_v<T, vk::DescriptorImageInfo>) {
-		write.pImageInfo = writes.data();
-	} else {
-		write.pBufferInfo = writes.data();
+void DescriptorSet::writeArray(Span<T const> payload, u32 binding) {
+	auto [s, b] = setBind(binding);
+	auto const size = std::max(payload.size_bytes(), sizeof(T));
+	if (m_uniforms && dynamic(b.type)) {
+		// a dynamic descriptor's range is fixed at write time
+		auto range = sizeof(T);
+		while (range < size) { range *= 2; }
+		auto const alloc = m_uniforms->write(payload.data(), payload.size_bytes(), range);
+		updateDynamic(binding, alloc, range);
+		return;
 	}
-	m_vram->m_device->device().updateDescriptorSets(write, {});
+	if (!s.buffer || s.buffer->writeSize() < size) {
+		auto capacity = s.buffer ? std::size_t(s.buffer->writeSize()) : sizeof(T);
+		while (capacity < size) { capacity *= 2; }
+		s.buffer.emplace(m_vram->makeBuffer(capacity, usage(b.type), true));
+	}
+	if (!payload.empty()) { s.buffer->write(payload.data(), payload.size_bytes()); }
+	Buf const buf{s.buffer->buffer(), size};
+	updateBuffersImpl(binding, buf, b.type);
 }
 
 inline void DescriptorSet::update(u32 binding, Buffer const& buffer) { updateBuffers(binding, Buf{buffer.buffer(), (std::size_t)buffer.writeSize()}); }
@@ -0,0 +1,54 @@
+#pragma once
+#include <levk/core/not_null.hpp>
+#include <levk/graphics/common.hpp>
+#include <atomic>
+#include <vector>
+
+namespace le::graphics {
+class Device;
+
+///
+/// \brief Batches descriptor writes into a single vkUpdateDescriptorSets call (not thread safe)
+///
+/// Queued writes are only visible to the device after flush(): flush before recording command buffers that bind the written sets.
+/// Descriptor sets only queue writes into a (shared) writer between defer() and flush(), and write immediately otherwise.
+///
+class DescriptorWriter {
+  public:
+	// vkUpdateDescriptorSets calls / descriptor writes since last reset
+	inline static auto s_updates = std::atomic<u32>(0);
+	inline static auto s_writes = std::atomic<u32>(0);
+
+	DescriptorWriter(not_null<Device*> device) noexcept : m_device(device) {}
+
+	///
+	/// \brief Queue a write and obtain its (uninitialized) infos; pointer is invalidated by the next call
+	///
+	vk::DescriptorBufferInfo* buffers(vk::DescriptorSet set, u32 binding, vk::DescriptorType type, u32 count, u32 first = 0);
+	vk::DescriptorImageInfo* images(vk::DescriptorSet set, u32 binding, vk::DescriptorType type, u32 count, u32 first = 0);
+	///
+	/// \brief Start queueing writes from descriptor sets until the next flush()
+	///
+	void defer() noexcept { m_deferred = true; }
+	///
+	/// \brief Submit all queued writes and stop deferring
+	/// \returns Number of writes submitted
+	///
+	std::size_t flush();
+
+	bool deferred() const noexcept { return m_deferred; }
+	bool empty() const noexcept { return m_writes.empty(); }
+	std::size_t size() const noexcept { return m_writes.size(); }
+
+  private:
+	void push(vk::DescriptorSet set, u32 binding, vk::DescriptorType type, u32 count, u32 element, std::size_t first);
+
+	std::vector<vk::WriteDescriptorSet> m_writes;
+	std::vector<vk::DescriptorBufferInfo> m_buffers;
+	std::vector<vk::DescriptorImageInfo> m_images;
+	// index of first info per write (infos are stored by index: pointers are fixed up in flush())
+	std::vector<std::size_t> m_firsts;
+	not_null<Device*> m_device;
+	bool m_deferred{};
+};
+} // namespace le::graphics
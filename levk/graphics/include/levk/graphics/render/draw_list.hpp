@@ -19,6 +19,7 @@ class DrawList {
   public:
 	class iterator;
 	using const_iterator = iterator;
+	struct Range;
 
 	struct Obj {
 		DrawBindings bindings{};
@@ -29,11 +30,24 @@ class DrawList {
 	template <DrawPrimitiveAPI T>
 	DrawList& add(T const& t, glm::mat4 matrix = glm::mat4(1.0f), std::optional<vk::Rect2D> scissor = {});
 
+	///
+	/// \brief Merge non-adjacent entries with identical primitives and scissor into instanced runs (reorders entries)
+	///
+	/// Entries pushed consecutively with identical primitives and scissor are always merged on push;
+	/// batch() additionally groups them across the whole list, so it must only be used where draw order is irrelevant.
+	///
+	DrawList& batch();
+
 	std::size_t size() const noexcept { return m_entries.size(); }
+	std::size_t instances() const noexcept { return m_matrices.size(); }
 	void clear() noexcept;
 
 	const_iterator begin() const;
 	const_iterator end() const;
+	///
+	/// \brief Obtain a sub-range of [first, first + count) entries (clamped to size())
+	///
+	Range range(std::size_t first, std::size_t count) const;
 
 	DrawBindings m_bindings{};
 
@@ -52,11 +66,14 @@ class DrawList {
 	static std::size_t size(T const& t) { return AddDrawPrimitives<T>{}.size(t); }
 
 	struct Entry {
-		std::size_t matrix{};
+		std::pair<std::size_t, std::size_t> matrices{};
 		std::pair<std::size_t, std::size_t> primitives{};
 		std::optional<std::size_t> scissor{};
 	};
 
+	bool instanceable(Entry const& lhs, Entry const& rhs) const noexcept;
+	std::size_t hash(Entry const& entry) const noexcept;
+
 	struct PrimitveInserter;
 
 	std::vector<glm::mat4> m_matrices{};
@@ -68,9 +85,12 @@ class DrawList {
 
 struct DrawObject {
 	Span<DrawList::Obj const> objs{};
-	glm::mat4 const& matrix;
+	Span<glm::mat4 const> matrices{};
 	DrawBindings const& bindings;
 	Opt<vk::Rect2D const> scissor{};
+
+	glm::mat4 const& matrix() const noexcept { return matrices.front(); }
+	u32 instances() const noexcept { return u32(matrices.size()); }
 };
 
 class DrawList::iterator {
@@ -80,7 +100,7 @@ class DrawList::iterator {
 
 	iterator() = default;
 
-	DrawObject operator*() const { return {prims(), matrix(), indices(), scissor()}; }
+	DrawObject operator*() const { return {prims(), matrices(), indices(), scissor()}; }
 
 	iterator& operator++();
 	iterator operator++(int);
@@ -93,7 +113,7 @@ class DrawList::iterator {
 	iterator(DrawList const& list, std::size_t index) : m_list(&list), m_index(index) {}
 
 	Span<DrawList::Obj const> prims() const;
-	glm::mat4 const& matrix() const;
+	Span<glm::mat4 const> matrices() const;
 	DrawBindings const& indices() const;
 	Opt<vk::Rect2D const> scissor() const;
 
@@ -103,6 +123,14 @@ class DrawList::iterator {
 	friend class DrawList;
 };
 
+struct DrawList::Range {
+	iterator first{};
+	iterator last{};
+
+	iterator begin() const noexcept { return first; }
+	iterator end() const noexcept { return last; }
+};
+
 // impl
 
 struct DrawList::PrimitveInserter {
@@ -0,0 +1,76 @@
+#pragma once
+#include <levk/core/time.hpp>
+#include <levk/graphics/command_buffer.hpp>
+#include <levk/graphics/render/buffering.hpp>
+#include <levk/graphics/utils/defer.hpp>
+#include <levk/graphics/utils/trotator.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace le::graphics {
+///
+/// \brief Timestamp queries measuring GPU time spent in named scopes
+///
+/// Each buffered frame owns a range of queries; results are read back (without waiting) when that frame's
+/// slot comes around again, ie a few frames late. Inert if the device / graphics queue lacks timestamp support.
+///
+class GpuTimer {
+  public:
+	using Query = u32;
+
+	static constexpr u32 max_scopes_v = 64;
+
+	struct Scope {
+		std::string name;
+		Time_s dt{};
+	};
+
+	GpuTimer() = default;
+	GpuTimer(not_null<Device*> device, Buffering buffering);
+
+	bool supported() const noexcept { return m_pool.active(); }
+
+	///
+	/// \brief Read back results of the current frame slot's previous use (if available) and reset its queries
+	///
+	/// Must be recorded outside a render pass, before any scopes of this frame are written.
+	///
+	void begin(CommandBuffer const& cb);
+	///
+	/// \brief Reserve a named scope for the current frame (not thread safe)
+	/// \returns nullopt if unsupported or out of queries
+	///
+	std::optional<Query> scope(std::string name);
+	///
+	/// \brief Write the start / stop timestamps of a scope (thread safe across different command buffers)
+	///
+	void start(CommandBuffer const& cb, Query query) const;
+	void stop(CommandBuffer const& cb, Query query) const;
+	///
+	/// \brief Advance to the next frame slot
+	///
+	void next() noexcept;
+
+	///
+	/// \brief Most recently read back scopes (in reservation order)
+	///
+	std::vector<Scope> const& results() const noexcept { return m_results; }
+
+  private:
+	struct Slot {
+		std::vector<std::string> names;
+		u32 base{};
+	};
+
+	void write(CommandBuffer const& cb, u32 index, vk::PipelineStageFlagBits stage) const;
+	void read(Slot const& slot);
+
+	std::vector<Scope> m_results;
+	TRotator<Slot> m_slots;
+	Defer<vk::QueryPool> m_pool;
+	Device* m_device{};
+	f64 m_period{};
+	u64 m_mask{};
+};
+} // namespace le::graphics
@@ -0,0 +1,46 @@
+#pragma once
+#include <levk/core/span.hpp>
+#include <levk/core/time.hpp>
+#include <levk/graphics/utils/defer.hpp>
+
+namespace le::graphics {
+///
+/// \brief Owning wrapper for vk::PipelineCache, with (de)serialisation and creation counters
+///
+class PipelineCache {
+  public:
+	struct Stats {
+		Time_s elapsed{};
+		u32 created{};
+		u32 hits{};
+		u32 misses{};
+	};
+
+	///
+	/// \brief Check if serialised data was produced by the same driver / device (header version one)
+	///
+	static bool compatible(PhysicalDevice const& device, Span<std::byte const> data) noexcept;
+
+	PipelineCache() = default;
+	///
+	/// \brief Construct cache, seeding it with data if compatible
+	///
+	PipelineCache(not_null<Device*> device, Span<std::byte const> data = {});
+
+	vk::PipelineCache cache() const noexcept { return m_cache; }
+	///
+	/// \brief Serialise cache contents
+	///
+	bytearray data() const;
+	///
+	/// \brief Record a pipeline creation (feedback flags are ignored unless valid)
+	///
+	void record(Time_s elapsed, vk::PipelineCreationFeedbackEXT const& feedback) noexcept;
+	Stats const& stats() const noexcept { return m_stats; }
+
+  private:
+	Defer<vk::PipelineCache> m_cache;
+	Stats m_stats;
+	Device* m_device{};
+};
+} // namespace le::graphics
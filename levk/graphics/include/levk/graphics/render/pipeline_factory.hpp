@@ -1,10 +1,13 @@
 #pragma once
 #include <ktl/async/kfunction.hpp>
 #include <levk/core/hash.hpp>
+#include <levk/graphics/render/bindless_textures.hpp>
 #include <levk/graphics/render/descriptor_set.hpp>
 #include <levk/graphics/render/pipeline.hpp>
+#include <levk/graphics/render/pipeline_cache.hpp>
 #include <levk/graphics/render/pipeline_spec.hpp>
 #include <levk/graphics/utils/defer.hpp>
+#include <memory>
 #include <unordered_map>
 
 namespace le::graphics {
@@ -20,10 +23,18 @@ class ShaderInput {
 	DescriptorSet& set(u32 set, std::size_t index) const;
 	void swap();
 
+	///
+	/// \brief Bindless texture array used by this shader (at bindlessSet()), if any
+	///
+	Opt<BindlessTextures> bindless() const noexcept { return m_bindless; }
+	u32 bindlessSet() const noexcept { return m_bindlessSet; }
+
 	VRAM* m_vram{};
 
   private:
 	std::unordered_map<u32, DescriptorPool> m_setPools;
+	BindlessTextures* m_bindless{};
+	u32 m_bindlessSet{};
 };
 
 struct ShaderInput::PoolData {
@@ -34,6 +45,11 @@ struct ShaderInput::PoolData {
 
 	std::vector<Set> sets;
 	Buffering buffering = Buffering::eDouble;
+	UniformAllocator* uniforms{};
+	DescriptorWriter* writer{};
+	// set number is bound to bindless->set() instead of a pool of its own
+	BindlessTextures* bindless{};
+	u32 bindlessSet{};
 };
 
 class PipelineFactory {
@@ -45,7 +61,7 @@ class PipelineFactory {
 	static Spec spec(ShaderSpec shader, PFlags flags = pflags_all, VertexInputInfo vertexInput = {});
 	static vk::UniqueShaderModule makeModule(vk::Device device, SpirV const& spirV);
 
-	PipelineFactory(not_null<VRAM*> vram, GetSpirV&& getSpirV, Buffering buffering = Buffering::eDouble) noexcept;
+	PipelineFactory(not_null<VRAM*> vram, GetSpirV&& getSpirV, Buffering buffering = Buffering::eDouble, Span<std::byte const> cacheData = {});
 
 	Pipeline get(Spec const& spec, vk::RenderPass renderPass);
 	bool contains(Hash spec, vk::RenderPass renderPass) const;
@@ -57,6 +73,21 @@ class PipelineFactory {
 	std::size_t pipeCount(Hash spec) const noexcept;
 	void clear(Hash spec) noexcept;
 
+	///
+	/// \brief Backs all uniform buffer bindings (declared dynamic in set layouts) of pipelines made by this factory
+	///
+	UniformAllocator& uniforms() const noexcept { return *m_uniforms; }
+	///
+	/// \brief Batches descriptor writes of pipelines made by this factory (while deferred)
+	///
+	DescriptorWriter& descriptorWriter() const noexcept { return *m_writer; }
+	///
+	/// \brief Shared texture array for shaders that declare one (only if supported by the device)
+	///
+	Opt<BindlessTextures> bindless() const noexcept { return m_bindless.get(); }
+
+	PipelineCache const& pipelineCache() const noexcept { return m_pipelineCache; }
+
   private:
 	struct Pipe {
 		Defer<vk::Pipeline> pipeline;
@@ -83,8 +114,13 @@ class PipelineFactory {
 	Meta makeMeta(ShaderSpec const& shader) const;
 
 	using SpecHash = Hash;
+	// must outlive descriptor sets in m_storage
+	std::unique_ptr<UniformAllocator> m_uniforms;
+	std::unique_ptr<DescriptorWriter> m_writer;
+	std::unique_ptr<BindlessTextures> m_bindless;
 	std::unordered_map<SpecHash, SpecMap> m_storage;
 	GetSpirV m_getSpirV;
+	mutable PipelineCache m_pipelineCache;
 	not_null<VRAM*> m_vram;
 	Buffering m_buffering;
 };
@@ -8,6 +8,7 @@
 
 namespace le::graphics {
 class PipelineFactory;
+class GpuTimer;
 
 static constexpr u8 max_secondary_cmd_v = 8;
 
@@ -23,6 +24,9 @@ struct RenderInfo {
 	Framebuffer framebuffer;
 	RenderBegin begin;
 	vk::RenderPass renderPass;
+	// made (and destroyed) for this pass if null
+	vk::Framebuffer vkFramebuffer;
+	GpuTimer* gpuTimer{};
 };
 
 class RenderPass {
@@ -34,6 +38,7 @@ class RenderPass {
 	vk::RenderPass renderPass() const noexcept { return m_info.renderPass; }
 	RenderInfo const& info() const noexcept { return m_info; }
 	PipelineFactory& pipelineFactory() const noexcept { return *m_factory; }
+	Opt<GpuTimer> gpuTimer() const noexcept { return m_info.gpuTimer; }
 	Span<CommandBuffer const> commandBuffers() const noexcept { return m_info.secondary.empty() ? Span(m_info.primary) : m_info.secondary; }
 
 	vk::Viewport viewport() const;
@@ -2,6 +2,7 @@
 #include <levk/graphics/command_buffer.hpp>
 #include <levk/graphics/image.hpp>
 #include <levk/graphics/render/buffering.hpp>
+#include <levk/graphics/render/gpu_timer.hpp>
 #include <levk/graphics/render/render_pass.hpp>
 #include <levk/graphics/render/surface.hpp>
 #include <levk/graphics/rgba.hpp>
@@ -37,6 +38,38 @@ class ImageCache {
 	VRAM* m_vram{};
 };
 
+///
+/// \brief Framebuffers keyed by render pass and attachments, reused across frames
+///
+/// Keys are raw handles: clear() must be called whenever an attachment image / view is recreated
+/// (destruction is deferred, so in-flight frames are unaffected).
+///
+class FramebufferCache {
+  public:
+	static constexpr std::size_t max_entries_v = 16;
+
+	static Defer<vk::Framebuffer> make(not_null<Device*> device, vk::RenderPass renderPass, Framebuffer const& attachments);
+
+	FramebufferCache() = default;
+	FramebufferCache(not_null<Device*> device) noexcept : m_device(device) {}
+
+	vk::Framebuffer get(vk::RenderPass renderPass, Framebuffer const& attachments);
+	void clear() noexcept { m_entries.clear(); }
+	std::size_t size() const noexcept { return m_entries.size(); }
+
+  private:
+	struct Entry {
+		vk::RenderPass renderPass;
+		vk::ImageView colour;
+		vk::ImageView depth;
+		Extent2D extent{};
+		Defer<vk::Framebuffer> framebuffer;
+	};
+
+	std::vector<Entry> m_entries;
+	Device* m_device{};
+};
+
 class Renderer {
   public:
 	enum class Approach { eForward, eDeferred, eOther };
@@ -67,6 +100,10 @@ class Renderer {
 	RenderInfo mainPassInfo(RenderTarget const& colour, RenderTarget const& depth, RenderBegin const& rb) const;
 	RenderPass beginMainPass(PipelineFactory& pf, RenderTarget const& acquired, RenderBegin const& rb);
 	virtual vk::CommandBuffer endMainPass(RenderPass& out_rp);
+	///
+	/// \brief Drop cached framebuffers (call when externally owned attachments, eg swapchain images, are recreated)
+	///
+	void invalidateFramebuffers() noexcept { m_framebuffers.clear(); }
 
 	Tech tech() const noexcept { return Tech{Approach::eForward, m_target}; }
 	bool canScale() const noexcept;
@@ -75,6 +112,8 @@ class Renderer {
 	bool canBlitFrame() const noexcept { return m_blitFlags.test(BlitFlag::eSrc); }
 
 	vk::RenderPass mainRenderPass() const noexcept { return m_singleRenderPass; }
+	GpuTimer& gpuTimer() noexcept { return m_gpuTimer; }
+	GpuTimer const& gpuTimer() const noexcept { return m_gpuTimer; }
 	Image const* offScreenImage() const noexcept { return m_colourImage.peek(); }
 
   protected:
@@ -85,6 +124,8 @@ class Renderer {
 
 	ImageCache m_depthImage;
 	ImageCache m_colourImage;
+	FramebufferCache m_framebuffers;
+	GpuTimer m_gpuTimer;
 	RenderTarget m_acquired;
 	vk::Format m_colourFormat = vk::Format::eR8G8B8A8Srgb;
 	not_null<VRAM*> m_vram;
@@ -102,6 +143,7 @@ class Renderer {
 	TRotator<Cmd> m_primaryCmd;
 	TRotator<Cmds> m_secondaryCmds;
 	Defer<vk::RenderPass> m_singleRenderPass;
+	std::optional<GpuTimer::Query> m_mainQuery;
 	Surface::Format m_surfaceFormat;
 	TPair<f32> m_scaleLimits = {0.25f, 4.0f};
 	Target m_target;
@@ -4,10 +4,16 @@
 #include <levk/graphics/device/vram.hpp>
 #include <levk/graphics/memory.hpp>
 #include <levk/graphics/utils/trotator.hpp>
+#include <cstring>
 
 namespace le::graphics {
 class DescriptorSet;
 
+///
+/// \brief Uniform / storage payload (or array of payloads) staged on the CPU and uploaded when written to a descriptor set
+///
+/// Suballocated (dynamic) bindings copy the payloads into the frame's UniformAllocator; other bindings use rotating buffers.
+///
 class ShaderBuffer {
   public:
 	struct CreateInfo;
@@ -28,9 +34,12 @@ class ShaderBuffer {
 
   private:
 	void resize(std::size_t size, std::size_t count);
+	void upload() const;
 
 	struct Storage {
-		std::vector<TRotator<Buffer>> buffers;
+		std::vector<bytearray> elements;
+		// only allocated for bindings that are not suballocated
+		mutable std::vector<TRotator<Buffer>> buffers;
 		vk::DescriptorType type;
 		vk::BufferUsageFlagBits usage = {};
 		Buffering buffering;
@@ -54,8 +63,7 @@ inline vk::DescriptorType ShaderBuffer::type() const noexcept { return m_storage
 template <typename T>
 ShaderBuffer& ShaderBuffer::write(T const& t, std::size_t offset) {
 	resize(sizeof(T), 1);
-	m_storage.buffers.front().get().write(&t, sizeof(T), (vk::DeviceSize)offset);
-	return *this;
+	return write(&t, sizeof(T), offset);
 }
 
 template <typename T>
@@ -63,7 +71,7 @@ ShaderBuffer& ShaderBuffer::writeArray(T const& t) {
 	using value_type = typename T::value_type;
 	resize(sizeof(value_type), t.size());
 	std::size_t idx = 0;
-	for (auto const& x : t) { m_storage.buffers[idx++].get().write(&x, sizeof(value_type)); }
+	for (auto const& x : t) { std::memcpy(m_storage.elements[idx++].data(), &x, sizeof(value_type)); }
 	return *this;
 }
 } // namespace le::graphics
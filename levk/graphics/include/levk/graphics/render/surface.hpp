@@ -58,6 +58,8 @@ class Surface {
 	vk::Result submit(Span<vk::CommandBuffer const> cbs, Sync const& sync) const;
 	vk::Result present(Extent2D fbSize, Acquire image, vk::Semaphore wait);
 	RenderTarget const& lastDrawn() const noexcept { return m_storage.lastDrawn; }
+	// incremented every time the swapchain (and its images / views) is recreated
+	u32 generation() const noexcept { return m_generation; }
 
   private:
 	struct Info {
@@ -89,6 +91,7 @@ class Surface {
 	vk::SwapchainCreateInfoKHR m_createInfo;
 	VSyncs m_vsyncs;
 	not_null<VRAM*> m_vram;
+	u32 m_generation{};
 };
 
 // impl
@@ -0,0 +1,55 @@
+#pragma once
+#include <levk/graphics/buffer.hpp>
+#include <levk/graphics/device/linear_allocator.hpp>
+#include <levk/graphics/render/buffering.hpp>
+
+namespace le::graphics {
+class VRAM;
+
+///
+/// \brief Persistently mapped, per-frame linear allocator for uniform / storage data bound via dynamic offsets
+///
+/// All frames share one buffer (split into per-frame regions), so descriptors pointing at it stay valid across frames:
+/// per-object data costs a bump allocation + memcpy and a dynamic offset at bind time. Outgrowing a frame region
+/// replaces the buffer with a larger one (the old one is destroyed after in-flight frames). Not thread safe.
+///
+class UniformAllocator {
+  public:
+	struct Alloc {
+		vk::Buffer buffer;
+		u32 offset{};
+	};
+
+	static constexpr vk::DeviceSize default_capacity_v = 64 * 1024;
+
+	UniformAllocator() = default;
+	UniformAllocator(not_null<VRAM*> vram, Buffering buffering, vk::DeviceSize capacity = default_capacity_v);
+
+	bool valid() const noexcept { return m_vram != nullptr; }
+
+	///
+	/// \brief Copy size bytes into a new allocation of at least reserve bytes (eg the fixed range of a dynamic descriptor)
+	///
+	Alloc write(void const* data, std::size_t size, std::size_t reserve = 0);
+	template <typename T>
+	Alloc write(T const& t) {
+		return write(&t, sizeof(T));
+	}
+	///
+	/// \brief Advance to the next frame region (call once per frame, in lockstep with frame fences)
+	///
+	void next() noexcept { m_linear.next(); }
+
+	vk::DeviceSize alignment() const noexcept { return m_alignment; }
+	vk::DeviceSize capacity() const noexcept { return m_linear.capacity(); }
+	vk::DeviceSize used() const noexcept { return m_linear.used(); }
+
+  private:
+	void grow(std::size_t size);
+
+	LinearAllocator m_linear;
+	std::optional<Buffer> m_buffer;
+	vk::DeviceSize m_alignment = 1;
+	VRAM* m_vram{};
+};
+} // namespace le::graphics
@@ -1,5 +1,6 @@
 #pragma once
 #include <glm/vec2.hpp>
+#include <ktl/delegate.hpp>
 #include <ktl/fixed_vector.hpp>
 #include <levk/core/bitmap.hpp>
 #include <levk/core/colour.hpp>
@@ -27,6 +28,7 @@ class Texture {
 	enum class Payload { eColour, eData };
 
 	using Result = VRAM::Op<>;
+	using OnDestroy = ktl::delegate<>;
 
 	static constexpr vk::ImageUsageFlags usage_v = vIUFB::eSampled | vIUFB::eTransferSrc | vIUFB::eTransferDst;
 
@@ -38,6 +40,7 @@ class Texture {
 
 	bool construct(Bitmap const& bitmap, Payload payload = Payload::eColour, vk::Format format = Image::linear_v, bool mips = true);
 	bool construct(ImageData img, Payload payload = Payload::eColour, vk::Format format = Image::srgb_v, bool mips = true);
+	bool construct(utils::STBImg&& decoded, Payload payload = Payload::eColour, vk::Format format = Image::srgb_v, bool mips = true);
 	bool construct(Cubemap const& cubemap, Payload payload = Payload::eColour, vk::Format format = Image::linear_v, bool mips = true);
 	bool construct(Span<ImageData const> cubeImgs, Payload payload = Payload::eColour, vk::Format format = Image::srgb_v, bool mips = true);
 
@@ -57,7 +60,21 @@ class Texture {
 	Payload payload() const noexcept { return m_payload; }
 	Type type() const noexcept { return m_type; }
 
+	///
+	/// \brief Signal fired when this object is destroyed (moved-to objects get a fresh delegate: the address is the identity)
+	///
+	[[nodiscard]] OnDestroy::signal onDestroy() const { return m_onDestroy.delegate.make_signal(); }
+
   private:
+	struct DestroyHook {
+		mutable OnDestroy delegate;
+
+		DestroyHook() = default;
+		DestroyHook(DestroyHook&&) noexcept {}
+		DestroyHook& operator=(DestroyHook&&) noexcept { return *this; }
+		~DestroyHook() { delegate(); }
+	};
+
 	bool constructImpl(Span<BmpView const> bmps, Extent2D extent, Payload payload, vk::Format format, bool mips);
 	bool constructImpl(VRAM::Images&& imgs, Payload payload, vk::Format format, bool mips);
 	Result resize(CommandBuffer cb, Extent2D extent, bool viaBlit);
@@ -68,5 +85,6 @@ class Texture {
 	Payload m_payload{};
 	Type m_type{};
 	not_null<VRAM*> m_vram;
+	DestroyHook m_onDestroy;
 };
 } // namespace le::graphics
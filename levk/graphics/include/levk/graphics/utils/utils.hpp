@@ -58,6 +58,8 @@ struct PipeData {
 	vk::PipelineLayout layout;
 	vk::RenderPass renderPass;
 	vk::PipelineCache cache;
+	// filled if non-null and VK_EXT_pipeline_creation_feedback is supported
+	vk::PipelineCreationFeedbackEXT* feedback{};
 };
 
 struct HashGen {
@@ -80,10 +82,28 @@ template <typename T>
 constexpr utils::HashGen& operator<<(utils::HashGen& out, T const next);
 
 inline std::string_view g_compiler = "glslc";
+inline std::string_view g_spirVCache = ".spv_cache";
+
+///
+/// \brief Content-addressed key for compiled SPIR-V
+///
+struct SpirVKey {
+	/// \brief Hash of GLSL source, its #includes (recursively), and compile flags
+	u64 source{};
+	/// \brief Hash of compiler binary (path, size, timestamp); 0 if not found on PATH
+	u64 compiler{};
+};
 
 ktl::fixed_vector<ShaderResources, 4> shaderResources(Span<SpirV> modules);
 io::Path spirVpath(io::Path const& src, bool bDebug = levk_debug);
 std::optional<io::Path> compileGlsl(io::Path const& src, io::Path const& dst = {}, io::Path const& prefix = {}, bool bDebug = levk_debug);
+SpirVKey spirVKey(io::Path const& src, bool bDebug = levk_debug);
+///
+/// \brief Obtain SPIR-V for src from the cache (in g_spirVCache next to src), compiling into it only on a miss
+///
+/// Never launches the compiler on a hit; if the compiler is not found, any entry built from identical source is returned
+///
+std::optional<io::Path> cachedSpirV(io::Path const& src, bool bDebug = levk_debug, bool bCompile = true);
 SetBindings extractBindings(Span<SpirV> modules);
 bool hasActiveModule(Span<ShaderModule const> modules) noexcept;
 std::optional<vk::Pipeline> makeGraphicsPipeline(Device& dv, Span<ShaderModule const> sm, PipelineSpec const& sp, PipeData const& data);
@@ -0,0 +1,72 @@
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <levk/graphics/bounds.hpp>
+#include <algorithm>
+
+namespace le::graphics {
+AABB AABB::make(Span<glm::vec3 const> points) noexcept {
+	AABB ret;
+	for (auto const& point : points) { ret.add(point); }
+	return ret;
+}
+
+AABB& AABB::add(glm::vec3 const& point) noexcept {
+	min = glm::min(min, point);
+	max = glm::max(max, point);
+	return *this;
+}
+
+AABB& AABB::add(AABB const& rhs) noexcept {
+	if (rhs.valid()) {
+		min = glm::min(min, rhs.min);
+		max = glm::max(max, rhs.max);
+	}
+	return *this;
+}
+
+AABB AABB::transform(glm::mat4 const& mat) const noexcept {
+	if (!valid()) { return *this; }
+	// transform centre, and project half extent onto absolute basis vectors
+	glm::vec3 const c = mat * glm::vec4(centre(), 1.0f);
+	glm::vec3 const h = halfExtent();
+	glm::vec3 const e = glm::abs(glm::vec3(mat[0])) * h.x + glm::abs(glm::vec3(mat[1])) * h.y + glm::abs(glm::vec3(mat[2])) * h.z;
+	return {c - e, c + e};
+}
+
+Frustum Frustum::make(glm::mat4 const& viewProj) noexcept {
+	auto const row = [&viewProj](int i) { return glm::vec4(viewProj[0][i], viewProj[1][i], viewProj[2][i], viewProj[3][i]); };
+	glm::vec4 const r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+	Frustum ret;
+	ret.planes[eLeft] = r3 + r0;
+	ret.planes[eRight] = r3 - r0;
+	ret.planes[eBottom] = r3 + r1;
+	ret.planes[eTop] = r3 - r1;
+	ret.planes[eNear] = r2;
+	ret.planes[eFar] = r3 - r2;
+	for (auto& plane : ret.planes) {
+		if (f32 const len = glm::length(glm::vec3(plane)); len > 0.0f) { plane /= len; }
+	}
+	return ret;
+}
+
+bool Frustum::contains(glm::vec3 const& point) const noexcept {
+	auto const inside = [&point](glm::vec4 const& plane) { return glm::dot(glm::vec3(plane), point) + plane.w >= 0.0f; };
+	return std::all_of(std::begin(planes), std::end(planes), inside);
+}
+
+bool Frustum::intersects(AABB const& aabb) const noexcept {
+	glm::vec3 const c = aabb.centre();
+	glm::vec3 const h = aabb.halfExtent();
+	for (auto const& plane : planes) {
+		glm::vec3 const n = plane;
+		// signed distance of centre vs projected radius of box on plane normal
+		if (glm::dot(n, c) + plane.w + glm::dot(glm::abs(n), h) < 0.0f) { return false; }
+	}
+	return true;
+}
+
+bool Frustum::intersects(glm::vec3 const& centre, f32 radius) const noexcept {
+	auto const inside = [&centre, radius](glm::vec4 const& plane) { return glm::dot(glm::vec3(plane), centre) + plane.w >= -radius; };
+	return std::all_of(std::begin(planes), std::end(planes), inside);
+}
+} // namespace le::graphics
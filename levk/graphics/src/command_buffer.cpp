@@ -73,18 +73,24 @@ void CommandBuffer::bind(vk::Pipeline pipeline, vBP bindPoint) const {
 
 void CommandBuffer::bindSets(vk::PipelineLayout layout, vAP<vk::DescriptorSet> sets, u32 firstSet, vAP<u32> offsets, vBP bindPoint) const {
 	ENSURE(recording(), "Command buffer not recording!");
+	s_setBinds.fetch_add(sets.size());
 	m_cb.bindDescriptorSets(bindPoint, layout, firstSet, sets, offsets);
 }
 
-void CommandBuffer::bindSet(vk::PipelineLayout layout, DescriptorSet const& set) const { bindSets(layout, set.descriptorSet(), set.setNumber()); }
+void CommandBuffer::bindSet(vk::PipelineLayout layout, DescriptorSet const& set) const {
+	auto const offsets = set.dynamicOffsets();
+	bindSets(layout, set.descriptorSet(), set.setNumber(), vk::ArrayProxy<u32 const>((u32)offsets.size(), offsets.data()));
+}
 
 void CommandBuffer::bindVBOs(u32 first, vAP<vk::Buffer> buffers, vAP<vk::DeviceSize> offsets) const {
 	ENSURE(recording(), "Command buffer not recording!");
+	s_bufferBinds.fetch_add(buffers.size());
 	m_cb.bindVertexBuffers(first, buffers, offsets);
 }
 
 void CommandBuffer::bindIBO(vk::Buffer buffer, vk::DeviceSize offset, vk::IndexType indexType) const {
 	ENSURE(recording(), "Command buffer not recording!");
+	s_bufferBinds.fetch_add(1);
 	m_cb.bindIndexBuffer(buffer, offset, indexType);
 }
 
@@ -101,11 +101,17 @@ vkInst makeInstance(Device::CreateInfo const& info) {
 			validation = Validation::eOff;
 		}
 	}
-	for (auto ext : requiredExtensionsSet) { ret.extensions.push_back(ext.data()); }
-
 #if defined(LEVK_OS_APPLE)
-	ret.extensions.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+	requiredExtensionsSet.insert(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+#else
+	// required by (optional) device extensions, eg descriptor indexing
+	for (auto const& ext : vk::enumerateInstanceExtensionProperties()) {
+		if (std::string_view(ext.extensionName) == VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) {
+			requiredExtensionsSet.insert(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+		}
+	}
 #endif
+	for (auto ext : requiredExtensionsSet) { ret.extensions.push_back(ext.data()); }
 
 	vk::ApplicationInfo appInfo;
 	appInfo.pApplicationName = info.app.name.data();
@@ -225,12 +231,35 @@ std::unique_ptr<Device> Device::make(CreateInfo const& info, Device::MakeSurface
 		return {};
 	}
 	PhysicalDevice const& picked = devices[index];
+	vk::PhysicalDeviceDescriptorIndexingFeaturesEXT indexingFeatures;
+	{
+		auto const supported = picked.device.enumerateDeviceExtensionProperties();
+		auto const available = [&supported](std::string_view ext) {
+			auto const match = [ext](vk::ExtensionProperties const& props) { return std::string_view(props.extensionName) == ext; };
+			return std::any_of(supported.begin(), supported.end(), match);
+		};
+		for (auto const ext : optionalExtensions) {
+			if (available(ext)) { extensions.push_back(ext.data()); }
+		}
+		auto const props2 = [](char const* ext) { return std::string_view(ext) == VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME; };
+		bool indexing = std::any_of(instance.extensions.begin(), instance.extensions.end(), props2);
+		for (auto const ext : descriptorIndexingExtensions) { indexing &= available(ext); }
+		if (indexing && picked.features.shaderSampledImageArrayDynamicIndexing) {
+			auto const features = picked.device.getFeatures2KHR<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeaturesEXT>();
+			if (features.get<vk::PhysicalDeviceDescriptorIndexingFeaturesEXT>().descriptorBindingPartiallyBound) {
+				for (auto const ext : descriptorIndexingExtensions) { extensions.push_back(ext.data()); }
+				indexingFeatures.descriptorBindingPartiallyBound = true;
+			}
+		}
+	}
 	auto const queueSelect = Queues::select(picked, *surface);
 	vk::PhysicalDeviceFeatures deviceFeatures;
 	deviceFeatures.fillModeNonSolid = picked.features.fillModeNonSolid;
 	deviceFeatures.wideLines = picked.features.wideLines;
 	deviceFeatures.samplerAnisotropy = picked.features.samplerAnisotropy;
+	deviceFeatures.shaderSampledImageArrayDynamicIndexing = indexingFeatures.descriptorBindingPartiallyBound;
 	vk::DeviceCreateInfo deviceCreateInfo;
+	if (indexingFeatures.descriptorBindingPartiallyBound) { deviceCreateInfo.pNext = &indexingFeatures; }
 	deviceCreateInfo.queueCreateInfoCount = (u32)queueSelect.dqci.size();
 	deviceCreateInfo.pQueueCreateInfos = queueSelect.dqci.data();
 	deviceCreateInfo.pEnabledFeatures = &deviceFeatures;
@@ -260,6 +289,8 @@ std::unique_ptr<Device> Device::make(CreateInfo const& info, Device::MakeSurface
 	ret->m_metadata.available = std::move(devices);
 	ret->m_metadata.extensions = std::move(extensions);
 	ret->m_metadata.limits = picked.properties.limits;
+	ret->m_metadata.descriptorIndexing = indexingFeatures.descriptorBindingPartiallyBound;
+	if (ret->m_metadata.descriptorIndexing) { logI(LC_LibUser, "[{}] Descriptor indexing enabled", g_name); }
 
 	logI(LC_LibUser, "[{}] Vulkan device constructed, using GPU {}", g_name, picked.toString());
 	return ret;
@@ -272,6 +303,11 @@ Device::~Device() {
 
 bool Device::valid(vk::SurfaceKHR surface) const { return physicalDevice().surfaceSupport(m_queues.graphics().family(), surface); }
 
+bool Device::supports(std::string_view extension) const noexcept {
+	auto const match = [extension](char const* ext) { return std::string_view(ext) == extension; };
+	return std::any_of(m_metadata.extensions.begin(), m_metadata.extensions.end(), match);
+}
+
 void Device::waitIdle() {
 	m_device->waitIdle();
 	m_deferred.flush();
@@ -283,10 +319,14 @@ vk::UniqueSurfaceKHR Device::makeSurface() const {
 	return vk::UniqueSurfaceKHR(ret, *m_instance);
 }
 
-vk::Semaphore Device::makeSemaphore() const { return m_device->createSemaphore({}); }
+vk::Semaphore Device::makeSemaphore() const {
+	s_objectsMade.fetch_add(1);
+	return m_device->createSemaphore({});
+}
 
 vk::Fence Device::makeFence(bool signalled) const {
 	vk::FenceCreateFlags flags = signalled ? vk::FenceCreateFlagBits::eSignaled : vk::FenceCreateFlags();
+	s_objectsMade.fetch_add(1);
 	return m_device->createFence(flags);
 }
 
@@ -343,10 +383,17 @@ vk::ImageView Device::makeImageView(vk::Image image, vk::Format format, vk::Imag
 	createInfo.subresourceRange.levelCount = mipLevels;
 	createInfo.subresourceRange.baseArrayLayer = 0;
 	createInfo.subresourceRange.layerCount = type == vk::ImageViewType::eCube ? 6 : 1;
+	s_objectsMade.fetch_add(1);
 	return m_device->createImageView(createInfo);
 }
 
-vk::PipelineCache Device::makePipelineCache() const { return m_device->createPipelineCache({}); }
+vk::PipelineCache Device::makePipelineCache(Span<std::byte const> initialData) const {
+	vk::PipelineCacheCreateInfo createInfo;
+	createInfo.initialDataSize = initialData.size();
+	createInfo.pInitialData = initialData.data();
+	s_objectsMade.fetch_add(1);
+	return m_device->createPipelineCache(createInfo);
+}
 
 vk::PipelineLayout Device::makePipelineLayout(vAP<vk::PushConstantRange> pushConstants, vAP<vk::DescriptorSetLayout> setLayouts) const {
 	vk::PipelineLayoutCreateInfo createInfo;
@@ -354,13 +401,22 @@ vk::PipelineLayout Device::makePipelineLayout(vAP<vk::PushConstantRange> pushCon
 	createInfo.pSetLayouts = setLayouts.data();
 	createInfo.pushConstantRangeCount = pushConstants.size();
 	createInfo.pPushConstantRanges = pushConstants.data();
+	s_objectsMade.fetch_add(1);
 	return m_device->createPipelineLayout(createInfo);
 }
 
-vk::DescriptorSetLayout Device::makeDescriptorSetLayout(vAP<vk::DescriptorSetLayoutBinding> bindings) const {
+vk::DescriptorSetLayout Device::makeDescriptorSetLayout(vAP<vk::DescriptorSetLayoutBinding> bindings, vAP<vk::DescriptorBindingFlagsEXT> flags) const {
 	vk::DescriptorSetLayoutCreateInfo createInfo;
 	createInfo.bindingCount = bindings.size();
 	createInfo.pBindings = bindings.data();
+	vk::DescriptorSetLayoutBindingFlagsCreateInfoEXT flagsInfo;
+	if (!flags.empty()) {
+		EXPECT(flags.size() == bindings.size() && descriptorIndexing());
+		flagsInfo.bindingCount = flags.size();
+		flagsInfo.pBindingFlags = flags.data();
+		createInfo.pNext = &flagsInfo;
+	}
+	s_objectsMade.fetch_add(1);
 	return m_device->createDescriptorSetLayout(createInfo);
 }
 
@@ -369,6 +425,7 @@ vk::DescriptorPool Device::makeDescriptorPool(Span<vk::DescriptorPoolSize const>
 	createInfo.poolSizeCount = poolSizes.size();
 	createInfo.pPoolSizes = poolSizes.data();
 	createInfo.maxSets = maxSets;
+	s_objectsMade.fetch_add(1);
 	return m_device->createDescriptorPool(createInfo);
 }
 
@@ -388,10 +445,14 @@ vk::Framebuffer Device::makeFramebuffer(vk::RenderPass renderPass, Span<vk::Imag
 	createInfo.width = extent.width;
 	createInfo.height = extent.height;
 	createInfo.layers = layers;
+	s_objectsMade.fetch_add(1);
 	return m_device->createFramebuffer(createInfo);
 }
 
-vk::Sampler Device::makeSampler(vk::SamplerCreateInfo info) const { return m_device->createSampler(info); }
+vk::Sampler Device::makeSampler(vk::SamplerCreateInfo info) const {
+	s_objectsMade.fetch_add(1);
+	return m_device->createSampler(info);
+}
 
 bool Device::setDebugUtilsName([[maybe_unused]] vk::DebugUtilsObjectNameInfoEXT const& info) const {
 	if (!default_v(*m_messenger)) {
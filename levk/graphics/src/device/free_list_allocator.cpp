@@ -0,0 +1,56 @@
+#include <levk/graphics/device/free_list_allocator.hpp>
+
+namespace le::graphics {
+namespace {
+constexpr FreeListAllocator::size_type alignUp(FreeListAllocator::size_type value, FreeListAllocator::size_type alignment) noexcept {
+	// alignment need not be a power of two (eg vertex strides)
+	return alignment > 1U ? (value + alignment - 1U) / alignment * alignment : value;
+}
+} // namespace
+
+FreeListAllocator::FreeListAllocator(size_type capacity) : m_capacity(capacity) {
+	if (m_capacity > 0U) { m_free.emplace(0U, m_capacity); }
+}
+
+std::optional<FreeListAllocator::size_type> FreeListAllocator::allocate(size_type size, size_type alignment) {
+	if (size == 0U || size > m_capacity) { return std::nullopt; }
+	for (auto it = m_free.begin(); it != m_free.end(); ++it) {
+		auto const [begin, end] = *it;
+		auto const offset = alignUp(begin, alignment);
+		if (offset + size > end) { continue; }
+		m_free.erase(it);
+		// alignment padding and remainder stay free
+		if (offset > begin) { m_free.emplace(begin, offset); }
+		if (offset + size < end) { m_free.emplace(offset + size, end); }
+		m_live.emplace(offset, offset + size);
+		m_used += size;
+		return offset;
+	}
+	return std::nullopt;
+}
+
+bool FreeListAllocator::release(size_type offset) {
+	auto const it = m_live.find(offset);
+	if (it == m_live.end()) { return false; }
+	auto const end = it->second;
+	m_live.erase(it);
+	m_used -= end - offset;
+	free(offset, end);
+	return true;
+}
+
+void FreeListAllocator::free(size_type begin, size_type end) {
+	auto next = m_free.lower_bound(begin);
+	if (next != m_free.end() && next->first == end) {
+		end = next->second;
+		next = m_free.erase(next);
+	}
+	if (next != m_free.begin()) {
+		if (auto prev = std::prev(next); prev->second == begin) {
+			prev->second = end;
+			return;
+		}
+	}
+	m_free.emplace_hint(next, begin, end);
+}
+} // namespace le::graphics
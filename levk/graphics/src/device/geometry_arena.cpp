@@ -0,0 +1,69 @@
+#include <levk/core/log_channel.hpp>
+#include <levk/core/utils/error.hpp>
+#include <levk/core/utils/expect.hpp>
+#include <levk/graphics/common.hpp>
+#include <levk/graphics/device/geometry_arena.hpp>
+#include <algorithm>
+
+namespace le::graphics {
+namespace {
+constexpr auto usage_v = vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer;
+} // namespace
+
+GeometryArena::Alloc GeometryArena::allocate(Type type, vk::DeviceSize size, vk::DeviceSize alignment) {
+	if (size == 0U) { return {}; }
+	ktl::klock lock(m_storage);
+	auto& pages = lock->pages[type];
+	for (auto const& page : pages) {
+		if (auto const offset = page->allocator.allocate(size, alignment)) { return {&page->buffer, *offset, size, type}; }
+	}
+	auto const capacity = std::max(m_pageSize, size + alignment);
+	bool const dynamic = type == Type::eDynamic;
+	logD(LC_LibUser, "[{}] GeometryArena: new {} page [{}]", g_name, dynamic ? "dynamic" : "static", capacity);
+	auto page = std::make_unique<Page>(Page{m_vram->makeBuffer(capacity, usage_v, dynamic), FreeListAllocator(capacity)});
+	// persistently mapped
+	if (dynamic) { page->buffer.map(); }
+	auto const offset = page->allocator.allocate(size, alignment);
+	ENSURE(offset.has_value(), "Invariant violated");
+	auto& ret = pages.emplace_back(std::move(page));
+	return {&ret->buffer, *offset, size, type};
+}
+
+void GeometryArena::release(Alloc const& alloc) {
+	if (!alloc) { return; }
+	ktl::klock lock(m_storage);
+	auto& pages = lock->pages[alloc.type];
+	auto const it = std::find_if(pages.begin(), pages.end(), [&alloc](auto const& page) { return &page->buffer == alloc.buffer; });
+	EXPECT(it != pages.end());
+	if (it == pages.end()) { return; }
+	[[maybe_unused]] bool const released = (*it)->allocator.release(alloc.offset);
+	EXPECT(released);
+	// keep the first page around: it will be needed again
+	if ((*it)->allocator.empty() && it != pages.begin()) { pages.erase(it); }
+}
+
+bool GeometryArena::write(Alloc const& alloc, void const* data, vk::DeviceSize size) const {
+	EXPECT(alloc && alloc.type == Type::eDynamic && size <= alloc.size);
+	if (!alloc || size > alloc.size) { return false; }
+	// Buffer is not thread safe
+	ktl::klock lock(m_storage);
+	return alloc.buffer->write(data, size, alloc.offset);
+}
+
+VRAM::Future GeometryArena::stage(Alloc const& alloc, void const* data, vk::DeviceSize size) const {
+	EXPECT(alloc && alloc.type == Type::eStatic && size <= alloc.size);
+	return m_vram->stage(*alloc.buffer, data, size, alloc.offset);
+}
+
+GeometryArena::Stats GeometryArena::stats(Type type) const {
+	ktl::klock lock(m_storage);
+	Stats ret;
+	for (auto const& page : lock->pages[type]) {
+		++ret.pages;
+		ret.allocations += u32(page->allocator.count());
+		ret.used += page->allocator.used();
+		ret.capacity += page->allocator.capacity();
+	}
+	return ret;
+}
+} // namespace le::graphics
@@ -0,0 +1,23 @@
+#include <levk/graphics/device/linear_allocator.hpp>
+
+namespace le::graphics {
+namespace {
+constexpr LinearAllocator::size_type alignUp(LinearAllocator::size_type value, LinearAllocator::size_type alignment) noexcept {
+	return alignment > 1U ? (value + alignment - 1U) / alignment * alignment : value;
+}
+} // namespace
+
+std::optional<LinearAllocator::size_type> LinearAllocator::allocate(size_type size, size_type alignment) {
+	if (size == 0U || size > m_capacity) { return std::nullopt; }
+	auto const base = m_capacity * m_frame;
+	auto const offset = alignUp(base + m_head, alignment);
+	if (offset + size > base + m_capacity) { return std::nullopt; }
+	m_head = offset + size - base;
+	return offset;
+}
+
+void LinearAllocator::next() noexcept {
+	m_frame = (m_frame + 1U) % m_frames;
+	m_head = 0U;
+}
+} // namespace le::graphics
@@ -0,0 +1,44 @@
+#include <levk/graphics/device/ring_allocator.hpp>
+#include <algorithm>
+
+namespace le::graphics {
+namespace {
+constexpr RingAllocator::size_type alignUp(RingAllocator::size_type value, RingAllocator::size_type alignment) noexcept {
+	return alignment > 1U ? (value + alignment - 1U) / alignment * alignment : value;
+}
+} // namespace
+
+std::optional<RingAllocator::size_type> RingAllocator::allocate(size_type size, size_type alignment) {
+	if (size == 0U || size > m_capacity) { return std::nullopt; }
+	auto offset = alignUp(m_head, alignment);
+	if (m_blocks.empty()) {
+		offset = 0U;
+	} else if (auto const tail = m_blocks.front().begin; tail < m_head) {
+		// free: [head, capacity) and [0, tail)
+		if (offset + size > m_capacity) {
+			if (size > tail) { return std::nullopt; }
+			offset = 0U;
+		}
+	} else if (offset + size > tail) {
+		// wrapped, free: [head, tail)
+		return std::nullopt;
+	}
+	m_blocks.push_back({offset, offset + size, false});
+	m_head = offset + size;
+	return offset;
+}
+
+void RingAllocator::release(size_type offset) {
+	auto it = std::find_if(m_blocks.begin(), m_blocks.end(), [offset](Block const& b) { return b.begin == offset && !b.released; });
+	if (it == m_blocks.end()) { return; }
+	it->released = true;
+	while (!m_blocks.empty() && m_blocks.front().released) { m_blocks.pop_front(); }
+	if (m_blocks.empty()) { m_head = 0U; }
+}
+
+RingAllocator::size_type RingAllocator::used() const noexcept {
+	if (m_blocks.empty()) { return 0U; }
+	auto const tail = m_blocks.front().begin;
+	return tail < m_head ? m_head - tail : m_capacity - tail + m_head;
+}
+} // namespace le::graphics
@@ -5,26 +5,21 @@
 #include <levk/graphics/device/transfer.hpp>
 
 namespace le::graphics {
-namespace {
-constexpr vk::DeviceSize ceilPOT(vk::DeviceSize size) noexcept {
-	vk::DeviceSize ret = 2;
-	while (ret < size) { ret <<= 1; }
-	return ret;
-}
-} // namespace
-
 Transfer::Transfer(not_null<Memory*> memory, CreateInfo const& info) : m_memory(memory) {
 	vk::CommandPoolCreateInfo poolInfo;
 	poolInfo.flags = vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
 	poolInfo.queueFamilyIndex = memory->m_device->queues().transfer().family();
 	m_data.pool = memory->m_device->device().createCommandPool(poolInfo);
-	m_sync.staging = ktl::kthread([this, r = info.reserve]() {
-		{
-			std::scoped_lock lock(m_sync.mutex);
-			for (auto const& range : r) {
-				for (auto i = range.count; i > 0; --i) { m_data.buffers.push_back(makeStagingBuffer(range.size)); }
-			}
+	if (info.ringSize > 0) {
+		m_ring.buffer = makeStagingBuffer(info.ringSize);
+		m_ring.data = static_cast<std::byte*>(const_cast<void*>(m_ring.buffer->map()));
+		if (m_ring.data) {
+			m_ring.allocator = RingAllocator(info.ringSize);
+			auto const& limits = memory->m_device->physicalDevice().properties.limits;
+			m_ring.alignment = std::max(m_ring.alignment, limits.optimalBufferCopyOffsetAlignment);
 		}
+	}
+	m_sync.staging = ktl::kthread([this]() {
 		logI(LC_LibUser, "[{}] Transfer thread started", g_name);
 		while (auto f = m_queue.pop()) { (*f)(); }
 		logI(LC_LibUser, "[{}] Transfer thread completed", g_name);
@@ -54,13 +49,16 @@ Transfer::~Transfer() {
 	for (auto& batch : m_batches.submitted) { d.destroy(batch.done); }
 	m_data = {};
 	m_batches = {};
+	m_ring.buffer.reset();
+	auto const stats = this->stats();
+	logI(LC_LibUser, "[{}] Transfer staged [{:.2f}MB] in [{}] ring / [{}] dedicated allocations", g_name, f64(stats.bytes) / f64(1_MB), stats.ring, stats.dedicated);
 	d.waitIdle(); // force flush deferred
 	logI(LC_LibUser, "[{}] Transfer destroyed", g_name);
 }
 
 Buffer Transfer::makeStagingBuffer(vk::DeviceSize size) const {
 	Buffer::CreateInfo info;
-	info.size = ceilPOT(size);
+	info.size = size;
 	info.properties = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
 	info.usage = vk::BufferUsageFlagBits::eTransferSrc;
 	info.qcaps = QType::eGraphics;
@@ -97,7 +95,31 @@ std::size_t Transfer::update() {
 	return m_batches.submitted.size();
 }
 
-Transfer::Stage Transfer::newStage(vk::DeviceSize bufferSize) { return Stage{nextBuffer(bufferSize), nextCommand()}; }
+Transfer::Staging Transfer::allocate(vk::DeviceSize size) {
+	Staging ret;
+	ret.size = size;
+	if (size == 0) { return ret; }
+	m_stats.bytes += size;
+	if (m_ring.data) {
+		std::scoped_lock lock(m_ring.mutex);
+		if (auto const offset = m_ring.allocator.allocate(size, m_ring.alignment)) {
+			ret.src = m_ring.buffer->buffer();
+			ret.offset = *offset;
+			ret.data = m_ring.data + *offset;
+			++m_stats.ring;
+			return ret;
+		}
+	}
+	++m_stats.dedicated;
+	ret.buffer = makeStagingBuffer(size);
+	ret.src = ret.buffer->buffer();
+	ret.data = static_cast<std::byte*>(const_cast<void*>(ret.buffer->map()));
+	return ret;
+}
+
+Transfer::Stage Transfer::newStage(vk::DeviceSize bufferSize) { return newStage(allocate(bufferSize)); }
+
+Transfer::Stage Transfer::newStage(Staging&& staging) { return Stage{std::move(staging), nextCommand()}; }
 
 void Transfer::addStage(Stage&& stage, Promise&& promise) {
 	stage.command.end();
@@ -105,19 +127,6 @@ void Transfer::addStage(Stage&& stage, Promise&& promise) {
 	m_batches.active.entries.emplace_back(std::move(stage), std::move(promise));
 }
 
-std::optional<Buffer> Transfer::nextBuffer(vk::DeviceSize size) {
-	if (size == 0) { return std::nullopt; }
-	std::scoped_lock lock(m_sync.mutex);
-	for (auto iter = m_data.buffers.begin(); iter != m_data.buffers.end(); ++iter) {
-		if (iter->writeSize() >= size) {
-			Buffer ret = std::move(*iter);
-			m_data.buffers.erase(iter);
-			return ret;
-		}
-	}
-	return makeStagingBuffer(size);
-}
-
 vk::CommandBuffer beginCb(vk::CommandBuffer cb) {
 	vk::CommandBufferBeginInfo beginInfo;
 	beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
@@ -140,7 +149,10 @@ vk::CommandBuffer Transfer::nextCommand() {
 
 void Transfer::scavenge(Stage&& stage, vk::Fence fence) {
 	m_data.commands.push_back(std::move(stage.command));
-	if (stage.buffer) { m_data.buffers.push_back(std::move(*stage.buffer)); }
+	if (!stage.staging.buffer && stage.staging.data) {
+		std::scoped_lock lock(m_ring.mutex);
+		m_ring.allocator.release(stage.staging.offset);
+	}
 	if (std::find(m_data.fences.begin(), m_data.fences.end(), fence) == m_data.fences.end()) {
 		m_memory->m_device->resetFence(fence, false);
 		m_data.fences.push_back(fence);
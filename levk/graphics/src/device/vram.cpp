@@ -3,6 +3,7 @@
 #include <levk/graphics/command_buffer.hpp>
 #include <levk/graphics/common.hpp>
 #include <levk/graphics/device/device.hpp>
+#include <levk/graphics/device/geometry_arena.hpp>
 #include <levk/graphics/device/vram.hpp>
 #include <levk/graphics/utils/utils.hpp>
 
@@ -108,22 +109,22 @@ struct VRAM::ImageCopier {
 
 	void operator()() const {
 		auto stage = vram.m_transfer.newStage(layerImageSize.second);
-		void const* data = stage.buffer->map();
+		std::byte* data = stage.staging.data;
 		ENSURE(data, "Memory map failed");
 		u32 layerIdx = 0;
 		std::vector<vk::BufferImageCopy> copyRegions;
 		for (auto const& img : imgs) {
 			auto const offset = layerIdx * layerImageSize.first;
 			PData const pd(img);
-			std::memcpy((u8*)data + offset, pd.ptr, pd.size);
-			copyRegions.push_back(bufferImageCopy(extent, aspects, offset, ioffset, (u32)layerIdx++));
+			std::memcpy(data + offset, pd.ptr, pd.size);
+			copyRegions.push_back(bufferImageCopy(extent, aspects, stage.staging.offset + offset, ioffset, (u32)layerIdx++));
 		}
 		ImgMeta meta;
 		meta.layouts = fromTo;
 		meta.stages.second = vram.m_post.stages;
 		meta.access.second = vram.m_post.access;
 		meta.layerMip.layer.count = layerCount;
-		copy(stage.command, stage.buffer->buffer(), image, copyRegions, meta);
+		copy(stage.command, stage.staging.src, image, copyRegions, meta);
 		if (mipCount > 1U) { meta.layouts.second = doMakeMipMaps(stage.command, image, extent, aspects, layerCount, mipCount, fromTo); }
 		vram.m_transfer.addStage(std::move(stage), std::move(pr));
 		vram.m_device->m_layouts.force(image, meta.layouts.second);
@@ -132,12 +133,15 @@ struct VRAM::ImageCopier {
 
 std::unique_ptr<VRAM> VRAM::make(not_null<Device*> device, CreateInfo const& info) { return std::unique_ptr<VRAM>(new VRAM(device, info)); }
 
-VRAM::VRAM(not_null<Device*> device, Transfer::CreateInfo const& info) : Memory(device), m_device(device), m_transfer(this, info) {
+VRAM::VRAM(not_null<Device*> device, Transfer::CreateInfo const& info)
+	: Memory(device), m_device(device), m_transfer(this, info), m_geometry(std::make_unique<GeometryArena>(this)) {
 	logI(LC_LibUser, "[{}] VRAM constructed", g_name);
 }
 
 VRAM::~VRAM() {
 	shutdown();
+	// run deferred geometry releases while the arena is alive
+	m_device->waitIdle();
 	logI(LC_LibUser, "[{}] VRAM destroyed", g_name);
 }
 
@@ -156,24 +160,8 @@ Buffer VRAM::makeBuffer(vk::DeviceSize size, vk::BufferUsageFlags usage, bool ho
 	return Buffer(this, bufferInfo);
 }
 
-VRAM::Future VRAM::stage(Buffer& out_deviceBuffer, void const* pData, vk::DeviceSize size) {
-	if (size == 0) { size = out_deviceBuffer.writeSize(); }
-	bytearray data((std::size_t)size, {});
-	std::memcpy(data.data(), pData, data.size());
-	Transfer::Promise promise;
-	auto ret = promise.get_future();
-	auto f = [p = std::move(promise), dst = out_deviceBuffer.buffer(), d = std::move(data), this]() mutable {
-		auto stage = m_transfer.newStage(vk::DeviceSize(d.size()));
-		if (stage.buffer->write(d.data(), d.size())) {
-			copy(stage.command, stage.buffer->buffer(), dst, d.size());
-			m_transfer.addStage(std::move(stage), std::move(p));
-		} else {
-			logE(LC_LibUser, "[{}] Error staging data!", g_name);
-			p.set_value();
-		}
-	};
-	m_transfer.m_queue.push(std::move(f));
-	return ret;
+VRAM::Future VRAM::stage(Buffer& out_deviceBuffer, void const* pData, vk::DeviceSize size, vk::DeviceSize dstOffset) {
+	return stage(out_deviceBuffer, size, [pData](Span<std::byte> out) { std::memcpy(out.data(), pData, out.size()); }, dstOffset);
 }
 
 VRAM::Future VRAM::clearAsync(ImageRef const& image, LayerMip const& layerMip, Colour colour, std::optional<vk::ImageLayout> dst) {
@@ -254,6 +242,25 @@ CommandPool& VRAM::commandPool() {
 	return it->second;
 }
 
+VRAM::Future VRAM::stageCopy(Buffer& out_deviceBuffer, Transfer::Staging&& staging, vk::DeviceSize dstOffset) {
+	Transfer::Promise promise;
+	auto ret = promise.get_future();
+	if (!staging.data) {
+		logE(LC_LibUser, "[{}] Error staging data!", g_name);
+		promise.set_value();
+		return ret;
+	}
+	auto f = [p = std::move(promise), dst = out_deviceBuffer.buffer(), s = std::move(staging), dstOffset, this]() mutable {
+		auto const size = s.size, offset = s.offset;
+		auto const src = s.src;
+		auto stage = m_transfer.newStage(std::move(s));
+		copy(stage.command, src, dst, size, offset, dstOffset);
+		m_transfer.addStage(std::move(stage), std::move(p));
+	};
+	m_transfer.m_queue.push(std::move(f));
+	return ret;
+}
+
 void VRAM::waitIdle() {
 	while (m_transfer.update() > 0) { ktl::kthread::yield(); }
 }
@@ -131,16 +131,47 @@ constexpr material_t::alpha_mode_t alpha_mode(std::string_view str) {
 	return material_t::alpha_mode_t::opaque;
 }
 
-error_t make_indices(std::span<buffer_view_t const> buffers, accessor_t const& accessor, std::vector<std::uint32_t>& out) {
+// glTF data is little endian; accessors are copied directly into their destination
+static_assert(std::endian::native == std::endian::little, "Unsupported endianness");
+
+template <typename T, typename In = T>
+error_t read_accessor(resources_t const& resources, accessor_t const& accessor, std::vector<T>& out) {
+	if (!accessor.buffer_view_index) {
+		// sparse accessors are not supported: initialize to zeros
+		out = std::vector<T>(accessor.count);
+		return error_t::none;
+	}
+	out.clear();
+	if (accessor.count == 0U) { return error_t::none; }
+	auto const& view = resources.buffer_views[*accessor.buffer_view_index];
+	std::size_t const stride = view.byte_stride > 0U ? view.byte_stride : sizeof(In);
+	if (accessor.byte_offset > view.buffer.size()) { return error_t::out_of_range; }
+	auto const bytes = view.buffer.subspan(accessor.byte_offset);
+	if ((accessor.count - 1U) * stride + sizeof(In) > bytes.size()) { return error_t::out_of_range; }
+	out.resize(accessor.count);
+	if constexpr (std::is_same_v<T, In>) {
+		if (stride == sizeof(In)) {
+			std::memcpy(out.data(), bytes.data(), accessor.count * sizeof(In));
+			return error_t::none;
+		}
+	}
+	for (std::size_t i = 0; i < accessor.count; ++i) {
+		In in;
+		std::memcpy(&in, bytes.data() + i * stride, sizeof(In));
+		out[i] = static_cast<T>(in);
+	}
+	return error_t::none;
+}
+
+error_t make_indices(resources_t const& resources, accessor_t const& accessor, std::vector<std::uint32_t>& out) {
 	if (accessor.type != accessor_t::type_t::scalar) { return error_t::invalid_accessor; }
 	if (!accessor.buffer_view_index) { return error_t::invalid_accessor; }
-	auto const& buffer = buffers[*accessor.buffer_view_index];
 	switch (accessor.ctype) {
-	case accessor_t::ctype_t::uint: out = build_data<std::uint32_t>(buffer.buffer, buffer.byte_stride); break;
-	case accessor_t::ctype_t::ushort: out = build_data<std::uint32_t, std::uint16_t>(buffer.buffer, buffer.byte_stride); break;
+	case accessor_t::ctype_t::uint: return read_accessor<std::uint32_t>(resources, accessor, out);
+	case accessor_t::ctype_t::ushort: return read_accessor<std::uint32_t, std::uint16_t>(resources, accessor, out);
+	case accessor_t::ctype_t::ubyte: return read_accessor<std::uint32_t, std::uint8_t>(resources, accessor, out);
 	default: return error_t::invalid_accessor;
 	}
-	return error_t::none;
 }
 
 template <typename T, std::size_t N>
@@ -152,6 +183,49 @@ void fill_array(T (&out)[N], dj::json const& json, char const* key) {
 
 std::string_view as_string(std::span<std::byte const> bytes) noexcept { return std::string_view(reinterpret_cast<char const*>(bytes.data()), bytes.size()); }
 
+struct glb_t {
+	static constexpr std::uint32_t magic_v = 0x46546C67;
+	static constexpr std::uint32_t json_v = 0x4E4F534A;
+	static constexpr std::uint32_t bin_v = 0x004E4942;
+
+	std::span<std::byte const> json{};
+	std::span<std::byte const> bin{};
+
+	static bool is_glb(std::span<std::byte const> bytes) {
+		if (bytes.size() < sizeof(std::uint32_t)) { return false; }
+		std::uint32_t magic{};
+		read(std::endian::little, bytes, magic);
+		return magic == magic_v;
+	}
+
+	static std::optional<glb_t> make(std::span<std::byte const> bytes) {
+		static constexpr std::size_t header_size_v = 3 * sizeof(std::uint32_t);
+		if (bytes.size() < header_size_v) { return std::nullopt; }
+		std::uint32_t magic{}, version{}, length{};
+		auto in = read(std::endian::little, bytes, magic);
+		in = read(std::endian::little, in, version);
+		in = read(std::endian::little, in, length);
+		if (magic != magic_v || version != 2U || length < header_size_v || length > bytes.size()) { return std::nullopt; }
+		in = bytes.subspan(header_size_v, length - header_size_v);
+		glb_t ret;
+		while (in.size() >= 2 * sizeof(std::uint32_t)) {
+			std::uint32_t chunk_length{}, chunk_type{};
+			in = read(std::endian::little, in, chunk_length);
+			in = read(std::endian::little, in, chunk_type);
+			if (chunk_length > in.size()) { return std::nullopt; }
+			auto const chunk = in.first(chunk_length);
+			in = in.subspan(chunk_length);
+			if (chunk_type == json_v && ret.json.empty()) {
+				ret.json = chunk;
+			} else if (chunk_type == bin_v && ret.bin.empty()) {
+				ret.bin = chunk;
+			}
+		}
+		if (ret.json.empty()) { return std::nullopt; }
+		return ret;
+	}
+};
+
 struct file_loader_t {
 	using path_t = std::filesystem::path;
 
@@ -174,6 +248,8 @@ struct file_loader_t {
 struct parser {
 	asset_t& out;
 	get_bytes_t const& get_bytes;
+	std::span<std::byte const> glb_bin{};
+	bool borrow_bin{};
 
 	error_t parse_asset(dj::json const& root);
 	error_t parse_resources(dj::json const& root);
@@ -248,6 +324,7 @@ error_t parser::parse_images(dj::json const& root) {
 			std::transform(ext.begin(), ext.end(), ext.begin(), [](char const c) { return std::tolower(static_cast<int>(c)); });
 			auto img_type = image_type_from_ext(ext);
 			if (!img_type) { return error_t::unsupported; }
+			if (!get_bytes) { return error_t::resource_not_found; }
 			img.bytes = get_bytes(uri);
 			if (img.bytes.empty()) { return error_t::resource_not_found; }
 			img.type = *img_type;
@@ -262,7 +339,7 @@ error_t parser::parse_samplers(dj::json const& root) {
 		sampler_t smp;
 		smp.name = sampler->get_as<std::string>("name");
 		smp.mag = mag_filter(sampler->get_as<int>("magFilter"));
-		smp.min = min_filter(sampler->get_as<int>("magFilter"));
+		smp.min = min_filter(sampler->get_as<int>("minFilter"));
 		smp.wraps = texture_wrap(sampler->get_as<int>("wrapS"));
 		smp.wrapt = texture_wrap(sampler->get_as<int>("wrapT"));
 		out.samplers.push_back(std::move(smp));
@@ -336,10 +413,8 @@ error_t parser::parse_meshes(dj::json const& root) {
 			}
 			if (auto indices = primitive->find_as<std::size_t>("indices")) {
 				if (*indices >= out.resources.accessors.size()) { return error_t::out_of_range; }
-				std::vector<std::uint32_t> indices_vec;
-				auto res = make_indices(out.resources.buffer_views, out.resources.accessors[*indices], indices_vec);
+				auto res = make_indices(out.resources, out.resources.accessors[*indices], prim.indices);
 				if (res != error_t::none) { return res; }
-				prim.indices = std::move(indices_vec);
 			}
 			if (auto mtl_index = primitive->find_as<std::size_t>("material")) { prim.material_index = *mtl_index; }
 			msh.primitives.push_back(std::move(prim));
@@ -406,6 +481,11 @@ error_t parser::parse_nodes(dj::json const& root) {
 		fill_array(nd.rotation.data, *node, "rotation");
 		fill_array(nd.translation.data, *node, "translation");
 		fill_array(nd.scale.data, *node, "scale");
+		if (auto matrix = node->get_as<std::vector<float>>("matrix"); matrix.size() == 16U) {
+			tmat4<float> mat;
+			for (std::size_t i = 0; i < 16U; ++i) { mat.data[i / 4U].data[i % 4U] = matrix[i]; }
+			nd.matrix = mat;
+		}
 		nd.child_indices = node->get_as<decltype(nd.child_indices)>("children");
 		out.nodes.push_back(std::move(nd));
 	}
@@ -429,10 +509,22 @@ error_t parser::parse_buffers(dj::json const& root) {
 		if (!length) { return error_t::missing_required_property; }
 		auto uri = buffer->get_as<std::string_view>("uri");
 		buffer_t bf;
-		if (uri.empty()) { return error_t::unsupported; }
-		auto res = parse_buffer(uri, bf.storage);
-		if (res != error_t::none) { return res; }
-		if (bf.storage.size() != *length) { return error_t::mismatched_size; }
+		if (uri.empty()) {
+			// GLB: the first buffer refers to the BIN chunk (padded to 4 bytes)
+			if (!out.resources.buffers.empty() || glb_bin.size() < *length) { return error_t::unsupported; }
+			if (borrow_bin) {
+				bf.bytes = glb_bin.first(*length);
+			} else {
+				bf.storage.resize(*length);
+				std::memcpy(bf.storage.data(), glb_bin.data(), *length);
+				bf.bytes = bf.storage;
+			}
+		} else {
+			auto res = parse_buffer(uri, bf.storage);
+			if (res != error_t::none) { return res; }
+			bf.bytes = bf.storage;
+		}
+		if (bf.bytes.size() != *length) { return error_t::mismatched_size; }
 		bf.name = buffer->get_as<std::string>("name");
 		out.resources.buffers.push_back(std::move(bf));
 	}
@@ -449,6 +541,7 @@ error_t parser::parse_buffer(std::string_view uri, std::vector<std::byte>& out_b
 		out_bytes = base64_decode(buf_str);
 		return error_t::none;
 	}
+	if (!get_bytes) { return error_t::resource_not_found; }
 	out_bytes = get_bytes(uri);
 	return error_t::none;
 }
@@ -460,9 +553,9 @@ error_t parser::parse_buffer_views(dj::json const& root) {
 		if (!length || !buffer) { return error_t::missing_required_property; }
 		if (*buffer >= out.resources.buffers.size()) { return error_t::out_of_range; }
 		auto const offset = view->get_as<std::size_t>("byteOffset");
-		if (offset >= *length) { return error_t::out_of_range; }
+		if (offset + *length > out.resources.buffers[*buffer].bytes.size()) { return error_t::out_of_range; }
 		buffer_view_t bv;
-		bv.buffer = buffer_span(out.resources.buffers[*buffer].storage).subspan(offset, *length);
+		bv.buffer = out.resources.buffers[*buffer].bytes.subspan(offset, *length);
 		if (auto stride = view->find_as<std::size_t>("byteStride")) {
 			if (*stride < 4U || *stride > 252U) { return error_t::out_of_range; }
 			bv.byte_stride = *stride;
@@ -513,24 +606,25 @@ error_t parser::parse_attributes(dj::json const& primitive, primitive_t& out_pri
 		auto accessor_index = attribute->as<std::size_t>();
 		if (accessor_index >= out.resources.accessors.size()) { return error_t::out_of_range; }
 		auto const& accessor = out.resources.accessors[accessor_index];
-		auto const& buffer = out.resources.buffer_views[*accessor.buffer_view_index];
+		auto res = error_t::none;
 		if (id == "POSITION") {
 			if (accessor.type != accessor_t::type_t::vec3 || accessor.ctype != accessor_t::ctype_t::floating) { return error_t::invalid_accessor; }
-			out_prim.positions = build_data<tvec3<float>>(buffer.buffer, buffer.byte_stride);
+			res = read_accessor(out.resources, accessor, out_prim.positions);
 		} else if (id == "NORMAL") {
 			if (accessor.type != accessor_t::type_t::vec3 || accessor.ctype != accessor_t::ctype_t::floating) { return error_t::invalid_accessor; }
-			out_prim.normals = build_data<tvec3<float>>(buffer.buffer, buffer.byte_stride);
+			res = read_accessor(out.resources, accessor, out_prim.normals);
 		} else if (id == "TEXCOORD_0") {
 			if (accessor.type != accessor_t::type_t::vec2) { return error_t::invalid_accessor; }
 			if (accessor.ctype != accessor_t::ctype_t::floating) { return error_t::unsupported; }
-			out_prim.texcoords = build_data<tvec2<float>>(buffer.buffer, buffer.byte_stride);
+			res = read_accessor(out.resources, accessor, out_prim.texcoords);
 		} else if (id == "COLOR_0") {
 			if (accessor.type != accessor_t::type_t::vec4) { return error_t::unsupported; }
 			if (accessor.ctype != accessor_t::ctype_t::floating) { return error_t::unsupported; }
-			out_prim.colours = build_data<tvec4<float>>(buffer.buffer, buffer.byte_stride);
+			res = read_accessor(out.resources, accessor, out_prim.colours);
 		} else {
 			out_prim.custom_attributes.emplace(std::move(id), accessor_index);
 		}
+		if (res != error_t::none) { return res; }
 	}
 	return error_t::none;
 }
@@ -545,7 +639,7 @@ error_t parser::parse_pbrmr(dj::json const& pbr, pbr_metallic_roughness_t& out_p
 		if (auto res = parse_texture_info(*bct, ti); res != error_t::none) { return res; }
 		out_pbr.base_colour_texture = ti;
 	}
-	if (auto mrt = pbr.find("metallicRoughnesTexture")) {
+	if (auto mrt = pbr.find("metallicRoughnessTexture")) {
 		texture_info_t ti{};
 		if (auto res = parse_texture_info(*mrt, ti); res != error_t::none) { return res; }
 		out_pbr.metallic_roughness_texture = ti;
@@ -595,11 +689,23 @@ result_t asset_t::parse(char const* json_uri, get_bytes_t get_bytes) {
 		json_bytes = get_bytes(json_uri);
 	}
 	if (json_bytes.empty()) { return {{}, error_t::resource_not_found}; }
+	return parse_bytes(json_bytes, get_bytes);
+}
+
+result_t asset_t::parse_bytes(std::span<std::byte const> bytes, get_bytes_t const& get_bytes, bool borrow_bin) {
+	auto json = as_string(bytes);
+	auto bin = std::span<std::byte const>{};
+	if (glb_t::is_glb(bytes)) {
+		auto const glb = glb_t::make(bytes);
+		if (!glb) { return {{}, error_t::invalid_glb}; }
+		json = as_string(glb->json);
+		bin = glb->bin;
+	}
 
 	auto root = dj::json{};
-	if (!root.read(as_string(json_bytes))) { return {{}, error_t::resource_not_found}; }
+	if (!root.read(json)) { return {{}, error_t::resource_not_found}; }
 	auto ret = result_t{};
-	ret.error = parser{ret.asset, get_bytes}(root);
+	ret.error = parser{ret.asset, get_bytes, bin, borrow_bin}(root);
 	return ret;
 }
 } // namespace le::gltf
@@ -42,6 +42,7 @@ Memory::Memory(not_null<Device*> device) : m_device(device) {
 	allocatorInfo.pVulkanFunctions = &vkFunc;
 	vmaCreateAllocator(&allocatorInfo, &m_allocator);
 	for (auto& count : m_allocations.arr) { count.store(0); }
+	for (auto& count : m_counts.arr) { count.store(0); }
 	logI(LC_LibUser, "[{}] Memory constructed", g_name);
 }
 
@@ -57,9 +58,11 @@ void Memory::clear(vk::CommandBuffer cb, ImageRef const& image, LayerMip const&
 	cb.clearColorImage(image.image, layout, clear, isr);
 }
 
-void Memory::copy(vk::CommandBuffer cb, vk::Buffer src, vk::Buffer dst, vk::DeviceSize size) {
+void Memory::copy(vk::CommandBuffer cb, vk::Buffer src, vk::Buffer dst, vk::DeviceSize size, vk::DeviceSize srcOffset, vk::DeviceSize dstOffset) {
 	vk::BufferCopy copyRegion;
 	copyRegion.size = size;
+	copyRegion.srcOffset = srcOffset;
+	copyRegion.dstOffset = dstOffset;
 	cb.copyBuffer(src, dst, copyRegion);
 }
 
@@ -149,6 +152,7 @@ std::optional<Memory::Resource> Memory::makeBuffer(AllocInfo const& ai, vk::Buff
 	VkBuffer vkBuffer;
 	VmaAllocation handle;
 	if (vmaCreateBuffer(m_allocator, &vkBufferInfo, &createInfo, &vkBuffer, &handle, nullptr) != VK_SUCCESS) { return std::nullopt; }
+	Device::s_objectsMade.fetch_add(1);
 	VmaAllocationInfo allocationInfo;
 	vmaGetAllocationInfo(m_allocator, handle, &allocationInfo);
 	Resource ret;
@@ -160,6 +164,7 @@ std::optional<Memory::Resource> Memory::makeBuffer(AllocInfo const& ai, vk::Buff
 	ret.qcaps = ai.qcaps;
 	ret.mode = bci.sharingMode;
 	m_allocations[Type::eBuffer].fetch_add(ret.size);
+	m_counts[Type::eBuffer].fetch_add(1);
 	return ret;
 }
 
@@ -171,6 +176,7 @@ std::optional<Memory::Resource> Memory::makeImage(AllocInfo const& ai, vk::Image
 	VkImage vkImage;
 	VmaAllocation handle;
 	if (auto res = vmaCreateImage(m_allocator, &vkImageInfo, &allocInfo, &vkImage, &handle, nullptr); res != VK_SUCCESS) { return std::nullopt; }
+	Device::s_objectsMade.fetch_add(1);
 	auto image = vk::Image(vkImage);
 	auto const requirements = m_device->device().getImageMemoryRequirements(image);
 	VmaAllocationInfo allocationInfo;
@@ -184,6 +190,7 @@ std::optional<Memory::Resource> Memory::makeImage(AllocInfo const& ai, vk::Image
 	ret.mode = ici.sharingMode;
 	ret.qcaps = ai.qcaps;
 	m_allocations[Type::eImage].fetch_add(ret.size);
+	m_counts[Type::eImage].fetch_add(1);
 	m_device->m_layouts.force(image, ici.initialLayout);
 	return ret;
 }
@@ -208,12 +215,15 @@ void Memory::Deleter::operator()(not_null<Memory const*> memory, Resource const&
 	if (resource.data) { vmaUnmapMemory(resource.allocator, resource.handle); }
 	resource.resource.visit(ktl::koverloaded{
 		[&](vk::Buffer buffer) {
+			Device::s_destroyEpoch.fetch_add(1);
 			vmaDestroyBuffer(resource.allocator, static_cast<VkBuffer>(buffer), resource.handle);
 			memory->m_allocations[Type::eBuffer].fetch_sub(resource.size);
+			memory->m_counts[Type::eBuffer].fetch_sub(1);
 		},
 		[&](vk::Image image) {
 			vmaDestroyImage(resource.allocator, static_cast<VkImage>(image), resource.handle);
 			memory->m_allocations[Type::eImage].fetch_sub(resource.size);
+			memory->m_counts[Type::eImage].fetch_sub(1);
 			memory->m_device->m_layouts.force(image, vk::ImageLayout::eUndefined);
 		},
 	});
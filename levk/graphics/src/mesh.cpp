@@ -1,7 +1,21 @@
 #include <tinyobjloader/tiny_obj_loader.h>
 #include <dumb_json/json.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <levk/core/io/media.hpp>
+#include <levk/core/log.hpp>
+#include <levk/core/log_channel.hpp>
+#include <levk/graphics/common.hpp>
+#include <levk/graphics/gltf/gltf.hpp>
 #include <levk/graphics/mesh.hpp>
+#include <levk/graphics/mesh_optimizer.hpp>
+#include <levk/graphics/meshlet.hpp>
+#include <levk/graphics/utils/utils.hpp>
+#include <algorithm>
+#include <atomic>
+#include <istream>
+#include <latch>
+#include <thread>
 
 namespace le::graphics {
 namespace {
@@ -33,9 +47,33 @@ constexpr Colour colour(f32 const (&arr)[3]) noexcept {
 	return colours::white;
 }
 
+///
+/// \brief Read-only std::streambuf over a contiguous view (no copy)
+///
+struct ViewBuf : std::streambuf {
+	explicit ViewBuf(std::string_view view) {
+		auto const data = const_cast<char*>(view.data());
+		setg(data, data, data + view.size());
+	}
+};
+
+struct ObjData {
+	tinyobj::attrib_t attrib;
+	std::vector<tinyobj::shape_t> shapes;
+	std::vector<tinyobj::material_t> materials;
+
+	bool load(io::MappedBytes const& obj, io::MappedBytes const& mtl) {
+		ViewBuf objBuf(obj.view()), mtlBuf(mtl.view());
+		std::istream objStream(&objBuf), mtlStream(&mtlBuf);
+		tinyobj::MaterialStreamReader mtlReader(mtlStream);
+		std::string warn, err;
+		return tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, &objStream, &mtlReader);
+	}
+};
+
 struct ObjMtlData {
-	std::string obj{};
-	std::string mtl{};
+	io::MappedBytes obj{};
+	io::MappedBytes mtl{};
 	io::Path dir{};
 	glm::vec3 origin{};
 	f32 scale{};
@@ -50,16 +88,16 @@ struct ObjMtlData {
 		ObjMtlData ret;
 		auto obj = json["obj"].as<std::string_view>();
 		if (obj.empty()) { return {}; }
-		auto objStr = media.string(dir / obj);
-		if (!objStr) { return {}; }
+		auto objBytes = media.mapped(dir / obj);
+		if (!objBytes) { return {}; }
 		if (auto mtl = json.find_as<std::string_view>("mtl")) {
-			if (auto mtlStr = media.string(dir / *mtl)) { ret.mtl = std::move(*mtlStr); }
+			if (auto mtlBytes = media.mapped(dir / *mtl)) { ret.mtl = std::move(*mtlBytes); }
 		} else {
-			auto mtlStr = ret.obj.substr(0, ret.obj.find_last_of('.'));
+			auto mtlStr = std::string(obj.substr(0, obj.find_last_of('.')));
 			mtlStr += ".mtl";
-			if (auto str = media.string(dir / mtlStr)) { ret.mtl = std::move(*str); }
+			if (auto mtlBytes = media.mapped(dir / mtlStr)) { ret.mtl = std::move(*mtlBytes); }
 		}
-		ret.obj = std::move(*objStr);
+		ret.obj = std::move(*objBytes);
 		ret.scale = json.get_as<float>("scale", 1.0f);
 		ret.origin = vec3(json, "origin");
 		ret.dir = std::move(dir);
@@ -77,15 +115,16 @@ struct ObjMtlLoader {
 	io::Path dir{};
 	glm::vec3 origin{};
 	f32 scale = 1.0f;
+	VertexFormat format{};
 
 	void loadTexture(UMap<Hash, Texture>& out, std::string const& uri) const {
 		if (uri.empty()) { return; }
 		Hash const hash = uri;
 		if (out.contains(hash)) { return; }
-		auto bytes = media.bytes(dir / uri);
+		auto bytes = media.mapped(dir / uri);
 		if (!bytes || bytes->empty()) { return; }
 		Texture texture(vram, sampler);
-		if (!texture.construct(*bytes)) { return; }
+		if (!texture.construct(bytes->span())) { return; }
 		out.emplace(hash, std::move(texture));
 	}
 
@@ -165,12 +204,15 @@ struct ObjMtlLoader {
 		return ret;
 	}
 
-	std::vector<MeshPrimitive> loadPrimitives(tinyobj::ObjReader const& reader, UMap<Hash, std::size_t> const& mats) {
+	std::vector<MeshPrimitive> loadPrimitives(ObjData const& obj, UMap<Hash, std::size_t> const& mats) {
 		std::vector<MeshPrimitive> ret;
-		auto const& materials = reader.GetMaterials();
-		for (auto const& shape : reader.GetShapes()) {
+		auto const& materials = obj.materials;
+		for (auto const& shape : obj.shapes) {
+			auto geometry = loadGeometry(obj.attrib, shape);
+			MeshOptimizer{}(geometry);
 			MeshPrimitive primitive(vram);
-			primitive.construct(loadGeometry(reader.GetAttrib(), shape));
+			primitive.construct(geometry, format);
+			primitive.meshlets(MeshletBuilder{}(geometry));
 			if (!shape.mesh.material_ids.empty() && shape.mesh.material_ids[0] >= 0) {
 				auto const& mat = materials[std::size_t(shape.mesh.material_ids[0])];
 				if (auto it = mats.find(mat.name); it != mats.end()) { primitive.m_material = it->second; }
@@ -182,32 +224,292 @@ struct ObjMtlLoader {
 		return ret;
 	}
 };
+
+using DecodedImages = std::vector<std::optional<utils::STBImg>>;
+
+DecodedImages decodeImages(std::vector<ImageData> const& compressed, Opt<dts::executor> executor) {
+	struct State {
+		std::atomic<std::size_t> next{};
+		std::latch done;
+
+		State(std::size_t count) : done(std::ptrdiff_t(count)) {}
+	};
+	DecodedImages ret(compressed.size());
+	auto const count = compressed.size();
+	auto const state = std::make_shared<State>(count);
+	auto const decode = [state, count, in = compressed.data(), out = ret.data()] {
+		for (std::size_t i = state->next++; i < count; i = state->next++) {
+			out[i].emplace(in[i]);
+			state->done.count_down();
+		}
+	};
+	if (executor && count > 1U) {
+		auto const helpers = std::min(count, std::size_t(std::max(std::thread::hardware_concurrency(), 1U))) - 1U;
+		for (std::size_t i = 0; i < helpers; ++i) { executor->enqueue(decode); }
+	}
+	// this thread decodes too and then only waits for images already claimed by workers,
+	// so calling this from an executor task (eg async manifest loads) cannot deadlock
+	decode();
+	state->done.wait();
+	return ret;
+}
+
+// scene graph nesting limit for glTF nodes
+constexpr std::size_t max_node_depth_v = 256;
+
+constexpr glm::vec3 toVec3(gltf::tvec3<float> const& v) noexcept { return {v.data[0], v.data[1], v.data[2]}; }
+constexpr glm::vec4 toVec4(gltf::tvec4<float> const& v) noexcept { return {v.data[0], v.data[1], v.data[2], v.data[3]}; }
+
+constexpr vk::SamplerAddressMode addressMode(gltf::sampler_t::wrap_t wrap) noexcept {
+	switch (wrap) {
+	case gltf::sampler_t::wrap_t::clamp_to_edge: return vk::SamplerAddressMode::eClampToEdge;
+	case gltf::sampler_t::wrap_t::mirrored_repeat: return vk::SamplerAddressMode::eMirroredRepeat;
+	default: return vk::SamplerAddressMode::eRepeat;
+	}
+}
+
+vk::SamplerCreateInfo samplerInfo(gltf::sampler_t const& sampler) {
+	using Min = gltf::sampler_t::min_filter_t;
+	auto ret = Sampler::info({vk::Filter::eLinear, vk::Filter::eLinear});
+	if (sampler.mag) { ret.magFilter = *sampler.mag == gltf::sampler_t::mag_filter_t::nearest ? vk::Filter::eNearest : vk::Filter::eLinear; }
+	if (sampler.min) {
+		auto const min = *sampler.min;
+		bool const nearest = min == Min::nearest || min == Min::nearest_mipmap_nearest || min == Min::nearest_mipmap_linear;
+		bool const nearestMip = min == Min::nearest_mipmap_nearest || min == Min::linear_mipmap_nearest;
+		ret.minFilter = nearest ? vk::Filter::eNearest : vk::Filter::eLinear;
+		ret.mipmapMode = nearestMip ? vk::SamplerMipmapMode::eNearest : vk::SamplerMipmapMode::eLinear;
+	}
+	ret.addressModeU = addressMode(sampler.wraps);
+	ret.addressModeV = addressMode(sampler.wrapt);
+	return ret;
+}
+
+constexpr PBRMaterialData::Mode alphaMode(gltf::material_t::alpha_mode_t mode) noexcept {
+	switch (mode) {
+	case gltf::material_t::alpha_mode_t::mask: return PBRMaterialData::Mode::eMask;
+	case gltf::material_t::alpha_mode_t::blend: return PBRMaterialData::Mode::eBlend;
+	default: return PBRMaterialData::Mode::eOpaque;
+	}
+}
+
+glm::mat4 nodeMatrix(gltf::node_t const& node) {
+	if (node.matrix) {
+		glm::mat4 ret;
+		for (int c = 0; c < 4; ++c) { ret[c] = toVec4(node.matrix->data[c]); }
+		return ret;
+	}
+	auto const& r = node.rotation.data;
+	auto const translate = glm::translate(glm::mat4(1.0f), toVec3(node.translation));
+	auto const rotate = glm::mat4_cast(glm::quat(r[3], r[0], r[1], r[2]));
+	return glm::scale(translate * rotate, toVec3(node.scale));
+}
+
+struct GltfLoader {
+	gltf::asset_t const& asset;
+	not_null<VRAM*> vram;
+	Mesh& out;
+	VertexFormat format{};
+	std::optional<std::size_t> defaultMaterial{};
+	std::vector<bool> visited{};
+
+	std::vector<ImageData> images() const {
+		std::vector<ImageData> ret;
+		ret.reserve(asset.images.size());
+		for (auto const& image : asset.images) {
+			if (image.buffer_view_index) {
+				auto const& view = asset.resources.buffer_views[*image.buffer_view_index].buffer;
+				ret.push_back(ImageData(view.data(), view.size()));
+			} else {
+				ret.push_back(image.bytes);
+			}
+		}
+		return ret;
+	}
+
+	std::vector<bool> linearTextures() const {
+		std::vector<bool> ret(asset.textures.size());
+		auto const set = [&ret](auto const& info) {
+			if (info && info->index < ret.size()) { ret[info->index] = true; }
+		};
+		for (auto const& material : asset.materials) {
+			set(material.pbr_metallic_roughness.metallic_roughness_texture);
+			set(material.normal_texture);
+			set(material.occlusion_texture);
+		}
+		return ret;
+	}
+
+	std::vector<std::optional<std::size_t>> loadTextures(Opt<dts::executor> executor) {
+		for (auto const& sampler : asset.samplers) { out.samplers.push_back(Sampler(vram->m_device, samplerInfo(sampler))); }
+		out.samplers.push_back(Sampler(vram->m_device, Sampler::info({vk::Filter::eLinear, vk::Filter::eLinear})));
+		auto const fallback = out.samplers.back().sampler();
+		auto const compressed = images();
+		auto decoded = decodeImages(compressed, executor);
+		auto const linear = linearTextures();
+		std::vector<std::optional<std::size_t>> ret(asset.textures.size());
+		for (std::size_t i = 0; i < asset.textures.size(); ++i) {
+			auto const& texture = asset.textures[i];
+			if (!texture.source || *texture.source >= decoded.size()) { continue; }
+			auto& image = decoded[*texture.source];
+			// an image shared by multiple textures has been consumed already
+			auto img = image ? std::move(*image) : utils::STBImg(compressed[*texture.source]);
+			image.reset();
+			auto const sampler = texture.sampler ? out.samplers[*texture.sampler].sampler() : fallback;
+			Texture tex(vram, sampler);
+			auto const payload = linear[i] ? Texture::Payload::eData : Texture::Payload::eColour;
+			if (!tex.construct(std::move(img), payload, linear[i] ? Image::linear_v : Image::srgb_v)) { continue; }
+			ret[i] = out.textures.size();
+			out.textures.push_back(std::move(tex));
+		}
+		return ret;
+	}
+
+	void loadMaterials(Span<std::optional<std::size_t> const> textures) {
+		auto const index = [textures](auto const& info) -> std::optional<std::size_t> {
+			if (info && info->index < textures.size()) { return textures[info->index]; }
+			return std::nullopt;
+		};
+		for (auto const& material : asset.materials) {
+			auto const& pbr = material.pbr_metallic_roughness;
+			PBRMaterialData data;
+			data.baseColourFactor = Colour(toVec4(pbr.base_colour_factor));
+			data.emissiveFactor = Colour(toVec3(material.emissive_factor));
+			data.metallicFactor = pbr.metallic_factor;
+			data.roughnessFactor = pbr.roughness_factor;
+			data.alphaCutoff = material.alpha_cutoff;
+			data.mode = alphaMode(material.alpha_mode);
+			Mesh::Material mat;
+			mat.data = data;
+			mat.textures[MatTexType::eDiffuse] = index(pbr.base_colour_texture);
+			mat.textures[MatTexType::eMetalRough] = index(pbr.metallic_roughness_texture);
+			mat.textures[MatTexType::eNormal] = index(material.normal_texture);
+			mat.textures[MatTexType::eOcclusion] = index(material.occlusion_texture);
+			mat.textures[MatTexType::eEmissive] = index(material.emissive_texture);
+			out.materials.push_back(std::move(mat));
+		}
+	}
+
+	std::size_t material(std::optional<std::size_t> index) {
+		if (index && *index < out.materials.size()) { return *index; }
+		if (!defaultMaterial) {
+			defaultMaterial = out.materials.size();
+			out.materials.push_back({});
+		}
+		return *defaultMaterial;
+	}
+
+	void addPrimitive(gltf::primitive_t const& primitive, glm::mat4 const& model) {
+		if (primitive.mode != gltf::primitive_t::mode_t::triangles || primitive.positions.empty()) { return; }
+		auto const count = primitive.positions.size();
+		if (std::any_of(primitive.indices.begin(), primitive.indices.end(), [count](u32 i) { return i >= count; })) { return; }
+		glm::mat3 const normalMat = glm::transpose(glm::inverse(glm::mat3(model)));
+		Geometry geometry;
+		geometry.vertices.resize(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			auto& vertex = geometry.vertices[i];
+			vertex.position = glm::vec3(model * glm::vec4(toVec3(primitive.positions[i]), 1.0f));
+			if (i < primitive.colours.size()) { vertex.colour = toVec4(primitive.colours[i]); }
+			if (i < primitive.normals.size()) { vertex.normal = glm::normalize(normalMat * toVec3(primitive.normals[i])); }
+			if (i < primitive.texcoords.size()) { vertex.texCoord = {primitive.texcoords[i].data[0], primitive.texcoords[i].data[1]}; }
+		}
+		geometry.indices = primitive.indices;
+		if (geometry.indices.empty()) { geometry.autoIndex(Topology::eTriangleList); }
+		MeshOptimizer{}(geometry);
+		MeshPrimitive meshPrimitive(vram);
+		meshPrimitive.construct(geometry, format);
+		meshPrimitive.meshlets(MeshletBuilder{}(geometry));
+		meshPrimitive.m_material = material(primitive.material_index);
+		out.primitives.push_back(std::move(meshPrimitive));
+	}
+
+	void addMesh(std::size_t index, glm::mat4 const& model) {
+		for (auto const& primitive : asset.meshes[index].primitives) { addPrimitive(primitive, model); }
+	}
+
+	void addNode(std::size_t index, glm::mat4 const& parent, std::size_t depth = 0) {
+		if (index >= asset.nodes.size()) { return; }
+		// node hierarchies must be disjoint trees: refuse cycles / shared children and pathologically deep chains
+		if (visited[index] || depth >= max_node_depth_v) {
+			logW(LC_LibUser, "[{}] Skipping invalid glTF node [{}] (cycle, shared or depth > {})", g_name, index, max_node_depth_v);
+			return;
+		}
+		visited[index] = true;
+		auto const& node = asset.nodes[index];
+		auto const model = parent * nodeMatrix(node);
+		if (node.mesh_index) { addMesh(*node.mesh_index, model); }
+		for (std::size_t const child : node.child_indices) { addNode(child, model, depth + 1); }
+	}
+
+	void loadPrimitives() {
+		visited.assign(asset.nodes.size(), false);
+		if (asset.scene < asset.scenes.size()) {
+			for (std::size_t const node : asset.scenes[asset.scene].node_indices) { addNode(node, glm::mat4(1.0f)); }
+		} else {
+			for (std::size_t i = 0; i < asset.meshes.size(); ++i) { addMesh(i, glm::mat4(1.0f)); }
+		}
+	}
+};
 } // namespace
 
-std::optional<Mesh> Mesh::fromObjMtl(io::Path const& jsonURI, io::Media const& media, not_null<VRAM*> vram, vk::Sampler sampler) {
+std::optional<Mesh> Mesh::fromObjMtl(io::Path const& jsonURI, io::Media const& media, not_null<VRAM*> vram, vk::Sampler sampler, VertexFormat format) {
 	auto const data = ObjMtlData::make(jsonURI, media);
 	if (data.obj.empty()) { return {}; }
-	tinyobj::ObjReader reader;
-	if (!reader.ParseFromString(data.obj, data.mtl)) { return {}; }
+	ObjData obj;
+	if (!obj.load(data.obj, data.mtl)) { return {}; }
 	Mesh ret;
 	if (!sampler) {
 		ret.samplers.push_back(Sampler(vram->m_device, Sampler::info({vk::Filter::eLinear, vk::Filter::eLinear})));
 		sampler = ret.samplers.back().sampler();
 	}
-	ObjMtlLoader loader{vram, media, sampler, std::move(data.dir), data.origin, data.scale};
-	auto textures = loader.loadTextures(reader.GetMaterials());
+	ObjMtlLoader loader{vram, media, sampler, std::move(data.dir), data.origin, data.scale, format};
+	auto textures = loader.loadTextures(obj.materials);
 	std::unordered_map<Hash, std::size_t> indices;
 	for (auto& [hash, texture] : textures) {
 		indices[hash] = ret.textures.size();
 		ret.textures.push_back(std::move(texture));
 	}
-	auto materials = loader.loadMaterials(reader.GetMaterials(), indices);
+	auto materials = loader.loadMaterials(obj.materials, indices);
 	indices.clear();
 	for (auto& [hash, mat] : materials) {
 		indices[hash] = ret.materials.size();
 		ret.materials.push_back(std::move(mat));
 	}
-	ret.primitives = loader.loadPrimitives(reader, indices);
+	ret.primitives = loader.loadPrimitives(obj, indices);
+	return ret;
+}
+
+std::optional<Mesh> Mesh::fromGltf(io::Path const& uri, io::Media const& media, not_null<VRAM*> vram, Opt<dts::executor> executor, VertexFormat format) {
+	auto const bytes = media.mapped(uri);
+	if (!bytes) { return {}; }
+	return fromGltf(uri, bytes->span(), media, vram, executor, format);
+}
+
+std::optional<Mesh> Mesh::fromGltf(io::Path const& uri, Span<std::byte const> bytes, io::Media const& media, not_null<VRAM*> vram, Opt<dts::executor> executor,
+								   VertexFormat format) {
+	if (bytes.empty()) { return {}; }
+	auto const dir = uri.parent_path();
+	gltf::get_bytes_t const getBytes = [&media, &dir](std::string_view relative) -> bytearray {
+		if (auto ret = media.bytes(dir / relative)) { return std::move(*ret); }
+		return {};
+	};
+	// GLB BIN chunk is borrowed: bytes outlives result
+	auto const result = gltf::asset_t::parse_bytes(std::span(bytes.data(), bytes.size()), getBytes, true);
+	if (!result) {
+		logW(LC_LibUser, "[{}] Failed to parse glTF [{}]: error [{}]", g_name, uri.generic_string(), int(result.error));
+		return {};
+	}
+	Mesh ret;
+	GltfLoader loader{result.asset, vram, ret, format};
+	auto const textures = loader.loadTextures(executor);
+	loader.loadMaterials(textures);
+	loader.loadPrimitives();
+	if (ret.primitives.empty()) { return {}; }
+	return ret;
+}
+
+AABB Mesh::bounds() const noexcept {
+	AABB ret;
+	for (auto const& primitive : primitives) { ret.add(primitive.bounds()); }
 	return ret;
 }
 
@@ -0,0 +1,194 @@
+#include <glm/geometric.hpp>
+#include <levk/graphics/mesh_optimizer.hpp>
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+namespace le::graphics {
+namespace {
+constexpr u32 invalid_v = std::numeric_limits<u32>::max();
+
+bool validIndices(Span<u32 const> indices, u32 vertexCount) {
+	if (indices.empty() || indices.size() % 3 != 0) { return false; }
+	return std::all_of(indices.begin(), indices.end(), [vertexCount](u32 i) { return i < vertexCount; });
+}
+
+///
+/// \brief State of a single Tipsify pass
+///
+struct Tipsify {
+	std::vector<u32> const& indices;
+	u32 cacheSize;
+
+	// triangles adjacent to each vertex (CSR)
+	std::vector<u32> offsets{};
+	std::vector<u32> adjacency{};
+	// unemitted triangles per vertex
+	std::vector<u32> live{};
+	// cache entry time per vertex
+	std::vector<u32> stamps{};
+	std::vector<bool> emitted{};
+	std::vector<u32> deadEnd{};
+	std::vector<u32> candidates{};
+	u32 time{};
+	u32 cursor{};
+
+	Tipsify(std::vector<u32> const& indices, u32 vertexCount, u32 cacheSize) : indices(indices), cacheSize(cacheSize) {
+		offsets.resize(vertexCount + 1U);
+		live.resize(vertexCount);
+		for (u32 const i : indices) { ++live[i]; }
+		for (u32 v = 0; v < vertexCount; ++v) { offsets[v + 1U] = offsets[v] + live[v]; }
+		adjacency.resize(indices.size());
+		auto fill = offsets;
+		for (std::size_t i = 0; i < indices.size(); ++i) { adjacency[fill[indices[i]]++] = u32(i / 3U); }
+		stamps.resize(vertexCount);
+		emitted.resize(indices.size() / 3U);
+		deadEnd.reserve(indices.size());
+		// every vertex starts out of cache
+		time = cacheSize + 1U;
+	}
+
+	bool cached(u32 vertex) const noexcept { return time - stamps[vertex] <= cacheSize; }
+
+	void emit(u32 fanning, std::vector<u32>& out) {
+		candidates.clear();
+		for (u32 a = offsets[fanning]; a < offsets[fanning + 1U]; ++a) {
+			u32 const triangle = adjacency[a];
+			if (emitted[triangle]) { continue; }
+			for (u32 k = 0; k < 3U; ++k) {
+				u32 const vertex = indices[triangle * 3U + k];
+				out.push_back(vertex);
+				deadEnd.push_back(vertex);
+				candidates.push_back(vertex);
+				--live[vertex];
+				if (!cached(vertex)) { stamps[vertex] = time++; }
+			}
+			emitted[triangle] = true;
+		}
+	}
+
+	std::optional<u32> next() const {
+		std::optional<u32> ret;
+		s64 best = -1;
+		for (u32 const vertex : candidates) {
+			if (live[vertex] == 0U) { continue; }
+			// prefer the oldest cached vertex whose remaining triangles will not push it out of the cache
+			s64 priority = 0;
+			if (s64(time - stamps[vertex]) + 2 * s64(live[vertex]) <= s64(cacheSize)) { priority = s64(time - stamps[vertex]); }
+			if (priority > best) {
+				best = priority;
+				ret = vertex;
+			}
+		}
+		return ret;
+	}
+
+	std::optional<u32> skipDeadEnd() {
+		while (!deadEnd.empty()) {
+			u32 const vertex = deadEnd.back();
+			deadEnd.pop_back();
+			if (live[vertex] > 0U) { return vertex; }
+		}
+		for (; cursor < u32(live.size()); ++cursor) {
+			if (live[cursor] > 0U) { return cursor; }
+		}
+		return std::nullopt;
+	}
+};
+} // namespace
+
+MeshOptimizer::Stats MeshOptimizer::analyze(Span<u32 const> indices, u32 vertexCount, u32 cacheSize) {
+	if (!validIndices(indices, vertexCount)) { return {}; }
+	std::vector<u32> stamps(vertexCount);
+	std::vector<bool> referenced(vertexCount);
+	u32 time = cacheSize + 1U;
+	u32 misses{}, unique{};
+	for (u32 const vertex : indices) {
+		if (!referenced[vertex]) {
+			referenced[vertex] = true;
+			++unique;
+		}
+		if (time - stamps[vertex] > cacheSize) {
+			stamps[vertex] = time++;
+			++misses;
+		}
+	}
+	return {f32(misses) / f32(indices.size() / 3U), f32(misses) / f32(unique)};
+}
+
+std::vector<u32> MeshOptimizer::reorderTriangles(std::vector<u32>& out_indices, u32 vertexCount) const {
+	if (!validIndices(out_indices, vertexCount)) { return {}; }
+	Tipsify tipsify(out_indices, vertexCount, std::max(cacheSize, 3U));
+	std::vector<u32> indices;
+	indices.reserve(out_indices.size());
+	std::vector<u32> ret;
+	auto fanning = tipsify.skipDeadEnd();
+	bool boundary = true;
+	while (fanning) {
+		// a cluster starts wherever the cache was effectively flushed
+		if (boundary) { ret.push_back(u32(indices.size() / 3U)); }
+		tipsify.emit(*fanning, indices);
+		fanning = tipsify.next();
+		if (!fanning) {
+			fanning = tipsify.skipDeadEnd();
+			boundary = fanning && !tipsify.cached(*fanning);
+		} else {
+			boundary = false;
+		}
+	}
+	out_indices = std::move(indices);
+	return ret;
+}
+
+void MeshOptimizer::reorderClusters(std::vector<u32>& out_indices, Span<glm::vec3 const> positions, Span<u32 const> clusters) const {
+	if (clusters.size() < 2U || !validIndices(out_indices, u32(positions.size()))) { return; }
+	u32 const triCount = u32(out_indices.size() / 3U);
+	glm::vec3 meshCentre{};
+	for (u32 const i : out_indices) { meshCentre += positions[i]; }
+	meshCentre /= f32(out_indices.size());
+	struct Cluster {
+		u32 begin;
+		u32 end;
+		f32 key;
+	};
+	std::vector<Cluster> sorted;
+	sorted.reserve(clusters.size());
+	for (std::size_t c = 0; c < clusters.size(); ++c) {
+		Cluster cluster{clusters[c], c + 1U < clusters.size() ? clusters[c + 1U] : triCount, 0.0f};
+		glm::vec3 centre{}, normal{};
+		for (u32 t = cluster.begin; t < cluster.end; ++t) {
+			auto const& a = positions[out_indices[t * 3U]];
+			auto const& b = positions[out_indices[t * 3U + 1U]];
+			auto const& d = positions[out_indices[t * 3U + 2U]];
+			centre += a + b + d;
+			// area weighted
+			normal += glm::cross(b - a, d - a);
+		}
+		centre /= f32((cluster.end - cluster.begin) * 3U);
+		// clusters facing away from the centre are likely to occlude others: draw them first
+		if (f32 const length = glm::length(normal); length > 0.0f) { cluster.key = glm::dot(centre - meshCentre, normal / length); }
+		sorted.push_back(cluster);
+	}
+	std::stable_sort(sorted.begin(), sorted.end(), [](Cluster const& lhs, Cluster const& rhs) { return lhs.key > rhs.key; });
+	std::vector<u32> indices;
+	indices.reserve(out_indices.size());
+	for (auto const& cluster : sorted) {
+		indices.insert(indices.end(), out_indices.begin() + cluster.begin * 3U, out_indices.begin() + cluster.end * 3U);
+	}
+	out_indices = std::move(indices);
+}
+
+std::vector<u32> MeshOptimizer::remapVertices(std::vector<u32>& out_indices, u32 vertexCount) const {
+	if (!validIndices(out_indices, vertexCount)) { return {}; }
+	std::vector<u32> ret(vertexCount, invalid_v);
+	u32 next{};
+	for (u32& index : out_indices) {
+		if (ret[index] == invalid_v) { ret[index] = next++; }
+		index = ret[index];
+	}
+	for (u32& index : ret) {
+		if (index == invalid_v) { index = next++; }
+	}
+	return ret;
+}
+} // namespace le::graphics
@@ -5,15 +5,41 @@
 namespace le::graphics {
 MeshPrimitive::MeshPrimitive(not_null<VRAM*> vram, Type type) : m_vram(vram), m_type(type) {}
 
-MeshPrimitive::~MeshPrimitive() { wait(); }
+MeshPrimitive::~MeshPrimitive() {
+	wait();
+	release();
+}
 
-bool MeshPrimitive::draw(CommandBuffer cb, u32 instances, u32 first) const {
+bool MeshPrimitive::draw(CommandBuffer cb, u32 instances, u32 first, Opt<Bindings> out_bound, Span<ClusterCuller::Range const> ranges) const {
 	if (ready()) {
-		cb.bindVBO(*m_vbo.buffer, m_ibo.buffer.has_value() ? &*m_ibo.buffer : nullptr);
+		Bindings local;
+		auto& bound = out_bound ? *out_bound : local;
+		// primitives sharing an arena page share bindings: data is addressed via base vertex / first index
+		auto const vbo = m_vbo.alloc.buffer->buffer();
+		if (bound.vbo != vbo) {
+			cb.bindVBOs(0, vbo, vk::DeviceSize(0));
+			bound.vbo = vbo;
+		}
+		auto const baseVertex = u32(m_vbo.alloc.offset / m_stride);
 		if (hasIndices()) {
-			cb.drawIndexed(m_ibo.count, instances, first);
+			auto const ibo = m_ibo.alloc.buffer->buffer();
+			if (bound.ibo != ibo) {
+				cb.bindIBO(ibo);
+				bound.ibo = ibo;
+			}
+			auto const firstIndex = u32(m_ibo.alloc.offset / sizeof(u32));
+			if (!ranges.empty()) {
+				u32 indices{};
+				for (auto const& range : ranges) {
+					cb.drawIndexed(range.indexCount, instances, first, s32(baseVertex), firstIndex + range.firstIndex);
+					indices += range.indexCount;
+				}
+				s_trisDrawn.fetch_add(indices / 3U);
+				return true;
+			}
+			cb.drawIndexed(m_ibo.count, instances, first, s32(baseVertex), firstIndex);
 		} else {
-			cb.draw(m_vbo.count, instances, first);
+			cb.draw(m_vbo.count, instances, first, baseVertex);
 		}
 		s_trisDrawn.fetch_add(m_triCount);
 		return true;
@@ -21,7 +47,32 @@ bool MeshPrimitive::draw(CommandBuffer cb, u32 instances, u32 first) const {
 	return false;
 }
 
-bool MeshPrimitive::valid() const noexcept { return m_vbo.buffer.has_value(); }
+void MeshPrimitive::construct(Geometry const& geom, VertexFormat format) {
+	switch (format) {
+	case VertexFormat::eCompact: {
+		std::vector<CompactVertex> vertices;
+		vertices.reserve(geom.vertices.size());
+		for (auto const& vertex : geom.vertices) { vertices.push_back(packing::compact(vertex)); }
+		construct<CompactVertex>(vertices, geom.indices);
+		break;
+	}
+	case VertexFormat::eQuantized: {
+		auto const bounds = AABB::make(geom.positions());
+		auto const dequantize = Dequantize::make(bounds);
+		std::vector<QuantizedVertex> vertices;
+		vertices.reserve(geom.vertices.size());
+		for (auto const& vertex : geom.vertices) { vertices.push_back(packing::quantize(vertex, dequantize)); }
+		construct<QuantizedVertex>(vertices, geom.indices);
+		m_bounds = bounds;
+		m_dequantize = dequantize;
+		break;
+	}
+	default: construct(geom); break;
+	}
+	m_format = format;
+}
+
+bool MeshPrimitive::valid() const noexcept { return static_cast<bool>(m_vbo.alloc); }
 
 bool MeshPrimitive::busy() const {
 	if (!valid() || m_type == Type::eDynamic) { return false; }
@@ -43,20 +94,38 @@ void MeshPrimitive::exchg(MeshPrimitive& lhs, MeshPrimitive& rhs) noexcept {
 	std::swap(lhs.m_ibo, rhs.m_ibo);
 	std::swap(lhs.m_type, rhs.m_type);
 	std::swap(lhs.m_triCount, rhs.m_triCount);
+	std::swap(lhs.m_stride, rhs.m_stride);
+	std::swap(lhs.m_format, rhs.m_format);
+	std::swap(lhs.m_dequantize, rhs.m_dequantize);
+	std::swap(lhs.m_bounds, rhs.m_bounds);
+	std::swap(lhs.m_meshlets, rhs.m_meshlets);
 	std::swap(lhs.m_vram, rhs.m_vram);
 	std::swap(lhs.m_material, rhs.m_material);
 }
 
-MeshPrimitive::Storage MeshPrimitive::construct(vk::BufferUsageFlags usage, void* pData, std::size_t size) const {
+MeshPrimitive::Storage MeshPrimitive::construct(void const* pData, std::size_t size, std::size_t alignment) const {
 	Storage ret;
-	ret.buffer = m_vram->makeBuffer(size, usage, m_type == Type::eDynamic);
-	ENSURE(ret.buffer.has_value(), "Invalid buffer");
-	if (m_type == Type::eStatic) {
-		ret.transfer = m_vram->stage(*ret.buffer, pData, size);
+	auto& arena = m_vram->geometry();
+	bool const dynamic = m_type == Type::eDynamic;
+	ret.alloc = arena.allocate(dynamic ? GeometryArena::Type::eDynamic : GeometryArena::Type::eStatic, size, alignment);
+	ENSURE(ret.alloc, "Invalid buffer");
+	if (!dynamic) {
+		ret.transfer = arena.stage(ret.alloc, pData, size);
 	} else {
-		[[maybe_unused]] bool const bRes = ret.buffer->write(pData, size);
+		[[maybe_unused]] bool const bRes = arena.write(ret.alloc, pData, size);
 		ENSURE(bRes, "Write failure");
 	}
 	return ret;
 }
+
+void MeshPrimitive::release() {
+	// regions may still be referenced by in-flight frames
+	for (auto* storage : {&m_vbo, &m_ibo}) {
+		if (storage->alloc) {
+			m_vram->m_device->defer([arena = &m_vram->geometry(), alloc = storage->alloc]() { arena->release(alloc); });
+		}
+		*storage = {};
+	}
+	m_triCount = m_stride = 0;
+}
 } // namespace le::graphics
@@ -0,0 +1,114 @@
+#include <glm/geometric.hpp>
+#include <levk/graphics/meshlet.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace le::graphics {
+namespace {
+constexpr u32 invalid_v = std::numeric_limits<u32>::max();
+// cones wider than ~84 degrees cull too rarely to be worth testing
+constexpr f32 min_cone_cos_v = 0.1f;
+
+Meshlet makeMeshlet(Span<glm::vec3 const> positions, Span<u32 const> indices, u32 firstIndex, u32 indexCount) {
+	Meshlet ret{firstIndex, indexCount};
+	AABB aabb;
+	for (u32 i = firstIndex; i < firstIndex + indexCount; ++i) { aabb.add(positions[indices[i]]); }
+	ret.centre = aabb.centre();
+	for (u32 i = firstIndex; i < firstIndex + indexCount; ++i) { ret.radius = std::max(ret.radius, glm::length(positions[indices[i]] - ret.centre)); }
+	std::vector<glm::vec3> normals;
+	normals.reserve(indexCount / 3U);
+	glm::vec3 axis{};
+	for (u32 i = firstIndex; i < firstIndex + indexCount; i += 3U) {
+		auto const& a = positions[indices[i]];
+		auto const normal = glm::cross(positions[indices[i + 1U]] - a, positions[indices[i + 2U]] - a);
+		// degenerate triangles are never visible
+		if (f32 const length = glm::length(normal); length > 0.0f) {
+			normals.push_back(normal / length);
+			axis += normals.back();
+		}
+	}
+	f32 const length = glm::length(axis);
+	if (length <= 0.0f) { return ret; }
+	ret.coneAxis = axis / length;
+	f32 minCos = 1.0f;
+	for (auto const& normal : normals) { minCos = std::min(minCos, glm::dot(normal, ret.coneAxis)); }
+	// backfacing for all normals when the view direction is within (90 - half angle) of the axis: cos(90 - a) = sin(a)
+	if (minCos > min_cone_cos_v) { ret.coneCutoff = std::sqrt(1.0f - minCos * minCos); }
+	return ret;
+}
+
+f32 maxScale(glm::mat4 const& mat) noexcept {
+	return std::max({glm::length(glm::vec3(mat[0])), glm::length(glm::vec3(mat[1])), glm::length(glm::vec3(mat[2]))});
+}
+
+bool uniformScale(glm::mat4 const& mat) noexcept {
+	f32 const x = glm::length(glm::vec3(mat[0])), y = glm::length(glm::vec3(mat[1])), z = glm::length(glm::vec3(mat[2]));
+	f32 const max = std::max({x, y, z}), min = std::min({x, y, z});
+	return max > 0.0f && max - min <= max * 1e-3f;
+}
+} // namespace
+
+std::vector<Meshlet> MeshletBuilder::operator()(Span<glm::vec3 const> positions, Span<u32 const> indices) const {
+	if (indices.empty() || indices.size() % 3U != 0U) { return {}; }
+	if (std::any_of(indices.begin(), indices.end(), [count = positions.size()](u32 i) { return i >= count; })) { return {}; }
+	u32 const vertexLimit = std::max(maxVertices, 3U);
+	u32 const triangleLimit = std::max(maxTriangles, 1U);
+	std::vector<Meshlet> ret;
+	// meshlet that last referenced each vertex
+	std::vector<u32> owners(positions.size(), invalid_v);
+	u32 id{}, begin{}, vertices{}, triangles{};
+	// vertices of triangle i not yet in the current meshlet
+	auto const fresh = [&](u32 i) {
+		u32 count{};
+		for (u32 k = 0; k < 3U; ++k) {
+			u32 const vertex = indices[i + k];
+			bool const repeat = (k > 0U && indices[i] == vertex) || (k > 1U && indices[i + 1U] == vertex);
+			if (owners[vertex] != id && !repeat) { ++count; }
+		}
+		return count;
+	};
+	for (u32 i = 0; i < u32(indices.size()); i += 3U) {
+		auto count = fresh(i);
+		if (triangles > 0U && (vertices + count > vertexLimit || triangles >= triangleLimit)) {
+			ret.push_back(makeMeshlet(positions, indices, begin, i - begin));
+			++id;
+			begin = i;
+			vertices = triangles = 0U;
+			count = fresh(i);
+		}
+		for (u32 k = 0; k < 3U; ++k) { owners[indices[i + k]] = id; }
+		vertices += count;
+		++triangles;
+	}
+	ret.push_back(makeMeshlet(positions, indices, begin, u32(indices.size()) - begin));
+	return ret;
+}
+
+bool ClusterCuller::visible(Meshlet const& meshlet, glm::mat4 const& model) const noexcept {
+	glm::vec3 const centre = model * glm::vec4(meshlet.centre, 1.0f);
+	f32 const radius = meshlet.radius * maxScale(model);
+	if (!frustum.intersects(centre, radius)) { return false; }
+	// normal cones do not survive non uniform scaling
+	if (!eye || meshlet.coneCutoff >= 1.0f || !uniformScale(model)) { return true; }
+	auto const axis = glm::normalize(glm::vec3(model * glm::vec4(meshlet.coneAxis, 0.0f)));
+	auto const view = centre - *eye;
+	return glm::dot(view, axis) < meshlet.coneCutoff * glm::length(view) + radius;
+}
+
+u32 ClusterCuller::operator()(Span<Meshlet const> meshlets, Span<glm::mat4 const> instances, std::vector<Range>& out_ranges) const {
+	u32 ret{};
+	for (auto const& meshlet : meshlets) {
+		if (std::none_of(instances.begin(), instances.end(), [&](glm::mat4 const& model) { return visible(meshlet, model); })) { continue; }
+		++ret;
+		if (!out_ranges.empty() && out_ranges.back().firstIndex + out_ranges.back().indexCount == meshlet.firstIndex) {
+			out_ranges.back().indexCount += meshlet.indexCount;
+		} else {
+			out_ranges.push_back({meshlet.firstIndex, meshlet.indexCount});
+		}
+	}
+	s_visible.fetch_add(ret);
+	s_culled.fetch_add(u32(meshlets.size()) - ret);
+	return ret;
+}
+} // namespace le::graphics
@@ -0,0 +1,97 @@
+#include <glm/gtc/packing.hpp>
+#include <levk/graphics/packed_vertex.hpp>
+#include <levk/graphics/render/context.hpp>
+#include <levk/graphics/utils/utils.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace le::graphics {
+namespace {
+constexpr f32 snorm16_v = 32767.0f;
+
+constexpr f32 signNotZero(f32 value) noexcept { return value >= 0.0f ? 1.0f : -1.0f; }
+} // namespace
+
+Dequantize Dequantize::make(AABB const& bounds) noexcept {
+	if (!bounds.valid()) { return {}; }
+	Dequantize ret;
+	// avoid division by zero for flat meshes
+	auto const extent = glm::max(bounds.halfExtent(), glm::vec3(1e-6f));
+	ret.offset = glm::vec4(bounds.centre(), 0.0f);
+	ret.scale = glm::vec4(extent, 1.0f);
+	return ret;
+}
+
+u32 packing::colour(glm::vec4 const& colour) noexcept { return glm::packUnorm4x8(colour); }
+
+u32 packing::normal(glm::vec3 const& normal) noexcept {
+	f32 const sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+	if (sum <= 0.0f) { return glm::packSnorm2x16(glm::vec2(0.0f)); }
+	glm::vec2 ret = glm::vec2(normal.x, normal.y) / sum;
+	// fold lower hemisphere over the diagonals
+	if (normal.z < 0.0f) { ret = (1.0f - glm::abs(glm::vec2(ret.y, ret.x))) * glm::vec2(signNotZero(ret.x), signNotZero(ret.y)); }
+	return glm::packSnorm2x16(ret);
+}
+
+glm::vec3 packing::unpackNormal(u32 packed) noexcept {
+	auto const oct = glm::unpackSnorm2x16(packed);
+	glm::vec3 ret(oct.x, oct.y, 1.0f - std::abs(oct.x) - std::abs(oct.y));
+	f32 const t = std::max(-ret.z, 0.0f);
+	ret.x += ret.x >= 0.0f ? -t : t;
+	ret.y += ret.y >= 0.0f ? -t : t;
+	return glm::normalize(ret);
+}
+
+u32 packing::texCoord(glm::vec2 const& uv) noexcept { return glm::packHalf2x16(uv); }
+
+std::array<s16, 4> packing::position(glm::vec3 const& position, Dequantize const& dequantize) noexcept {
+	auto const normalised = glm::clamp((position - glm::vec3(dequantize.offset)) / glm::vec3(dequantize.scale), -1.0f, 1.0f);
+	auto const quantize = [](f32 value) { return s16(std::lround(value * snorm16_v)); };
+	return {quantize(normalised.x), quantize(normalised.y), quantize(normalised.z), 0};
+}
+
+glm::vec3 packing::unpackPosition(std::array<s16, 4> const& packed, Dequantize const& dequantize) noexcept {
+	// matches Vulkan SNORM conversion
+	auto const unpack = [](s16 value) { return std::max(f32(value) / snorm16_v, -1.0f); };
+	glm::vec3 const normalised(unpack(packed[0]), unpack(packed[1]), unpack(packed[2]));
+	return normalised * glm::vec3(dequantize.scale) + glm::vec3(dequantize.offset);
+}
+
+CompactVertex packing::compact(Vertex const& vertex) noexcept {
+	return {vertex.position, colour(vertex.colour), normal(vertex.normal), texCoord(vertex.texCoord)};
+}
+
+QuantizedVertex packing::quantize(Vertex const& vertex, Dequantize const& dequantize) noexcept {
+	return {position(vertex.position, dequantize), colour(vertex.colour), normal(vertex.normal), texCoord(vertex.texCoord)};
+}
+
+VertexInputInfo VertexInfoFactory<CompactVertex>::operator()(u32 binding) const {
+	QuickVertexInput qvi;
+	qvi.binding = binding;
+	qvi.size = sizeof(CompactVertex);
+	qvi.attributes = {{vk::Format::eR32G32B32Sfloat, offsetof(CompactVertex, position)},
+					  {vk::Format::eR8G8B8A8Unorm, offsetof(CompactVertex, colour)},
+					  {vk::Format::eR16G16Snorm, offsetof(CompactVertex, normal)},
+					  {vk::Format::eR16G16Sfloat, offsetof(CompactVertex, texCoord)}};
+	return RenderContext::vertexInput(qvi);
+}
+
+VertexInputInfo VertexInfoFactory<QuantizedVertex>::operator()(u32 binding) const {
+	QuickVertexInput qvi;
+	qvi.binding = binding;
+	qvi.size = sizeof(QuantizedVertex);
+	qvi.attributes = {{vk::Format::eR16G16B16A16Snorm, offsetof(QuantizedVertex, position)},
+					  {vk::Format::eR8G8B8A8Unorm, offsetof(QuantizedVertex, colour)},
+					  {vk::Format::eR16G16Snorm, offsetof(QuantizedVertex, normal)},
+					  {vk::Format::eR16G16Sfloat, offsetof(QuantizedVertex, texCoord)}};
+	return RenderContext::vertexInput(qvi);
+}
+
+VertexInputInfo vertexInput(VertexFormat format, u32 binding) {
+	switch (format) {
+	case VertexFormat::eCompact: return VertexInfoFactory<CompactVertex>{}(binding);
+	case VertexFormat::eQuantized: return VertexInfoFactory<QuantizedVertex>{}(binding);
+	default: return VertexInfoFactory<Vertex>{}(binding);
+	}
+}
+} // namespace le::graphics
@@ -0,0 +1,115 @@
+#include <levk/core/log_channel.hpp>
+#include <levk/core/utils/expect.hpp>
+#include <levk/graphics/command_buffer.hpp>
+#include <levk/graphics/device/vram.hpp>
+#include <levk/graphics/render/bindless_textures.hpp>
+#include <levk/graphics/texture.hpp>
+#include <algorithm>
+
+namespace le::graphics {
+namespace {
+constexpr auto stages_v = vk::ShaderStageFlagBits::eFragment;
+} // namespace
+
+bool BindlessTextures::supported(Device const& device) noexcept {
+	if (!device.descriptorIndexing()) { return false; }
+	auto const& limits = device.limits();
+	auto const limit = std::min({limits.maxPerStageDescriptorSamplers, limits.maxPerStageDescriptorSampledImages, limits.maxDescriptorSetSamplers,
+								 limits.maxDescriptorSetSampledImages});
+	// leave room for regular sampler bindings in other sets
+	return limit >= capacity_v + 16U;
+}
+
+bool BindlessTextures::matches(vk::DescriptorSetLayoutBinding const& binding) noexcept {
+	return binding.binding == 0U && binding.descriptorType == vk::DescriptorType::eCombinedImageSampler && binding.descriptorCount == capacity_v;
+}
+
+BindlessTextures::BindlessTextures(not_null<VRAM*> vram, Buffering buffering)
+	: m_writer(vram->m_device), m_vram(vram), m_sampler(vram->m_device, Sampler::MinMag{vk::Filter::eNearest, vk::Filter::eNearest}),
+	  m_fallback(vram, m_sampler.sampler(), colours::magenta, {1U, 1U}) {
+	EXPECT(supported(*vram->m_device));
+	auto const device = vram->m_device;
+	vk::DescriptorSetLayoutBinding binding(0U, vk::DescriptorType::eCombinedImageSampler, capacity_v, stages_v);
+	// unregistered elements are never indexed
+	vk::DescriptorBindingFlagsEXT const flags = vk::DescriptorBindingFlagBitsEXT::ePartiallyBound;
+	m_layout = m_layout.make(device->makeDescriptorSetLayout(binding, flags), device);
+	u32 const count = std::max(u32(buffering), 1U);
+	vk::DescriptorPoolSize const size(vk::DescriptorType::eCombinedImageSampler, capacity_v * count);
+	m_pool = m_pool.make(device->makeDescriptorPool(size, count), device);
+	std::vector<vk::DescriptorSetLayout> const layouts(count, m_layout);
+	m_sets = device->allocateDescriptorSets(m_pool, layouts, count);
+	m_slots.reserve(capacity_v);
+	// descriptors are written (for all sets) in the first update(): the fallback must be resident by then
+	m_fallback.wait();
+	m_slots.push_back({m_fallback.image().view(), m_fallback.sampler(), (1U << count) - 1U});
+}
+
+std::optional<u32> BindlessTextures::index(Texture const& texture) {
+	if (!texture.ready() || texture.type() != Texture::Type::e2D) { return std::nullopt; }
+	auto const view = texture.image().view();
+	auto const sampler = texture.sampler();
+	u32 const all = (1U << m_sets.size()) - 1U;
+	if (auto it = m_indices.find(&texture); it != m_indices.end()) {
+		auto& slot = m_slots[it->second];
+		// texture was reconstructed or reassigned: rewrite all sets
+		if (slot.view != view || slot.sampler != sampler) {
+			slot.view = view;
+			slot.sampler = sampler;
+			slot.pending = all;
+		}
+		return it->second;
+	}
+	u32 ret{};
+	if (!m_free.empty()) {
+		ret = m_free.back();
+		m_free.pop_back();
+	} else if (m_slots.size() < capacity_v) {
+		ret = u32(m_slots.size());
+		m_slots.emplace_back();
+	} else {
+		logW(LC_LibUser, "[{}] Bindless texture array full [{}]", g_name, capacity_v);
+		return std::nullopt;
+	}
+	auto& slot = m_slots[ret];
+	slot = {view, sampler, all, texture.onDestroy()};
+	slot.onDestroy += [this, tex = &texture]() { release(tex); };
+	m_indices.emplace(&texture, ret);
+	return ret;
+}
+
+void BindlessTextures::update() {
+	u32 const bit = 1U << m_index;
+	auto const set = m_sets[m_index];
+	for (std::size_t i = 0; i < m_slots.size();) {
+		if ((m_slots[i].pending & bit) == 0U) {
+			++i;
+			continue;
+		}
+		// coalesce runs of contiguous pending slots into single writes
+		std::size_t end = i + 1;
+		while (end < m_slots.size() && (m_slots[end].pending & bit)) { ++end; }
+		auto infos = m_writer.images(set, 0U, vk::DescriptorType::eCombinedImageSampler, u32(end - i), u32(i));
+		for (; i < end; ++i) {
+			m_slots[i].pending &= ~bit;
+			*infos++ = vk::DescriptorImageInfo(m_slots[i].sampler, m_slots[i].view, vk::ImageLayout::eShaderReadOnlyOptimal);
+		}
+	}
+	m_writer.flush();
+}
+
+void BindlessTextures::release(Texture const* texture) {
+	auto const it = m_indices.find(texture);
+	if (it == m_indices.end()) { return; }
+	auto& slot = m_slots[it->second];
+	// the view is destroyed with the texture: stale indices sample the fallback instead (the signal is being fired, leave it be)
+	slot.view = m_fallback.image().view();
+	slot.sampler = m_fallback.sampler();
+	slot.pending = (1U << m_sets.size()) - 1U;
+	m_free.push_back(it->second);
+	m_indices.erase(it);
+}
+
+void BindlessTextures::next() noexcept { m_index = (m_index + 1U) % u32(m_sets.size()); }
+
+void BindlessTextures::bind(CommandBuffer const& cb, vk::PipelineLayout layout, u32 setNumber) const { cb.bindSets(layout, set(), setNumber); }
+} // namespace le::graphics
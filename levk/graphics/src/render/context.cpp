@@ -9,8 +9,10 @@
 #include <levk/graphics/device/vram.hpp>
 #include <levk/graphics/render/context.hpp>
 #include <levk/graphics/utils/utils.hpp>
+#include <algorithm>
 #include <map>
 #include <stdexcept>
+#include <thread>
 
 namespace le::graphics {
 namespace {
@@ -26,6 +28,8 @@ std::unique_ptr<Renderer> makeRenderer(VRAM* vram, Surface::Format const& format
 	rci.buffering = buffering;
 	rci.surfaceBlitFlags = bf;
 	rci.target = Renderer::Target::eOffScreen;
+	// one secondary command buffer (and pool) per worker thread for parallel recording
+	rci.secondaryCmds = u8(std::clamp(std::thread::hardware_concurrency(), 1U, u32(max_secondary_cmd_v)));
 	return std::make_unique<Renderer>(rci);
 }
 } // namespace
@@ -82,10 +86,10 @@ VertexInputInfo RenderContext::vertexInput(QuickVertexInput const& info) {
 	return ret;
 }
 
-RenderContext::RenderContext(not_null<VRAM*> vram, GetSpirV&& gs, std::optional<VSync> vsync, Extent2D fbSize, Buffering bf)
-	: m_surface(vram, fbSize, vsync), m_pipelineFactory(vram, std::move(gs), bf), m_vram(vram),
-	  m_renderer(makeRenderer(m_vram, m_surface.format(), m_surface.blitFlags(), bf)), m_buffering(bf) {
-	m_pipelineCache = m_pipelineCache.make(m_vram->m_device->makePipelineCache(), m_vram->m_device);
+RenderContext::RenderContext(not_null<VRAM*> vram, GetSpirV&& gs, std::optional<VSync> vsync, Extent2D fbSize, Buffering bf,
+							 Span<std::byte const> pipelineCache)
+	: m_surface(vram, fbSize, vsync), m_pipelineFactory(vram, std::move(gs), bf, pipelineCache), m_vram(vram),
+	  m_renderer(makeRenderer(m_vram, m_surface.format(), m_surface.blitFlags(), bf)), m_buffering(bf), m_surfaceGeneration(m_surface.generation()) {
 	validateBuffering(Buffering{m_surface.imageCount()}, m_buffering);
 	DeferQueue::defaultDefer = m_buffering;
 	for (Buffering i = {}; i < m_buffering; ++i) { m_syncs.push(Sync::make(m_vram->m_device)); }
@@ -96,6 +100,7 @@ std::unique_ptr<Renderer> RenderContext::defaultRenderer() { return makeRenderer
 void RenderContext::setRenderer(std::unique_ptr<Renderer>&& renderer) noexcept {
 	m_vram->m_device->waitIdle();
 	m_renderer = std::move(renderer);
+	m_surfaceGeneration = m_surface.generation();
 }
 
 std::optional<RenderPass> RenderContext::beginMainPass(RenderBegin const& rb, Extent2D fbSize) {
@@ -104,6 +109,10 @@ std::optional<RenderPass> RenderContext::beginMainPass(RenderBegin const& rb, Ex
 	if (auto acquired = m_surface.acquireNextImage(fbSize, sync.draw)) {
 		m_acquired = *acquired;
 		m_vram->m_device->resetFence(sync.drawn, true);
+		if (m_surface.generation() != m_surfaceGeneration) {
+			m_renderer->invalidateFramebuffers();
+			m_surfaceGeneration = m_surface.generation();
+		}
 		return m_renderer->beginMainPass(m_pipelineFactory, m_acquired->image, rb);
 	}
 	return std::nullopt;
@@ -117,6 +126,8 @@ bool RenderContext::endMainPass(RenderPass& out_rp, Extent2D fbSize) {
 		m_acquired.reset();
 	}
 	m_vram->m_device->decrementDeferred();
+	m_pipelineFactory.uniforms().next();
+	if (auto bindless = m_pipelineFactory.bindless()) { bindless->next(); }
 	m_syncs.next();
 	return ret;
 }
@@ -1,9 +1,36 @@
 #include <levk/core/utils/enumerate.hpp>
 #include <levk/graphics/render/descriptor_set.hpp>
 #include <algorithm>
+#include <cstring>
 
 namespace le::graphics {
-DescriptorSet::DescriptorSet(not_null<VRAM*> vram, CreateInfo const& info) : m_vram(vram) {
+namespace {
+struct Fnv {
+	u64 value = 14695981039346656037ULL;
+
+	template <typename T>
+	Fnv& operator<<(T const& t) noexcept {
+		static_assert(std::is_trivially_copyable_v<T>);
+		std::byte bytes[sizeof(T)];
+		std::memcpy(bytes, &t, sizeof(T));
+		for (auto const byte : bytes) { value = (value ^ u64(byte)) * 1099511628211ULL; }
+		return *this;
+	}
+};
+} // namespace
+
+bool DescriptorSet::Binding::elide(u64 const contentHash) noexcept {
+	auto const now = Device::s_destroyEpoch.load();
+	if (hash == contentHash && epoch == now) {
+		s_skipped.fetch_add(1);
+		return true;
+	}
+	hash = contentHash;
+	epoch = now;
+	return false;
+}
+
+DescriptorSet::DescriptorSet(not_null<VRAM*> vram, CreateInfo const& info) : m_uniforms(info.uniforms), m_writer(info.writer), m_vram(vram) {
 	m_setNumber = info.setNumber;
 	bool active = false;
 	for (auto const& data : info.bindingData) {
@@ -13,11 +40,19 @@ DescriptorSet::DescriptorSet(not_null<VRAM*> vram, CreateInfo const& info) : m_v
 	if (active) {
 		for (auto const dset : info.descriptorSets) {
 			Set set;
+			u32 dynamicCount = 0;
 			for (auto const& [data, idx] : le::utils::enumerate(m_bindingData)) {
 				if (data.layoutBinding.descriptorType != vk::DescriptorType()) {
-					set.bindings[idx] = {data.layoutBinding.descriptorType, data.textureType, data.layoutBinding.descriptorCount};
+					auto& binding = set.bindings[idx];
+					binding = {data.layoutBinding.descriptorType, data.textureType, data.layoutBinding.descriptorCount};
+					// dynamic offsets are consumed in binding order, one per array element
+					if (dynamic(binding.type)) {
+						binding.dynamicIndex = dynamicCount;
+						dynamicCount += binding.count;
+					}
 				}
 			}
+			set.offsets.resize(dynamicCount, 0U);
 			set.set = dset;
 			m_sets.emplace(std::move(set));
 		}
@@ -32,36 +67,82 @@ void DescriptorSet::updateBuffers(u32 binding, Span<Buf const> buffers) {
 void DescriptorSet::updateImages(u32 binding, Span<Img const> images) {
 	static auto const s_type = vk::DescriptorType::eCombinedImageSampler;
 	auto [set, bind] = setBind(binding, (u32)images.size(), &s_type);
-	std::vector<vk::DescriptorImageInfo> imageInfos;
-	imageInfos.reserve(images.size());
-	for (auto const& img : images) {
-		vk::DescriptorImageInfo imageInfo;
-		imageInfo.imageView = img.image;
-		imageInfo.imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
-		imageInfo.sampler = img.sampler;
-		imageInfos.push_back(imageInfo);
-	}
-	update<vk::DescriptorImageInfo>(binding, bind.type, imageInfos);
+	Fnv hash;
+	for (auto const& img : images) { hash << img.image << img.sampler; }
+	if (bind.elide(hash.value)) { return; }
+	write([&](DescriptorWriter& writer) {
+		auto infos = writer.images(set.set, binding, bind.type, (u32)images.size());
+		for (auto const& img : images) { *infos++ = vk::DescriptorImageInfo(img.sampler, img.image, vk::ImageLayout::eShaderReadOnlyOptimal); }
+	});
 }
 
 bool DescriptorSet::contains(u32 bind, vk::DescriptorType const* type, Texture::Type const* texType) const noexcept {
+	// dynamic bindings accept the same writes as their static counterparts
+	static constexpr auto stat = [](vk::DescriptorType type) {
+		if (type == vk::DescriptorType::eUniformBufferDynamic) { return vk::DescriptorType::eUniformBuffer; }
+		if (type == vk::DescriptorType::eStorageBufferDynamic) { return vk::DescriptorType::eStorageBuffer; }
+		return type;
+	};
 	auto const ret = binding(bind);
 	if (ret.layoutBinding == vk::DescriptorSetLayoutBinding()) { return false; }
-	if (type && ret.layoutBinding.descriptorType != *type) { return false; }
+	if (type && stat(ret.layoutBinding.descriptorType) != stat(*type)) { return false; }
 	if (texType && ret.textureType != *texType) { return false; }
 	return true;
 }
 
 void DescriptorSet::updateBuffersImpl(u32 binding, Span<Buf const> buffers, vk::DescriptorType type) {
-	std::vector<vk::DescriptorBufferInfo> bufferInfos;
-	for (auto const& buf : buffers) {
-		vk::DescriptorBufferInfo bufferInfo;
-		bufferInfo.buffer = buf.buffer;
-		bufferInfo.offset = 0;
-		bufferInfo.range = buf.size;
-		bufferInfos.push_back(bufferInfo);
+	auto& set = m_sets.get();
+	auto& bind = set.bindings[binding];
+	EXPECT(bind.type == type);
+	// bound directly: no suballocation offsets
+	if (dynamic(bind.type)) { std::fill_n(set.offsets.begin() + bind.dynamicIndex, bind.count, 0U); }
+	writeBuffers(binding, buffers);
+}
+
+void DescriptorSet::writeElements(u32 binding, Span<bytearray const> elements) {
+	auto [_, b] = setBind(binding, u32(elements.size()));
+	ENSURE(m_uniforms && dynamic(b.type), "Binding not suballocated");
+	std::size_t range{};
+	for (auto const& element : elements) { range = std::max(range, element.size()); }
+	std::vector<UniformAllocator::Alloc> allocs;
+	allocs.reserve(elements.size());
+	for (auto const& element : elements) { allocs.push_back(m_uniforms->write(element.data(), element.size(), range)); }
+	updateDynamic(binding, allocs, range);
+}
+
+void DescriptorSet::updateDynamic(u32 binding, Span<UniformAllocator::Alloc const> allocs, std::size_t range) {
+	auto& set = m_sets.get();
+	auto& bind = set.bindings[binding];
+	EXPECT(allocs.size() == bind.count);
+	std::vector<Buf> bufs;
+	bufs.reserve(allocs.size());
+	for (auto const& alloc : allocs) { bufs.push_back({alloc.buffer, range}); }
+	// elided unless the allocator's buffer was replaced (or the range changed)
+	writeBuffers(binding, bufs);
+	for (auto const& [alloc, idx] : le::utils::enumerate(allocs)) { set.offsets[bind.dynamicIndex + idx] = alloc.offset; }
+}
+
+void DescriptorSet::writeBuffers(u32 binding, Span<Buf const> buffers) {
+	auto& set = m_sets.get();
+	auto& bind = set.bindings[binding];
+	Fnv hash;
+	for (auto const& buf : buffers) { hash << buf.buffer << buf.size; }
+	if (bind.elide(hash.value)) { return; }
+	write([&](DescriptorWriter& writer) {
+		auto infos = writer.buffers(set.set, binding, bind.type, (u32)buffers.size());
+		for (auto const& buf : buffers) { *infos++ = vk::DescriptorBufferInfo(buf.buffer, 0, buf.size); }
+	});
+}
+
+template <typename F>
+void DescriptorSet::write(F&& fill) {
+	if (m_writer && m_writer->deferred()) {
+		fill(*m_writer);
+	} else {
+		DescriptorWriter writer(m_vram->m_device);
+		fill(writer);
+		writer.flush();
 	}
-	update<vk::DescriptorBufferInfo>(binding, type, bufferInfos);
 }
 
 auto DescriptorSet::setBind(u32 bind, u32 count, vk::DescriptorType const* type) -> std::pair<Set&, Binding&> {
@@ -115,6 +196,8 @@ void DescriptorPool::makeSets() const {
 		DescriptorSet::CreateInfo dci;
 		dci.descriptorSets = span;
 		dci.bindingData = m_info.bindingData;
+		dci.uniforms = m_info.uniforms;
+		dci.writer = m_info.writer;
 		dci.setNumber = m_info.setNumber;
 		m_sets.push_back(DescriptorSet(m_vram, dci));
 		for (u32 i = 0; i < count; ++i) { sets.pop_back(); }
@@ -0,0 +1,51 @@
+#include <levk/graphics/device/device.hpp>
+#include <levk/graphics/render/descriptor_writer.hpp>
+
+namespace le::graphics {
+vk::DescriptorBufferInfo* DescriptorWriter::buffers(vk::DescriptorSet set, u32 binding, vk::DescriptorType type, u32 count, u32 first) {
+	push(set, binding, type, count, first, m_buffers.size());
+	m_buffers.resize(m_buffers.size() + count);
+	return m_buffers.data() + m_buffers.size() - count;
+}
+
+vk::DescriptorImageInfo* DescriptorWriter::images(vk::DescriptorSet set, u32 binding, vk::DescriptorType type, u32 count, u32 first) {
+	push(set, binding, type, count, first, m_images.size());
+	m_images.resize(m_images.size() + count);
+	return m_images.data() + m_images.size() - count;
+}
+
+std::size_t DescriptorWriter::flush() {
+	m_deferred = false;
+	if (m_writes.empty()) { return 0; }
+	for (std::size_t i = 0; i < m_writes.size(); ++i) {
+		auto& write = m_writes[i];
+		if (write.descriptorType == vk::DescriptorType::eCombinedImageSampler || write.descriptorType == vk::DescriptorType::eSampledImage ||
+			write.descriptorType == vk::DescriptorType::eStorageImage || write.descriptorType == vk::DescriptorType::eSampler) {
+			write.pImageInfo = m_images.data() + m_firsts[i];
+		} else {
+			write.pBufferInfo = m_buffers.data() + m_firsts[i];
+		}
+	}
+	m_device->device().updateDescriptorSets(m_writes, {});
+	s_updates.fetch_add(1);
+	s_writes.fetch_add(u32(m_writes.size()));
+	auto const ret = m_writes.size();
+	// storage is retained: no allocations in steady state
+	m_writes.clear();
+	m_buffers.clear();
+	m_images.clear();
+	m_firsts.clear();
+	return ret;
+}
+
+void DescriptorWriter::push(vk::DescriptorSet set, u32 binding, vk::DescriptorType type, u32 count, u32 element, std::size_t first) {
+	vk::WriteDescriptorSet write;
+	write.dstSet = set;
+	write.dstBinding = binding;
+	write.dstArrayElement = element;
+	write.descriptorType = type;
+	write.descriptorCount = count;
+	m_firsts.push_back(first);
+	m_writes.push_back(write);
+}
+} // namespace le::graphics
@@ -1,8 +1,21 @@
+#include <ktl/fixed_vector.hpp>
 #include <levk/core/utils/expect.hpp>
 #include <levk/graphics/render/draw_list.hpp>
 #include <levk/graphics/render/pipeline.hpp>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
 
 namespace le::graphics {
+namespace {
+bool same(DrawPrimitive const& lhs, DrawPrimitive const& rhs) noexcept {
+	return lhs.primitive == rhs.primitive && lhs.blinnPhong == rhs.blinnPhong && lhs.pbr == rhs.pbr &&
+		   std::equal(std::begin(lhs.textures.arr), std::end(lhs.textures.arr), std::begin(rhs.textures.arr));
+}
+
+void combine(std::size_t& out_hash, void const* ptr) noexcept { out_hash ^= std::hash<void const*>{}(ptr) + 0x9e3779b9 + (out_hash << 6) + (out_hash >> 2); }
+} // namespace
+
 DrawList& DrawList::push(Span<DrawPrimitive const> primitives, glm::mat4 matrix, std::optional<vk::Rect2D> scissor) {
 	std::size_t const start = m_drawPrimitives.size();
 	m_drawPrimitives.reserve(start + m_drawPrimitives.size());
@@ -10,28 +23,93 @@ DrawList& DrawList::push(Span<DrawPrimitive const> primitives, glm::mat4 matrix,
 	return push(start, matrix, scissor);
 }
 
+DrawList& DrawList::batch() {
+	if (m_entries.size() < 2U) { return *this; }
+	// group entries by first occurrence, preserving relative order within (and between) groups
+	std::vector<std::vector<std::size_t>> groups;
+	std::unordered_map<std::size_t, ktl::fixed_vector<std::size_t, 4>> buckets;
+	for (std::size_t i = 0; i < m_entries.size(); ++i) {
+		auto& bucket = buckets[hash(m_entries[i])];
+		auto const match = [&](std::size_t group) { return instanceable(m_entries[groups[group].front()], m_entries[i]); };
+		if (auto it = std::find_if(bucket.begin(), bucket.end(), match); it != bucket.end()) {
+			groups[*it].push_back(i);
+		} else {
+			if (bucket.has_space()) { bucket.push_back(groups.size()); }
+			groups.push_back({i});
+		}
+	}
+	if (groups.size() == m_entries.size()) { return *this; }
+	std::vector<glm::mat4> matrices;
+	std::vector<Entry> entries;
+	matrices.reserve(m_matrices.size());
+	entries.reserve(groups.size());
+	for (auto const& group : groups) {
+		Entry entry = m_entries[group.front()];
+		entry.matrices.first = matrices.size();
+		for (auto const index : group) {
+			auto const& [start, count] = m_entries[index].matrices;
+			std::copy(m_matrices.begin() + std::ptrdiff_t(start), m_matrices.begin() + std::ptrdiff_t(start + count), std::back_inserter(matrices));
+		}
+		entry.matrices.second = matrices.size() - entry.matrices.first;
+		entries.push_back(entry);
+	}
+	m_matrices = std::move(matrices);
+	m_entries = std::move(entries);
+	m_entryBindings.resize(m_entries.size());
+	return *this;
+}
+
 void DrawList::clear() noexcept {
 	m_matrices.clear();
 	m_drawPrimitives.clear();
 	m_scissors.clear();
 	m_entries.clear();
+	m_entryBindings.clear();
 }
 
 DrawList& DrawList::push(std::size_t primitiveStart, glm::mat4 matrix, std::optional<vk::Rect2D> scissor) {
 	if (primitiveStart >= m_drawPrimitives.size()) { return *this; }
 	Entry entry;
 	entry.primitives = {primitiveStart, m_drawPrimitives.size() - primitiveStart};
-	entry.matrix = m_matrices.size();
+	entry.matrices = {m_matrices.size(), 1U};
 	m_matrices.push_back(matrix);
 	if (scissor) {
 		entry.scissor = m_scissors.size();
 		m_scissors.push_back(*scissor);
 	}
+	if (!m_entries.empty() && m_entries.back().matrices.first + m_entries.back().matrices.second == entry.matrices.first &&
+		instanceable(m_entries.back(), entry)) {
+		// consecutive run: extend previous entry's instances and drop duplicate primitives / scissor
+		++m_entries.back().matrices.second;
+		m_drawPrimitives.resize(primitiveStart);
+		if (entry.scissor) { m_scissors.pop_back(); }
+		return *this;
+	}
 	m_entries.push_back(entry);
 	m_entryBindings.push_back({});
 	return *this;
 }
 
+bool DrawList::instanceable(Entry const& lhs, Entry const& rhs) const noexcept {
+	if (lhs.primitives.second != rhs.primitives.second || lhs.scissor.has_value() != rhs.scissor.has_value()) { return false; }
+	if (lhs.scissor && m_scissors[*lhs.scissor] != m_scissors[*rhs.scissor]) { return false; }
+	for (std::size_t i = 0; i < lhs.primitives.second; ++i) {
+		if (!same(m_drawPrimitives[lhs.primitives.first + i].primitive, m_drawPrimitives[rhs.primitives.first + i].primitive)) { return false; }
+	}
+	return true;
+}
+
+std::size_t DrawList::hash(Entry const& entry) const noexcept {
+	std::size_t ret = entry.primitives.second;
+	for (std::size_t i = 0; i < entry.primitives.second; ++i) {
+		auto const& dp = m_drawPrimitives[entry.primitives.first + i].primitive;
+		combine(ret, dp.primitive);
+		combine(ret, dp.blinnPhong);
+		combine(ret, dp.pbr);
+	}
+	return ret;
+}
+
 DrawList::iterator& DrawList::iterator::operator++() {
 	++m_index;
 	return *this;
@@ -54,7 +132,10 @@ DrawList::iterator DrawList::iterator::operator--(int) {
 	return ret;
 }
 
-glm::mat4 const& DrawList::iterator::matrix() const { return m_list->m_matrices[m_list->m_entries[m_index].matrix]; }
+Span<glm::mat4 const> DrawList::iterator::matrices() const {
+	auto const& m = m_list->m_entries[m_index].matrices;
+	return Span(&m_list->m_matrices[m.first], m.second);
+}
 DrawBindings const& DrawList::iterator::indices() const { return m_list->m_entryBindings[m_index]; }
 
 Opt<vk::Rect2D const> DrawList::iterator::scissor() const {
@@ -69,4 +150,9 @@ Span<DrawList::Obj const> DrawList::iterator::prims() const {
 
 DrawList::iterator DrawList::begin() const { return {*this, 0U}; }
 DrawList::iterator DrawList::end() const { return {*this, m_entries.size()}; }
+
+DrawList::Range DrawList::range(std::size_t first, std::size_t count) const {
+	first = std::min(first, m_entries.size());
+	return {{*this, first}, {*this, std::min(first + count, m_entries.size())}};
+}
 } // namespace le::graphics
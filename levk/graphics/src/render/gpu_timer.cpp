@@ -0,0 +1,77 @@
+#include <levk/core/log.hpp>
+#include <levk/core/log_channel.hpp>
+#include <levk/graphics/common.hpp>
+#include <levk/graphics/device/device.hpp>
+#include <levk/graphics/render/gpu_timer.hpp>
+
+namespace le::graphics {
+namespace {
+constexpr u32 queries_per_slot_v = GpuTimer::max_scopes_v * 2;
+} // namespace
+
+GpuTimer::GpuTimer(not_null<Device*> device, Buffering buffering) : m_device(device) {
+	auto const& physical = device->physicalDevice();
+	auto const family = device->queues().graphics().family();
+	u32 const validBits = family < physical.queueFamilies.size() ? physical.queueFamilies[family].timestampValidBits : 0U;
+	f32 const period = physical.properties.limits.timestampPeriod;
+	if (validBits == 0U || period <= 0.0f) {
+		logW(LC_LibUser, "[{}] GPU timestamps not supported (valid bits: [{}], period: [{}]); GPU timing disabled", g_name, validBits, period);
+		return;
+	}
+	m_period = f64(period);
+	m_mask = validBits >= 64U ? ~u64(0) : (u64(1) << validBits) - 1U;
+	u32 const slots = std::max(u32(buffering), 1U);
+	vk::QueryPoolCreateInfo info;
+	info.queryType = vk::QueryType::eTimestamp;
+	info.queryCount = slots * queries_per_slot_v;
+	m_pool = m_pool.make(device->device().createQueryPool(info), device);
+	for (u32 i = 0; i < slots; ++i) { m_slots.push(Slot{{}, i * queries_per_slot_v}); }
+}
+
+void GpuTimer::begin(CommandBuffer const& cb) {
+	if (!supported()) { return; }
+	auto& slot = m_slots.get();
+	// previous use of this slot was fenced before its command buffer was reset: results are ready (or never written)
+	if (!slot.names.empty()) { read(slot); }
+	slot.names.clear();
+	cb.m_cb.resetQueryPool(m_pool, slot.base, queries_per_slot_v);
+}
+
+std::optional<GpuTimer::Query> GpuTimer::scope(std::string name) {
+	if (!supported()) { return std::nullopt; }
+	auto& slot = m_slots.get();
+	if (slot.names.size() >= max_scopes_v) { return std::nullopt; }
+	slot.names.push_back(std::move(name));
+	return Query(slot.names.size() - 1);
+}
+
+void GpuTimer::start(CommandBuffer const& cb, Query query) const { write(cb, query * 2, vk::PipelineStageFlagBits::eTopOfPipe); }
+
+void GpuTimer::stop(CommandBuffer const& cb, Query query) const { write(cb, query * 2 + 1, vk::PipelineStageFlagBits::eBottomOfPipe); }
+
+void GpuTimer::next() noexcept { m_slots.next(); }
+
+void GpuTimer::write(CommandBuffer const& cb, u32 index, vk::PipelineStageFlagBits stage) const {
+	if (supported()) { cb.m_cb.writeTimestamp(stage, m_pool, m_slots.get().base + index); }
+}
+
+void GpuTimer::read(Slot const& slot) {
+	// [timestamp, availability] pairs: scopes that were reserved but not (fully) written are skipped
+	struct Result {
+		u64 value;
+		u64 available;
+	};
+	auto const count = u32(slot.names.size() * 2);
+	std::vector<Result> results(count);
+	static constexpr auto flags = vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability;
+	auto const res = m_device->device().getQueryPoolResults(m_pool, slot.base, count, results.size() * sizeof(Result), results.data(), sizeof(Result), flags);
+	if (res != vk::Result::eSuccess && res != vk::Result::eNotReady) { return; }
+	m_results.clear();
+	for (std::size_t i = 0; i < slot.names.size(); ++i) {
+		auto const& begin = results[i * 2];
+		auto const& end = results[i * 2 + 1];
+		if (begin.available == 0U || end.available == 0U) { continue; }
+		auto const ticks = ((end.value - begin.value) & m_mask);
+		m_results.push_back({slot.names[i], Time_s(f32(f64(ticks) * m_period * 1e-9))});
+	}
+}
@@ -0,0 +1,49 @@
+#include <levk/core/log_channel.hpp>
+#include <levk/graphics/common.hpp>
+#include <levk/graphics/render/pipeline_cache.hpp>
+#include <cstring>
+
+namespace le::graphics {
+bool PipelineCache::compatible(PhysicalDevice const& device, Span<std::byte const> data) noexcept {
+	// VkPipelineCacheHeaderVersionOne: u32 headerSize, u32 headerVersion, u32 vendorID, u32 deviceID, u8 pipelineCacheUUID[VK_UUID_SIZE]
+	static constexpr std::size_t header_size_v = 4 * sizeof(u32) + VK_UUID_SIZE;
+	if (data.size() < header_size_v) { return false; }
+	u32 header[4];
+	std::memcpy(header, data.data(), sizeof(header));
+	if (header[0] < header_size_v || header[1] != u32(vk::PipelineCacheHeaderVersion::eOne)) { return false; }
+	if (header[2] != device.properties.vendorID || header[3] != device.properties.deviceID) { return false; }
+	return std::memcmp(data.data() + sizeof(header), device.properties.pipelineCacheUUID.data(), VK_UUID_SIZE) == 0;
+}
+
+PipelineCache::PipelineCache(not_null<Device*> device, Span<std::byte const> data) : m_device(device) {
+	if (!data.empty()) {
+		if (compatible(device->physicalDevice(), data)) {
+			logI(LC_LibUser, "[{}] Pipeline cache loaded ({} bytes)", g_name, data.size());
+		} else {
+			logW(LC_LibUser, "[{}] Incompatible / corrupt pipeline cache data ignored", g_name);
+			data = {};
+		}
+	}
+	m_cache = m_cache.make(device->makePipelineCache(data), device);
+}
+
+bytearray PipelineCache::data() const {
+	if (!m_device || !m_cache.active()) { return {}; }
+	auto const raw = m_device->device().getPipelineCacheData(m_cache.get());
+	bytearray ret(raw.size());
+	std::memcpy(ret.data(), raw.data(), raw.size());
+	return ret;
+}
+
+void PipelineCache::record(Time_s elapsed, vk::PipelineCreationFeedbackEXT const& feedback) noexcept {
+	m_stats.elapsed += elapsed;
+	++m_stats.created;
+	if (feedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eValid) {
+		if (feedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eApplicationPipelineCacheHit) {
+			++m_stats.hits;
+		} else {
+			++m_stats.misses;
+		}
+	}
+}
+} // namespace le::graphics
@@ -6,13 +6,36 @@
 #include <levk/core/services.hpp>
 
 namespace le::graphics {
-ShaderInput::ShaderInput(not_null<VRAM*> vram, PoolData data) : m_vram(vram) {
+namespace {
+struct DynamicBudget {
+	u32 uniforms{};
+	u32 storage{};
+
+	// dynamic counterpart of buffer descriptor types, while the pipeline layout's device limits allow
+	vk::DescriptorType operator()(vk::DescriptorSetLayoutBinding const& binding) noexcept {
+		auto const take = [&binding](u32& out_budget, vk::DescriptorType dynamic) {
+			if (out_budget < binding.descriptorCount) { return binding.descriptorType; }
+			out_budget -= binding.descriptorCount;
+			return dynamic;
+		};
+		switch (binding.descriptorType) {
+		case vk::DescriptorType::eUniformBuffer: return take(uniforms, vk::DescriptorType::eUniformBufferDynamic);
+		case vk::DescriptorType::eStorageBuffer: return take(storage, vk::DescriptorType::eStorageBufferDynamic);
+		default: return binding.descriptorType;
+		}
+	}
+};
+} // namespace
+
+ShaderInput::ShaderInput(not_null<VRAM*> vram, PoolData data) : m_vram(vram), m_bindless(data.bindless), m_bindlessSet(data.bindlessSet) {
 	Buffering const buffering = data.buffering == Buffering::eNone ? Buffering::eDouble : data.buffering;
 	for (std::size_t set = 0; set < data.sets.size(); ++set) {
 		DescriptorPool::CreateInfo pci;
 		auto const& sld = data.sets[set];
 		pci.bindingData = sld.bindingData;
 		pci.buffering = buffering;
+		pci.uniforms = data.uniforms;
+		pci.writer = data.writer;
 		pci.layout = sld.layout;
 		pci.setNumber = (u32)set;
 		m_setPools.emplace(u32(set), DescriptorPool(m_vram, pci));
@@ -54,9 +77,11 @@ vk::UniqueShaderModule PipelineFactory::makeModule(vk::Device device, SpirV cons
 	return device.createShaderModuleUnique(createInfo);
 }
 
-PipelineFactory::PipelineFactory(not_null<VRAM*> vram, GetSpirV&& getSpirV, Buffering buffering) noexcept
-	: m_getSpirV(std::move(getSpirV)), m_vram(vram), m_buffering(buffering) {
+PipelineFactory::PipelineFactory(not_null<VRAM*> vram, GetSpirV&& getSpirV, Buffering buffering, Span<std::byte const> cacheData)
+	: m_uniforms(std::make_unique<UniformAllocator>(vram, buffering)), m_writer(std::make_unique<DescriptorWriter>(vram->m_device)), m_getSpirV(std::move(getSpirV)), m_pipelineCache(vram->m_device, cacheData),
+	  m_vram(vram), m_buffering(buffering) {
 	EXPECT(m_getSpirV.has_value());
+	if (BindlessTextures::supported(*vram->m_device)) { m_bindless = std::make_unique<BindlessTextures>(vram, buffering); }
 }
 
 Pipeline PipelineFactory::get(Spec const& spec, vk::RenderPass renderPass) {
@@ -131,9 +156,13 @@ std::optional<PipelineFactory::Pipe> PipelineFactory::makePipe(SpecMap const& sp
 			sm.push_back({*modules.back(), spirV.type});
 		}
 	}
-	// TODO
-	// in.cache = m_pipelineCache;
-	if (auto p = utils::makeGraphicsPipeline(*m_vram->m_device, sm, spec.spec, data)) {
+	vk::PipelineCreationFeedbackEXT feedback;
+	data.cache = m_pipelineCache.cache();
+	data.feedback = &feedback;
+	auto const start = time::now();
+	auto const p = utils::makeGraphicsPipeline(*m_vram->m_device, sm, spec.spec, data);
+	m_pipelineCache.record(time::diff(start), feedback);
+	if (p) {
 		ret.pipeline = ret.pipeline.make(*p, m_vram->m_device);
 		ret.input = ShaderInput(m_vram, spec.meta.spd);
 		return ret;
@@ -150,12 +179,27 @@ PipelineFactory::Meta PipelineFactory::makeMeta(ShaderSpec const& shader) const
 	}
 	Meta ret;
 	ret.spd.buffering = m_buffering;
+	ret.spd.uniforms = m_uniforms.get();
+	ret.spd.writer = m_writer.get();
 	auto setBindings = utils::extractBindings(spirV);
 	std::vector<vk::DescriptorSetLayout> layouts;
+	auto const& limits = m_vram->m_device->physicalDevice().properties.limits;
+	DynamicBudget dynamic{limits.maxDescriptorSetUniformBuffersDynamic, limits.maxDescriptorSetStorageBuffersDynamic};
 	for (auto& [set, binds] : setBindings.sets) {
+		if (m_bindless && binds.size() == 1U && BindlessTextures::matches(binds[0].binding)) {
+			// shared texture array: no pool / per-object sets
+			layouts.push_back(m_bindless->layout());
+			ret.bindings.push_back({binds[0].binding});
+			ret.spd.sets.push_back({{}, m_bindless->layout()});
+			ret.spd.bindless = m_bindless.get();
+			ret.spd.bindlessSet = u32(set);
+			continue;
+		}
 		std::vector<vk::DescriptorSetLayoutBinding> bindings;
 		ktl::fixed_vector<DescriptorSet::BindingData, max_bindings_v> bindingData;
 		for (auto& data : binds) {
+			// per-object uniform / storage data is suballocated from m_uniforms and selected via dynamic offsets at bind time
+			data.binding.descriptorType = dynamic(data.binding);
 			if (data.binding.descriptorType != vk::DescriptorType()) {
 				bindings.push_back(data.binding);
 				Texture::Type const texType = data.imageType == vk::ImageViewType::eCube ? Texture::Type::eCube : Texture::Type::e2D;
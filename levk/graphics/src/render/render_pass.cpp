@@ -7,14 +7,13 @@ RenderPass::RenderPass(not_null<Device*> device, not_null<PipelineFactory*> fact
 	: m_info(std::move(info)), m_device(device), m_factory(factory) {
 	EXPECT(m_info.primary.recording() && m_info.framebuffer.colour.image && m_info.renderPass);
 	if (!m_info.primary.recording() || !m_info.framebuffer.colour.image || !m_info.renderPass) { return; }
-	bool const hasDepth = m_info.framebuffer.depth.image != vk::Image();
-	vk::ImageView const colourDepth[] = {m_info.framebuffer.colour.view, m_info.framebuffer.depth.view};
-	auto const views = hasDepth ? Span(colourDepth) : m_info.framebuffer.colour.view;
-	auto const extent = m_info.framebuffer.extent();
-	m_framebuffer = m_framebuffer.make(m_device->makeFramebuffer(m_info.renderPass, views, graphics::cast(extent), 1U), m_device);
+	if (m_info.vkFramebuffer == vk::Framebuffer()) {
+		m_framebuffer = FramebufferCache::make(m_device, m_info.renderPass, m_info.framebuffer);
+		m_info.vkFramebuffer = m_framebuffer;
+	}
 	vk::CommandBufferInheritanceInfo inh;
 	inh.renderPass = m_info.renderPass;
-	inh.framebuffer = m_framebuffer;
+	inh.framebuffer = m_info.vkFramebuffer;
 	for (auto& cmd : m_info.secondary) {
 		cmd.begin(vk::CommandBufferUsageFlagBits::eOneTimeSubmit | vk::CommandBufferUsageFlagBits::eRenderPassContinue, &inh);
 	}
@@ -46,6 +45,6 @@ void RenderPass::beginPass() {
 	passInfo.clearValues = {clear, vk::ClearDepthStencilValue{m_info.begin.depth.depth, m_info.begin.depth.stencil}};
 	passInfo.subpassContents = m_info.secondary.empty() ? vk::SubpassContents::eInline : vk::SubpassContents::eSecondaryCommandBuffers;
 	passInfo.usage = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
-	m_info.primary.beginRenderPass(m_info.renderPass, m_framebuffer, m_info.framebuffer.extent(), passInfo);
+	m_info.primary.beginRenderPass(m_info.renderPass, m_info.vkFramebuffer, m_info.framebuffer.extent(), passInfo);
 }
 } // namespace le::graphics
@@ -51,6 +51,28 @@ Image& ImageCache::refresh(Extent2D extent, vk::Format format) {
 	return *m_image;
 }
 
+Defer<vk::Framebuffer> FramebufferCache::make(not_null<Device*> device, vk::RenderPass renderPass, Framebuffer const& attachments) {
+	bool const hasDepth = attachments.depth.image != vk::Image();
+	vk::ImageView const colourDepth[] = {attachments.colour.view, attachments.depth.view};
+	auto const views = hasDepth ? Span(colourDepth) : attachments.colour.view;
+	auto const extent = graphics::cast(attachments.extent());
+	return Defer<vk::Framebuffer>::make(device->makeFramebuffer(renderPass, views, extent, 1U), device);
+}
+
+vk::Framebuffer FramebufferCache::get(vk::RenderPass renderPass, Framebuffer const& attachments) {
+	EXPECT(m_device);
+	auto const extent = attachments.extent();
+	for (auto const& entry : m_entries) {
+		if (entry.renderPass == renderPass && entry.colour == attachments.colour.view && entry.depth == attachments.depth.view && entry.extent == extent) {
+			return entry.framebuffer;
+		}
+	}
+	// unbounded growth implies a missed invalidation: start over rather than leak
+	if (m_entries.size() >= max_entries_v) { m_entries.clear(); }
+	m_entries.push_back({renderPass, attachments.colour.view, attachments.depth.view, extent, make(m_device, renderPass, attachments)});
+	return m_entries.back().framebuffer;
+}
+
 Renderer::Cmd Renderer::Cmd::make(not_null<Device*> device, bool secondary) {
 	Cmd ret;
 	auto const level = secondary ? vk::CommandBufferLevel::eSecondary : vk::CommandBufferLevel::ePrimary;
@@ -127,8 +149,10 @@ Defer<vk::RenderPass> Renderer::makeMainRenderPass(not_null<Device*> device, vk:
 	return Renderer::makeRenderPass(device, ac, ad, deps);
 }
 
-Renderer::Renderer(CreateInfo const& info) : m_depthImage(info.vram), m_colourImage(info.vram), m_vram(info.vram), m_target(info.target) {
+Renderer::Renderer(CreateInfo const& info)
+	: m_depthImage(info.vram), m_colourImage(info.vram), m_framebuffers(info.vram->m_device), m_vram(info.vram), m_target(info.target) {
 	Buffering const buffering = info.buffering < Buffering::eDouble ? Buffering::eDouble : info.buffering;
+	m_gpuTimer = GpuTimer(m_vram->m_device, buffering);
 	EXPECT(info.secondaryCmds <= max_secondary_cmd_v);
 	EXPECT(info.target == Target::eSwapchain || info.surfaceBlitFlags.test(BlitFlag::eDst));
 	if (!info.surfaceBlitFlags.test(BlitFlag::eDst)) { m_target = Target::eSwapchain; }
@@ -175,29 +199,41 @@ RenderPass Renderer::beginMainPass(PipelineFactory& pf, RenderTarget const& acqu
 	m_acquired = acquired;
 	if (m_target == Target::eOffScreen) {
 		extent = scaleExtent(extent, renderScale());
+		// recreated attachments invalidate all framebuffers referencing them
+		if (!m_colourImage.ready(extent, m_colourFormat)) { m_framebuffers.clear(); }
 		auto& img = m_colourImage.refresh(extent, m_colourFormat);
 		colour = RenderTarget{img.ref()};
 	}
+	if (!m_depthImage.ready(extent, m_surfaceFormat.depth)) { m_framebuffers.clear(); }
 	auto& depthImage = m_depthImage.refresh(extent, m_surfaceFormat.depth);
 	auto const depth = RenderTarget{depthImage.ref()};
 	auto& cmd = m_primaryCmd.get();
 	m_vram->m_device->resetCommandPool(cmd.pool);
 	for (auto& cmd : m_secondaryCmds.get()) { m_vram->m_device->resetCommandPool(cmd.pool); }
 	cmd.cb.begin(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
-	return RenderPass(m_vram->m_device, &pf, mainPassInfo(colour, depth, rb));
+	m_gpuTimer.begin(cmd.cb);
+	if (m_mainQuery = m_gpuTimer.scope("main pass"); m_mainQuery) { m_gpuTimer.start(cmd.cb, *m_mainQuery); }
+	auto info = mainPassInfo(colour, depth, rb);
+	info.vkFramebuffer = m_framebuffers.get(info.renderPass, info.framebuffer);
+	info.gpuTimer = &m_gpuTimer;
+	return RenderPass(m_vram->m_device, &pf, std::move(info));
 }
 
 vk::CommandBuffer Renderer::endMainPass(RenderPass& out_rp) {
 	auto& cmd = m_primaryCmd.get();
 	out_rp.end();
+	if (m_mainQuery) { m_gpuTimer.stop(cmd.cb, *m_mainQuery); }
 	auto const colour = out_rp.info().framebuffer.colour;
 	utils::Transition ltcolour{m_vram->m_device, &cmd.cb, colour.image};
 	utils::Transition ltacquired{m_vram->m_device, &cmd.cb, m_acquired.image};
 	LayoutStages presentLS = {LayoutStages::sa_colour_v, LayoutStages::sa_bottom_v};
 	if (m_target == Target::eOffScreen) {
+		auto const blitQuery = m_gpuTimer.scope("blit");
+		if (blitQuery) { m_gpuTimer.start(cmd.cb, *blitQuery); }
 		ltcolour(vIL::eTransferSrcOptimal, {}, LayoutStages::colourTransfer());
 		ltacquired(vIL::eTransferDstOptimal, {}, LayoutStages::colourTransfer());
 		m_vram->blit(cmd.cb, {colour.ref(), m_acquired.ref()});
+		if (blitQuery) { m_gpuTimer.stop(cmd.cb, *blitQuery); }
 		presentLS.src = LayoutStages::sa_transfer_v;
 	}
 	ltacquired(vIL::ePresentSrcKHR, {}, presentLS);
@@ -220,5 +256,6 @@ bool Renderer::renderScale(f32 rs) noexcept {
 void Renderer::next() {
 	m_primaryCmd.next();
 	m_secondaryCmds.next();
+	m_gpuTimer.next();
 }
 } // namespace le::graphics
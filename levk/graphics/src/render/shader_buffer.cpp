@@ -9,13 +9,19 @@ ShaderBuffer::ShaderBuffer(not_null<VRAM*> vram, CreateInfo const& info) : m_vra
 }
 
 ShaderBuffer& ShaderBuffer::write(void const* data, std::size_t size, std::size_t offset) {
-	m_storage.buffers.front().get().write(data, (vk::DeviceSize)size, (vk::DeviceSize)offset);
+	ENSURE(!m_storage.elements.empty() && offset + size <= m_storage.elemSize, "Write out of bounds");
+	std::memcpy(m_storage.elements.front().data() + offset, data, size);
 	return *this;
 }
 
 ShaderBuffer const& ShaderBuffer::update(DescriptorSet& out_set, u32 binding) const {
 	ENSURE(valid(), "Invalid ShaderBuffer instance");
-	ENSURE(!m_storage.buffers.empty() && m_storage.elemSize > 0, "Empty buffer!");
+	ENSURE(!m_storage.elements.empty() && m_storage.elemSize > 0, "Empty buffer!");
+	if (out_set.suballocated(binding)) {
+		out_set.writeElements(binding, m_storage.elements);
+		return *this;
+	}
+	upload();
 	if (m_storage.buffers.size() > 1) {
 		std::vector<DescriptorSet::Buf> bufs;
 		bufs.reserve(m_storage.buffers.size());
@@ -37,15 +43,23 @@ ShaderBuffer& ShaderBuffer::swap() {
 
 void ShaderBuffer::resize(std::size_t size, std::size_t count) {
 	ENSURE(valid(), "Invalid ShaderBuffer instance");
-	if (size != m_storage.elemSize || count != m_storage.buffers.size()) {
+	if (size != m_storage.elemSize || count != m_storage.elements.size()) {
 		m_storage.elemSize = size;
+		m_storage.elements.assign(count, bytearray(size));
+		m_storage.buffers.clear();
+	}
+}
+
+void ShaderBuffer::upload() const {
+	if (m_storage.buffers.size() != m_storage.elements.size()) {
 		m_storage.buffers.clear();
-		m_storage.buffers.reserve(count);
-		for (std::size_t i = m_storage.buffers.size(); i < count; ++i) {
+		m_storage.buffers.reserve(m_storage.elements.size());
+		for (std::size_t i = 0; i < m_storage.elements.size(); ++i) {
 			TRotator<Buffer> buffer;
 			for (Buffering j{}; j < m_storage.buffering; ++j) { buffer.ts.push_back(m_vram->makeBuffer(m_storage.elemSize, m_storage.usage, true)); }
 			m_storage.buffers.push_back(std::move(buffer));
 		}
 	}
+	for (std::size_t i = 0; i < m_storage.elements.size(); ++i) { m_storage.buffers[i].get().write(m_storage.elements[i].data(), m_storage.elemSize); }
 }
 } // namespace le::graphics
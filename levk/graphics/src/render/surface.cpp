@@ -69,6 +69,7 @@ vk::UniqueImageView makeImageView(vk::Device device, vk::Image image, vk::Format
 	info.components.a = vk::ComponentSwizzle::eA;
 	info.subresourceRange = {vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1};
 	info.image = image;
+	Device::s_objectsMade.fetch_add(1);
 	return device.createImageViewUnique(info);
 }
 } // namespace
@@ -120,6 +121,7 @@ bool Surface::makeSwapchain(Extent2D fbSize, std::optional<VSync> vsync) {
 		}
 		m_storage.blitFlags = bf;
 		m_retired = std::move(retired);
+		++m_generation;
 	} else {
 		m_storage.swapchain = std::exchange(retired, Swapchain());
 	}
@@ -0,0 +1,47 @@
+#include <levk/core/log_channel.hpp>
+#include <levk/core/maths.hpp>
+#include <levk/core/utils/expect.hpp>
+#include <levk/graphics/common.hpp>
+#include <levk/graphics/device/device.hpp>
+#include <levk/graphics/device/vram.hpp>
+#include <levk/graphics/render/uniform_allocator.hpp>
+#include <algorithm>
+
+namespace le::graphics {
+namespace {
+constexpr auto usage_v = vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eStorageBuffer;
+}
+
+UniformAllocator::UniformAllocator(not_null<VRAM*> vram, Buffering buffering, vk::DeviceSize capacity) : m_vram(vram) {
+	auto const& limits = vram->m_device->physicalDevice().properties.limits;
+	m_alignment = std::max({limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment, vk::DeviceSize(16)});
+	// keep every frame region's base aligned
+	capacity = (std::max(capacity, m_alignment) + m_alignment - 1U) / m_alignment * m_alignment;
+	m_linear = LinearAllocator(capacity, std::max(u32(buffering), 1U));
+	m_buffer.emplace(m_vram->makeBuffer(m_linear.size(), usage_v, true));
+}
+
+UniformAllocator::Alloc UniformAllocator::write(void const* data, std::size_t size, std::size_t reserve) {
+	EXPECT(valid());
+	reserve = std::max(size, reserve);
+	auto offset = m_linear.allocate(reserve, m_alignment);
+	if (!offset) {
+		grow(reserve);
+		offset = m_linear.allocate(reserve, m_alignment);
+	}
+	EXPECT(offset && *offset <= u64(maths::max<u32>()));
+	if (size > 0U) { m_buffer->write(data, size, *offset); }
+	return {m_buffer->buffer(), u32(*offset)};
+}
+
+void UniformAllocator::grow(std::size_t size) {
+	auto capacity = m_linear.capacity() * 2U;
+	while (capacity < size + m_alignment) { capacity *= 2U; }
+	logD(LC_LibUser, "[{}] UniformAllocator frame capacity [{}] exhausted, growing to [{}]", g_name, m_linear.capacity(), capacity);
+	// allocations already made this frame reference the old buffer: it is destroyed only after in-flight frames
+	LinearAllocator linear(capacity, m_linear.frames());
+	for (u32 i = 0; i < m_linear.frame(); ++i) { linear.next(); }
+	m_linear = linear;
+	m_buffer.emplace(m_vram->makeBuffer(m_linear.size(), usage_v, true));
+}
+} // namespace le::graphics
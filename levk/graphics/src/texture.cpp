@@ -84,6 +84,12 @@ bool Texture::construct(ImageData img, Payload payload, vk::Format format, bool
 	return constructImpl(std::move(imgs), payload, format, mips);
 }
 
+bool Texture::construct(utils::STBImg&& decoded, Payload payload, vk::Format format, bool mips) {
+	VRAM::Images imgs;
+	imgs.push_back(std::move(decoded));
+	return constructImpl(std::move(imgs), payload, format, mips);
+}
+
 bool Texture::construct(Cubemap const& cubemap, Payload payload, vk::Format format, bool mips) {
 	if (std::any_of(cubemap.bytes.begin(), cubemap.bytes.end(), [](Bitmap::type const& b) { return b.empty(); })) { return false; }
 	ktl::fixed_vector<BmpView, 6> bmps;
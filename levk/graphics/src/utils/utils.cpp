@@ -12,10 +12,16 @@
 #include <levk/graphics/render/context.hpp>
 #include <levk/graphics/utils/instant_command.hpp>
 #include <levk/graphics/utils/utils.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 
 static_assert(sizeof(stbi_uc) == sizeof(std::byte) && alignof(stbi_uc) == alignof(std::byte), "Invalid type size/alignment");
 
 namespace le::graphics {
+namespace stdfs = std::filesystem;
+
 namespace {
 struct Spv : Singleton<Spv> {
 	using Shell = le::utils::ShellSilent;
@@ -41,6 +47,82 @@ struct Spv : Singleton<Spv> {
 
 	bool online = false;
 };
+
+constexpr u64 fnv_basis_v = 0xcbf29ce484222325ULL;
+
+constexpr u64 fnv1a(u64 hash, std::string_view bytes) noexcept {
+	for (char const c : bytes) { hash = (hash ^ static_cast<u8>(c)) * 0x100000001b3ULL; }
+	return hash;
+}
+
+std::optional<std::string> readText(stdfs::path const& path) {
+	if (auto file = std::ifstream(path, std::ios::binary)) { return std::string(std::istreambuf_iterator<char>(file), {}); }
+	return std::nullopt;
+}
+
+std::string_view includeTarget(std::string_view line) noexcept {
+	auto const skip = [&line]() { line = line.substr(std::min(line.find_first_not_of(" \t"), line.size())); };
+	skip();
+	if (!line.starts_with('#')) { return {}; }
+	line = line.substr(1);
+	skip();
+	if (!line.starts_with("include")) { return {}; }
+	auto const open = line.find_first_of("\"<");
+	if (open == std::string_view::npos) { return {}; }
+	auto const close = line.find(line[open] == '"' ? '"' : '>', open + 1);
+	if (close == std::string_view::npos) { return {}; }
+	return line.substr(open + 1, close - open - 1);
+}
+
+u64 hashSource(u64 hash, stdfs::path const& path, std::vector<stdfs::path>& out_visited) {
+	std::error_code ec;
+	auto canonical = stdfs::weakly_canonical(path, ec);
+	if (std::find(out_visited.begin(), out_visited.end(), canonical) != out_visited.end()) { return hash; }
+	out_visited.push_back(std::move(canonical));
+	auto const text = readText(path);
+	// missing includes still contribute, so that adding one later changes the key
+	if (!text) { return fnv1a(hash, path.generic_string()); }
+	hash = fnv1a(hash, *text);
+	std::string_view str = *text;
+	while (!str.empty()) {
+		auto const eol = str.find('\n');
+		if (auto const include = includeTarget(str.substr(0, eol)); !include.empty()) {
+			hash = hashSource(hash, path.parent_path() / include, out_visited);
+		}
+		if (eol == std::string_view::npos) { break; }
+		str = str.substr(eol + 1);
+	}
+	return hash;
+}
+
+u64 compilerStamp() {
+	auto const stamp = [](stdfs::path const& path) -> u64 {
+		std::error_code ec;
+		if (!stdfs::is_regular_file(path, ec)) { return 0; }
+		auto const size = stdfs::file_size(path, ec);
+		auto const time = stdfs::last_write_time(path, ec).time_since_epoch().count();
+		return fnv1a(fnv1a(fnv1a(fnv_basis_v, path.generic_string()), std::to_string(size)), std::to_string(time));
+	};
+	// locate the compiler without launching it: any update changes its size / timestamp
+	stdfs::path compiler(utils::g_compiler);
+	if constexpr (levk_OS == os::OS::eWindows) {
+		if (!compiler.has_extension()) { compiler += ".exe"; }
+	}
+	if (compiler.has_parent_path()) { return stamp(compiler); }
+	char const* env = std::getenv("PATH");
+	if (!env) { return 0; }
+	constexpr char separator = levk_OS == os::OS::eWindows ? ';' : ':';
+	std::string_view paths = env;
+	while (!paths.empty()) {
+		auto const sep = paths.find(separator);
+		if (auto const dir = paths.substr(0, sep); !dir.empty()) {
+			if (auto const ret = stamp(stdfs::path(dir) / compiler); ret != 0) { return ret; }
+		}
+		if (sep == std::string_view::npos) { break; }
+		paths = paths.substr(sep + 1);
+	}
+	return 0;
+}
 } // namespace
 
 namespace {
@@ -150,6 +232,41 @@ std::optional<io::Path> utils::compileGlsl(io::Path const& src, io::Path const&
 	return d;
 }
 
+utils::SpirVKey utils::spirVKey(io::Path const& src, bool bDebug) {
+	SpirVKey ret;
+	std::vector<stdfs::path> visited;
+	ret.source = hashSource(fnv1a(fnv_basis_v, bDebug ? "-g" : ""), stdfs::path(src.string()), visited);
+	ret.compiler = compilerStamp();
+	return ret;
+}
+
+std::optional<io::Path> utils::cachedSpirV(io::Path const& src, bool bDebug, bool bCompile) {
+	stdfs::path const source(io::absolute(src).string());
+	std::error_code ec;
+	if (!stdfs::is_regular_file(source, ec)) { return std::nullopt; }
+	auto const key = spirVKey(src, bDebug);
+	auto const dir = source.parent_path() / g_spirVCache;
+	// eg: basic.vert-d.<source>.<compiler>.spv
+	auto const tag = fmt::format("{}{}.", source.filename().string(), bDebug ? "-d" : "");
+	auto const prefix = fmt::format("{}{:016x}.", tag, key.source);
+	auto const entry = dir / fmt::format("{}{:016x}.spv", prefix, key.compiler);
+	if (stdfs::is_regular_file(entry, ec)) { return io::Path(entry.generic_string()); }
+	if (key.compiler == 0) {
+		// compiler unavailable: SPIR-V built from identical source by any version will do
+		for (auto const& it : stdfs::directory_iterator(dir, ec)) {
+			if (it.path().filename().string().starts_with(prefix)) { return io::Path(it.path().generic_string()); }
+		}
+	}
+	if (!bCompile) { return std::nullopt; }
+	stdfs::create_directories(dir, ec);
+	if (!compileGlsl(src, io::Path(entry.generic_string()), {}, bDebug)) { return std::nullopt; }
+	// evict stale entries for this source / variant
+	for (auto const& it : stdfs::directory_iterator(dir, ec)) {
+		if (it.path() != entry && it.path().filename().string().starts_with(tag)) { stdfs::remove(it.path(), ec); }
+	}
+	return io::Path(entry.generic_string());
+}
+
 utils::SetBindings utils::extractBindings(Span<SpirV> modules) {
 	SetBindings ret;
 	Sets sets;
@@ -324,6 +441,14 @@ std::optional<vk::Pipeline> utils::makeGraphicsPipeline(Device& dv, Span<ShaderM
 	createInfo.layout = data.layout;
 	createInfo.renderPass = data.renderPass;
 	createInfo.subpass = sp.subpass;
+	vk::PipelineCreationFeedbackCreateInfoEXT feedbackInfo;
+	ktl::fixed_vector<vk::PipelineCreationFeedbackEXT, 8> stageFeedback(shaderCreateInfo.size());
+	if (data.feedback && dv.supports(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)) {
+		feedbackInfo.pPipelineCreationFeedback = data.feedback;
+		feedbackInfo.pipelineStageCreationFeedbackCount = (u32)stageFeedback.size();
+		feedbackInfo.pPipelineStageCreationFeedbacks = stageFeedback.data();
+		createInfo.pNext = &feedbackInfo;
+	}
 	auto ret = dv.device().createGraphicsPipeline(data.cache, createInfo);
 	if (ret.result == vk::Result::eSuccess) { return ret.value; }
 	return std::nullopt;
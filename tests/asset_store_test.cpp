@@ -0,0 +1,75 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/engine/assets/asset_store.hpp>
+#include <utility>
+
+namespace {
+using namespace le;
+
+struct Asset {
+	int value{};
+};
+
+struct Counted {
+	int* destroyed{};
+
+	Counted(int* destroyed) noexcept : destroyed(destroyed) {}
+	Counted(Counted&& rhs) noexcept : destroyed(std::exchange(rhs.destroyed, nullptr)) {}
+	Counted& operator=(Counted&&) = delete;
+	~Counted() {
+		if (destroyed) { ++*destroyed; }
+	}
+};
+
+TEST(asset_store_handle) {
+	AssetStore store;
+	auto const handle = store.addHandle("test/asset", Asset{42});
+	EXPECT_EQ(bool(handle), true);
+	auto const asset = store.find(handle);
+	EXPECT_NE(asset, nullptr);
+	EXPECT_EQ(asset->value, 42);
+	EXPECT_EQ(store.handle<Asset>("test/asset") == handle, true);
+	EXPECT_EQ(store.find<int>("test/asset"), nullptr);
+	EXPECT_EQ(store.unload("test/asset"), true);
+	EXPECT_EQ(store.find(handle), nullptr);
+	auto const readded = store.addHandle("test/asset", Asset{7});
+	EXPECT_EQ(readded == handle, false);
+	EXPECT_EQ(store.find(handle), nullptr);
+	AssetStore::Handle<Asset> cache = handle;
+	auto const refreshed = store.find("test/asset", cache);
+	EXPECT_NE(refreshed, nullptr);
+	EXPECT_EQ(refreshed->value, 7);
+	EXPECT_EQ(cache == readded, true);
+	store.clear();
+	EXPECT_EQ(store.find(readded), nullptr);
+}
+
+TEST(asset_store_retire) {
+	AssetStore store;
+	int destroyed{};
+	AssetStore::HandleCache<Counted> cache;
+	EXPECT_EQ(store.find("test/counted", cache), nullptr);
+	store.add("test/counted", Counted(&destroyed));
+	auto const counted = store.find("test/counted", cache);
+	EXPECT_NE(counted, nullptr);
+	auto const copy = cache;
+	EXPECT_EQ(copy.handle.load() == cache.handle.load(), true);
+	// unloaded assets outlive in-flight lock-free readers: destroyed on the second collect()
+	EXPECT_EQ(store.unload("test/counted"), true);
+	EXPECT_EQ(store.find(cache.handle.load()), nullptr);
+	EXPECT_EQ(destroyed, 0);
+	EXPECT_EQ(counted->destroyed, &destroyed);
+	store.collect();
+	EXPECT_EQ(destroyed, 0);
+	store.collect();
+	EXPECT_EQ(destroyed, 1);
+	// overwritten assets are retired too
+	store.add("test/counted", Counted(&destroyed));
+	store.add("test/counted", Counted(&destroyed));
+	store.collect();
+	store.collect();
+	EXPECT_EQ(destroyed, 2);
+	// clear destroys immediately
+	store.clear();
+	EXPECT_EQ(destroyed, 3);
+}
+} // namespace
@@ -0,0 +1,44 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <fmt/format.h>
+#include <levk/core/io/async_reader.hpp>
+#include <levk/core/io/fs_media.hpp>
+
+using namespace le;
+
+namespace {
+using test::TempDir;
+
+TEST(async_reader_batch) {
+	TempDir const dir("levk-async-reader-test");
+	std::vector<io::Path> uris;
+	for (int i = 0; i < 16; ++i) {
+		auto const name = fmt::format("file_{}.txt", i);
+		dir.write(name, fmt::format("contents {}", i));
+		uris.push_back(name);
+	}
+	io::FSMedia media;
+	ASSERT_EQ(media.mount(dir.path.generic_string()), true);
+	io::AsyncReader reader(io::AsyncReader::CreateInfo{2});
+	EXPECT_EQ(reader.threadCount(), 2U);
+	auto futures = reader.read(media, uris);
+	ASSERT_EQ(futures.size(), uris.size());
+	for (std::size_t i = 0; i < futures.size(); ++i) {
+		auto const bytes = futures[i].get();
+		ASSERT_EQ(bytes.has_value(), true);
+		EXPECT_EQ(bytes->view(), fmt::format("contents {}", i));
+	}
+}
+
+TEST(async_reader_missing) {
+	TempDir const dir("levk-async-reader-test");
+	dir.write("a.txt", "a");
+	io::FSMedia media;
+	ASSERT_EQ(media.mount(dir.path.generic_string()), true);
+	io::AsyncReader reader;
+	auto missing = reader.read(media, "missing.txt");
+	auto present = reader.read(media, "a.txt");
+	EXPECT_EQ(missing.get().has_value(), false);
+	EXPECT_EQ(present.get().value_or(io::MappedBytes()).view(), "a");
+}
+} // namespace
@@ -0,0 +1,61 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/core/time.hpp>
+#include <levk/engine/assets/asset_store.hpp>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+namespace {
+using namespace le;
+
+struct Asset {
+	int value{};
+};
+
+TEST(asset_store_bench) {
+	static constexpr int assets_v = 512;
+	static constexpr int loaded_v = 4096;
+	static constexpr int iterations_v = 200000;
+	AssetStore store;
+	std::vector<AssetStore::Handle<Asset>> handles;
+	std::vector<Hash> uris;
+	for (int i = 0; i < assets_v; ++i) {
+		std::string uri = "assets/" + std::to_string(i);
+		uris.push_back(uri);
+		handles.push_back(store.addHandle(std::move(uri), Asset{i}));
+	}
+	auto run = [&](auto find) {
+		std::atomic<bool> loading = true;
+		std::vector<std::thread> loaders;
+		for (int l = 0; l < 2; ++l) {
+			loaders.emplace_back([&store, &loading, l] {
+				for (int i = 0; loading && i < loaded_v; ++i) { store.add("loaded/" + std::to_string(l) + "/" + std::to_string(i), Asset{i}); }
+			});
+		}
+		std::atomic<u64> found = 0;
+		std::vector<std::thread> readers;
+		auto const start = time::now();
+		for (int r = 0; r < 4; ++r) {
+			readers.emplace_back([&, r] {
+				u64 count{};
+				for (int i = 0; i < iterations_v; ++i) {
+					if (find(std::size_t(i + r) % assets_v)) { ++count; }
+				}
+				found += count;
+			});
+		}
+		for (auto& reader : readers) { reader.join(); }
+		auto const elapsed = time::diff(start);
+		loading = false;
+		for (auto& loader : loaders) { loader.join(); }
+		for (int l = 0; l < 2; ++l) {
+			for (int i = 0; i < loaded_v; ++i) { store.unload("loaded/" + std::to_string(l) + "/" + std::to_string(i)); }
+		}
+		EXPECT_EQ(found.load(), u64(4 * iterations_v));
+		return f32(4 * iterations_v) / elapsed.count() / 1e6f;
+	};
+	f32 const byHash = run([&](std::size_t i) { return store.find<Asset>(uris[i]) != nullptr; });
+	f32 const byHandle = run([&](std::size_t i) { return store.find(handles[i]) != nullptr; });
+	std::printf("  [4 readers, 2 loaders] find by uri: %.2f M/s, find by handle: %.2f M/s\n", byHash, byHandle);
+}
+} // namespace
@@ -0,0 +1,91 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/page_cache.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <levk/core/io/async_reader.hpp>
+#include <levk/core/io/fs_media.hpp>
+#include <levk/core/time.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+
+namespace {
+using namespace le;
+using test::evict;
+using test::TempDir;
+namespace stdfs = std::filesystem;
+
+// stand-in for decoding: touches every byte (see bench-manifest for real textures / meshes)
+std::size_t decode(Span<std::byte const> bytes) {
+	std::size_t ret = 14695981039346656037ULL;
+	for (auto const byte : bytes) { ret = (ret ^ std::size_t(byte)) * 1099511628211ULL; }
+	return ret;
+}
+
+// Compares serial bytes() + decode against batched async reads + overlapped decode, on a cold page cache:
+// set LEVK_ASYNC_BENCH_ROOT to use a real asset tree
+TEST(async_reader_bench) {
+	std::optional<TempDir> temp;
+	stdfs::path root;
+	if (auto const env = std::getenv("LEVK_ASYNC_BENCH_ROOT"); env && stdfs::is_directory(env)) {
+		root = env;
+	} else {
+		temp.emplace("levk-async-reader-bench");
+		std::string blob(256U << 10, '\0');
+		for (int i = 0; i < 256; ++i) {
+			for (std::size_t j = 0; j < blob.size(); j += 64) { blob[j] = char(i + int(j)); }
+			temp->write(fmt::format("asset_{}.bin", i), blob);
+		}
+		root = temp->path;
+	}
+	std::vector<io::Path> files;
+	for (auto const& entry : stdfs::recursive_directory_iterator(root)) {
+		if (entry.is_regular_file()) { files.push_back(stdfs::relative(entry.path(), root).generic_string()); }
+	}
+	io::FSMedia media;
+	ASSERT_EQ(media.mount(root.generic_string()), true);
+	bool cold = true;
+	auto const evictAll = [&] {
+		for (auto const& file : files) { cold &= evict(root / file.generic_string()); }
+	};
+	struct Result {
+		std::size_t total{};
+		std::size_t checksum{};
+		Time_s elapsed{};
+	};
+	evictAll();
+	Result serial;
+	{
+		auto const start = time::now();
+		for (auto const& file : files) {
+			if (auto const bytes = media.bytes(file)) {
+				serial.checksum += decode(*bytes);
+				serial.total += bytes->size();
+			}
+		}
+		serial.elapsed = time::diff(start);
+	}
+	evictAll();
+	Result async;
+	{
+		io::AsyncReader reader;
+		auto const start = time::now();
+		auto futures = reader.read(media, files);
+		// decode each file as soon as it is resident, while later reads are in flight
+		for (auto& future : futures) {
+			if (auto const bytes = future.get()) {
+				async.checksum += decode(bytes->span());
+				async.total += bytes->size();
+			}
+		}
+		async.elapsed = time::diff(start);
+	}
+	auto const print = [](char const* name, Result const& r) {
+		std::printf("  %-6s: [%.2f MiB] read + decoded in %.2fms\n", name, double(r.total) / double(1U << 20), r.elapsed.count() * 1000.0f);
+	};
+	std::printf("  [%zu] files, page cache [%s]\n", files.size(), cold ? "evicted" : "warm (eviction unsupported)");
+	print("serial", serial);
+	print("async", async);
+	EXPECT_EQ(async.total, serial.total);
+	EXPECT_EQ(async.checksum, serial.checksum);
+}
+} // namespace
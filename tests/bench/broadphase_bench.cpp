@@ -0,0 +1,41 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/trigger_field.hpp>
+#include <levk/core/time.hpp>
+#include <cstdio>
+
+namespace {
+using namespace le;
+using physics::Broadphase;
+using physics::Trigger;
+using test::Field;
+
+void bench(std::size_t count, bool brute) {
+	Field field(count);
+	Broadphase broadphase;
+	field.update(broadphase);
+	// second frame: coherent motion
+	for (auto& box : field.boxes) {
+		box.lo.x += 0.01f;
+		box.hi.x += 0.01f;
+	}
+	auto start = time::now();
+	field.update(broadphase);
+	std::size_t const sap = broadphase.pairs([](Trigger&, Trigger&) {});
+	auto const tsap = time::diff(start);
+	if (brute) {
+		start = time::now();
+		std::size_t const bf = field.brute();
+		auto const tbf = time::diff(start);
+		std::printf("  [%zu] pairs: %zu, sweep-prune: %.2fms, brute-force: %.2fms\n", count, sap, tsap.count() * 1000.0f, tbf.count() * 1000.0f);
+		EXPECT_EQ(sap, bf);
+	} else {
+		std::printf("  [%zu] pairs: %zu, sweep-prune: %.2fms, brute-force: skipped\n", count, sap, tsap.count() * 1000.0f);
+	}
+}
+
+TEST(broadphase_bench) {
+	bench(1000, true);
+	bench(10000, true);
+	bench(100000, false);
+}
+} // namespace
@@ -0,0 +1,40 @@
+#include <dumb_test/dtest.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <levk/core/time.hpp>
+#include <levk/graphics/bounds.hpp>
+#include <cstdio>
+#include <random>
+
+namespace {
+using namespace le;
+using graphics::AABB;
+using graphics::Frustum;
+
+// camera at origin looking down -Z
+Frustum makeFrustum() {
+	auto const proj = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+	auto const view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	return Frustum::make(proj * view);
+}
+
+AABB unitBox() { return AABB{glm::vec3(-0.5f), glm::vec3(0.5f)}; }
+glm::mat4 at(glm::vec3 pos) { return glm::translate(glm::mat4(1.0f), pos); }
+
+TEST(frustum_bench) {
+	static constexpr std::size_t count = 100000;
+	std::mt19937 gen(42);
+	std::uniform_real_distribution<f32> dist(-100.0f, 100.0f);
+	std::vector<glm::mat4> mats(count);
+	for (auto& mat : mats) { mat = at({dist(gen), dist(gen), dist(gen)}); }
+	auto const frustum = makeFrustum();
+	auto const box = unitBox();
+	std::size_t visible{};
+	auto const start = time::now();
+	for (auto const& mat : mats) {
+		if (frustum.intersects(box.transform(mat))) { ++visible; }
+	}
+	auto const elapsed = time::diff(start);
+	std::printf("  [%zu] visible: %zu, culled: %zu, elapsed: %.2fms\n", count, visible, count - visible, elapsed.count() * 1000.0f);
+	EXPECT_EQ(visible > 0 && visible < count / 2, true);
+}
+} // namespace
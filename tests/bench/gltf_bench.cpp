@@ -0,0 +1,28 @@
+#include <tinyobjloader/tiny_obj_loader.h>
+#include <dumb_test/dtest.hpp>
+#include <fixtures/gltf_grid.hpp>
+#include <levk/core/time.hpp>
+#include <levk/graphics/gltf/gltf.hpp>
+#include <cstdio>
+
+namespace {
+using namespace le;
+using test::Grid;
+
+TEST(gltf_bench) {
+	auto const grid = Grid::make(256);
+	auto const glb = grid.glb();
+	auto const obj = grid.obj();
+	auto start = time::now();
+	auto const result = gltf::asset_t::parse_bytes(glb, {});
+	auto const gltfElapsed = time::diff(start);
+	start = time::now();
+	tinyobj::ObjReader reader;
+	bool const objParsed = reader.ParseFromString(obj, {});
+	auto const objElapsed = time::diff(start);
+	std::printf("  [%zu] vertices, [%zu] triangles; glb: %zu KiB, %.2fms; obj: %zu KiB, %.2fms\n", grid.vertices.size(), grid.indices.size() / 3,
+				glb.size() / 1024, gltfElapsed.count() * 1000.0f, obj.size() / 1024, objElapsed.count() * 1000.0f);
+	EXPECT_EQ(result.ok(), true);
+	EXPECT_EQ(objParsed, true);
+}
+} // namespace
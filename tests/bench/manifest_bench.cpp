@@ -0,0 +1,150 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/page_cache.hpp>
+#include <levk/core/io/async_reader.hpp>
+#include <levk/core/io/fs_media.hpp>
+#include <levk/core/time.hpp>
+#include <levk/engine/assets/asset_manifest.hpp>
+#include <levk/graphics/gltf/gltf.hpp>
+#include <levk/graphics/utils/utils.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <unordered_set>
+
+namespace {
+using namespace le;
+using test::evict;
+namespace stdfs = std::filesystem;
+
+struct Files {
+	std::vector<io::Path> uris;
+	std::unordered_set<std::string> unique;
+	std::size_t duplicates{};
+
+	void add(io::Path uri) {
+		if (unique.insert(uri.generic_string()).second) {
+			uris.push_back(std::move(uri));
+		} else {
+			++duplicates;
+		}
+	}
+};
+
+// the files ManifestLoader::preload reads ahead: textures (and cubemap faces), fonts, glTF meshes
+Files manifestFiles(AssetManifest::List const& list) {
+	Files ret;
+	auto const group = [&list](std::string const& name) -> AssetManifest::Group const* {
+		auto const it = list.find(name);
+		return it == list.end() ? nullptr : &it->second;
+	};
+	if (auto const textures = group("textures")) {
+		for (auto const& [uri, json] : *textures) {
+			auto const files = json->get_as<std::vector<std::string>>("files");
+			if (files.size() > 1U) {
+				io::Path const prefix = json->get_as<std::string>("prefix");
+				for (auto const& file : files) { ret.add(prefix / file); }
+			} else if (!files.empty()) {
+				ret.add(files[0]);
+			} else if (auto file = json->find_as<std::string>("file")) {
+				ret.add(*file);
+			} else {
+				ret.add(uri);
+			}
+		}
+	}
+	if (auto const fonts = group("fonts")) {
+		for (auto const& [uri, json] : *fonts) {
+			if (auto file = json->find("file"); file && file->is_string()) {
+				ret.add(file->as<std::string_view>());
+			} else {
+				io::Path const path(uri);
+				ret.add(path / path.filename() + ".ttf");
+			}
+		}
+	}
+	if (auto const meshes = group("meshes")) {
+		for (auto const& [_, json] : *meshes) {
+			io::Path const file = json->get_as<std::string>("file");
+			if (file.has_extension() && (file.extension() == ".gltf" || file.extension() == ".glb")) { ret.add(file); }
+		}
+	}
+	return ret;
+}
+
+// decodes like the load tasks: images via stb, glTF via the glTF parser; fonts are only touched (rasterising needs a device)
+std::size_t decode(io::Path const& uri, Span<std::byte const> bytes) {
+	auto const ext = uri.extension();
+	if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".tga" || ext == ".bmp") {
+		graphics::utils::STBImg const img(bytes);
+		return std::size_t(img.extent.x) * std::size_t(img.extent.y);
+	}
+	if (ext == ".gltf" || ext == ".glb") {
+		auto const result = gltf::asset_t::parse_bytes(std::span(bytes.data(), bytes.size()), {});
+		return result.ok() ? result.asset.meshes.size() : 0U;
+	}
+	std::size_t ret{};
+	for (std::size_t i = 0; i < bytes.size(); i += 4096) { ret += std::size_t(bytes[i]); }
+	return ret;
+}
+
+// Compares serial bytes() + decode against the preload path (one batched async read, decode as each file lands) on a cold
+// page cache, over the demo manifest's textures / fonts / meshes: set LEVK_MANIFEST_BENCH to the path of another .manifest
+TEST(manifest_bench) {
+	stdfs::path manifest = LEVK_DEMO_MANIFEST;
+	if (auto const env = std::getenv("LEVK_MANIFEST_BENCH"); env && stdfs::is_regular_file(env)) { manifest = env; }
+	io::FSMedia media;
+	ASSERT_EQ(media.mount(manifest.parent_path().generic_string()), true);
+	auto const text = media.string(manifest.filename().generic_string());
+	ASSERT_EQ(text.has_value(), true);
+	dj::json root;
+	ASSERT_EQ(root.read(*text), true);
+	auto files = manifestFiles(AssetManifest::populate(root));
+	// entries whose files are missing are skipped by the loader too
+	std::erase_if(files.uris, [&media](io::Path const& uri) { return !media.present(uri, std::nullopt); });
+	ASSERT_EQ(files.uris.empty(), false);
+	bool cold = true;
+	auto const evictAll = [&] {
+		for (auto const& uri : files.uris) { cold &= evict(media.fullPath(uri).generic_string()); }
+	};
+	struct Result {
+		std::size_t total{};
+		std::size_t checksum{};
+		Time_s elapsed{};
+	};
+	evictAll();
+	Result serial;
+	{
+		auto const start = time::now();
+		for (auto const& uri : files.uris) {
+			if (auto const bytes = media.bytes(uri)) {
+				serial.checksum += decode(uri, *bytes);
+				serial.total += bytes->size();
+			}
+		}
+		serial.elapsed = time::diff(start);
+	}
+	evictAll();
+	Result async;
+	{
+		io::AsyncReader reader;
+		auto const start = time::now();
+		auto futures = reader.read(media, files.uris);
+		for (std::size_t i = 0; i < futures.size(); ++i) {
+			if (auto const bytes = futures[i].get()) {
+				async.checksum += decode(files.uris[i], bytes->span());
+				async.total += bytes->size();
+			}
+		}
+		async.elapsed = time::diff(start);
+	}
+	auto const print = [](char const* name, Result const& r) {
+		std::printf("  %-7s: [%.2f MiB] read + decoded in %.2fms\n", name, double(r.total) / double(1U << 20), r.elapsed.count() * 1000.0f);
+	};
+	std::printf("  [%s] [%zu] files ([%zu] duplicate references read once), page cache [%s]\n", manifest.filename().generic_string().data(),
+				files.uris.size(), files.duplicates, cold ? "evicted" : "warm (eviction unsupported)");
+	print("serial", serial);
+	print("preload", async);
+	EXPECT_EQ(async.total, serial.total);
+	EXPECT_EQ(async.checksum, serial.checksum);
+}
+} // namespace
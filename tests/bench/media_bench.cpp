@@ -0,0 +1,143 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <levk/core/io/fs_media.hpp>
+#include <levk/core/os.hpp>
+#include <levk/core/time.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+
+namespace {
+using namespace le;
+using test::TempDir;
+namespace stdfs = std::filesystem;
+
+// resident anonymous (private) memory in KiB, if available
+std::optional<std::size_t> rssAnon() {
+#if defined(LEVK_OS_LINUX)
+	std::ifstream status("/proc/self/status");
+	std::string line;
+	while (std::getline(status, line)) {
+		if (line.starts_with("RssAnon:")) { return std::strtoull(line.data() + 8, nullptr, 10); }
+	}
+#endif
+	return std::nullopt;
+}
+
+// Compares path resolution against the uncached lookup (is_regular_file per mount) for 10k paths across 4 mounts
+TEST(media_path_cache_bench) {
+	constexpr std::size_t mounts = 4;
+	constexpr std::size_t count = 10000;
+	TempDir const dir("levk-media-cache-bench");
+	std::vector<io::Path> uris;
+	uris.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		auto const uri = fmt::format("assets/{}/file_{}.bin", i % 64, i);
+		dir.write(fmt::format("mount_{}/{}", i % mounts, uri), "x");
+		uris.push_back(uri);
+	}
+	io::FSMedia media;
+	std::vector<io::Path> prefixes;
+	for (std::size_t i = 0; i < mounts; ++i) {
+		prefixes.push_back((dir.path / fmt::format("mount_{}", i)).generic_string());
+		ASSERT_EQ(media.mount(prefixes.back()), true);
+	}
+	std::size_t uncachedProbes{};
+	auto const uncached = [&] {
+		std::size_t ret{};
+		for (auto const& uri : uris) {
+			for (auto const& prefix : prefixes) {
+				++uncachedProbes;
+				if (io::is_regular_file(io::absolute(prefix / uri))) {
+					++ret;
+					break;
+				}
+			}
+		}
+		return ret;
+	};
+	auto const cached = [&] {
+		std::size_t ret{};
+		for (auto const& uri : uris) {
+			if (media.present(uri, std::nullopt)) { ++ret; }
+		}
+		return ret;
+	};
+	// two passes each: initial load + reload
+	auto start = time::now();
+	EXPECT_EQ(uncached() + uncached(), count * 2);
+	auto const uncachedTime = time::diff(start);
+	start = time::now();
+	EXPECT_EQ(cached() + cached(), count * 2);
+	auto const cachedTime = time::diff(start);
+	auto const stats = media.stats();
+	std::printf("  [%zu] paths, [%zu] mounts, 2 passes\n", count, mounts);
+	std::printf("  uncached: [%zu] stat calls, %.2fms\n", uncachedProbes, uncachedTime.count() * 1000.0f);
+	std::printf("  cached  : [%llu] stat calls, [%llu] scan(s), [%llu] hits, [%llu] misses, %.2fms\n", (unsigned long long)stats.probes,
+				(unsigned long long)stats.scans, (unsigned long long)stats.hits, (unsigned long long)stats.misses, cachedTime.count() * 1000.0f);
+	EXPECT_EQ(stats.probes, 0U);
+	EXPECT_EQ(stats.hits, count * 2);
+}
+
+// Compares bytes() against mapped() over an asset tree: set LEVK_MEDIA_BENCH_ROOT to use a real one
+TEST(media_bench) {
+	std::optional<TempDir> temp;
+	stdfs::path root;
+	if (auto const env = std::getenv("LEVK_MEDIA_BENCH_ROOT"); env && stdfs::is_directory(env)) {
+		root = env;
+	} else {
+		temp.emplace("levk-media-bench");
+		std::string const blob(4U << 20, 'x');
+		for (int i = 0; i < 16; ++i) { temp->write(fmt::format("blob_{}.bin", i), blob); }
+		root = temp->path;
+	}
+	std::vector<io::Path> files;
+	for (auto const& entry : stdfs::recursive_directory_iterator(root)) {
+		if (entry.is_regular_file()) { files.push_back(stdfs::relative(entry.path(), root).generic_string()); }
+	}
+	io::FSMedia media;
+	ASSERT_EQ(media.mount(root.generic_string()), true);
+	struct Result {
+		std::size_t total{};
+		std::size_t copied{};
+		std::size_t checksum{};
+		std::optional<std::size_t> rss{};
+		Time_s elapsed{};
+	};
+	auto const run = [&](auto load) {
+		Result ret;
+		auto const rss = rssAnon();
+		auto const start = time::now();
+		std::vector<decltype(load(files.front()))> held;
+		held.reserve(files.size());
+		for (auto const& file : files) {
+			held.push_back(load(file));
+			auto const& bytes = held.back();
+			if (!bytes) { continue; }
+			for (std::size_t i = 0; i < bytes->size(); i += 4096) { ret.checksum += std::size_t(bytes->data()[i]); }
+			ret.total += bytes->size();
+		}
+		ret.elapsed = time::diff(start);
+		if (auto const now = rssAnon(); now && rss) { ret.rss = *now > *rss ? *now - *rss : 0U; }
+		return std::pair(ret, std::move(held));
+	};
+	auto [mapped, mHeld] = run([&media](io::Path const& uri) { return media.mapped(uri); });
+	for (auto const& bytes : mHeld) {
+		if (bytes && !bytes->mapped()) { mapped.copied += bytes->size(); }
+	}
+	mHeld.clear();
+	auto [copied, cHeld] = run([&media](io::Path const& uri) { return media.bytes(uri); });
+	copied.copied = copied.total;
+	cHeld.clear();
+	auto const print = [](char const* name, Result const& r) {
+		std::printf("  %-7s: [%.2f MiB] read, [%.2f MiB] copied, [%s] anon RSS, %.2fms\n", name, double(r.total) / double(1U << 20), double(r.copied) / double(1U << 20),
+					r.rss ? fmt::format("{:.2f} MiB", double(*r.rss) / 1024.0).data() : "n/a", r.elapsed.count() * 1000.0f);
+	};
+	std::printf("  [%zu] files\n", files.size());
+	print("bytes", copied);
+	print("mapped", mapped);
+	EXPECT_EQ(mapped.total, copied.total);
+	EXPECT_EQ(mapped.checksum, copied.checksum);
+}
+} // namespace
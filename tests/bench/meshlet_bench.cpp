@@ -0,0 +1,65 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/scan_mesh.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <levk/core/time.hpp>
+#include <levk/graphics/mesh_optimizer.hpp>
+#include <levk/graphics/meshlet.hpp>
+#include <cstdio>
+
+namespace {
+using namespace le;
+using graphics::ClusterCuller;
+using graphics::Frustum;
+using graphics::MeshletBuilder;
+using graphics::MeshOptimizer;
+using test::makeScan;
+
+// camera at eye looking at origin
+Frustum makeFrustum(glm::vec3 eye) {
+	auto const proj = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+	auto const view = glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	return Frustum::make(proj * view);
+}
+
+TEST(meshlet_bench) {
+	// ~1M triangles
+	auto geom = makeScan(512, 1024);
+	MeshOptimizer{}(geom);
+	auto const meshlets = MeshletBuilder{}(geom);
+	auto const triangles = geom.indices.size() / 3;
+	std::printf("  [%zu triangles] meshlets: %zu\n", triangles, meshlets.size());
+	struct View {
+		char const* name;
+		glm::vec3 eye;
+		glm::mat4 model;
+	};
+	View const views[] = {
+		{"centred", {0.0f, 0.0f, 5.0f}, glm::mat4(1.0f)},
+		{"close", {0.0f, 0.0f, 1.6f}, glm::mat4(1.0f)},
+		{"edge", {0.0f, 0.0f, 5.0f}, glm::translate(glm::mat4(1.0f), {2.8f, 0.0f, 0.0f})},
+	};
+	for (auto const& view : views) {
+		auto const frustum = makeFrustum(view.eye);
+		ClusterCuller const culler{frustum, view.eye};
+		std::vector<ClusterCuller::Range> ranges;
+		auto const start = time::now();
+		auto const visible = culler(meshlets, view.model, ranges);
+		auto const elapsed = time::diff(start);
+		std::size_t submitted{};
+		for (auto const& range : ranges) { submitted += range.indexCount / 3; }
+		// ground truth: front facing with a vertex in the frustum
+		std::size_t front{};
+		for (std::size_t i = 0; i < geom.indices.size(); i += 3) {
+			glm::vec3 const a = view.model * glm::vec4(geom.vertices[geom.indices[i]].position, 1.0f);
+			glm::vec3 const b = view.model * glm::vec4(geom.vertices[geom.indices[i + 1]].position, 1.0f);
+			glm::vec3 const c = view.model * glm::vec4(geom.vertices[geom.indices[i + 2]].position, 1.0f);
+			bool const facing = glm::dot(glm::cross(b - a, c - a), view.eye - a) > 0.0f;
+			if (facing && (frustum.contains(a) || frustum.contains(b) || frustum.contains(c))) { ++front; }
+		}
+		std::printf("  [%s] meshlets visible: %u/%zu, triangles submitted: %zu/%zu, visible: %zu, draws: %zu, elapsed: %.2fms\n", view.name, visible,
+					meshlets.size(), submitted, triangles, front, ranges.size(), elapsed.count() * 1000.0f);
+		EXPECT_EQ(submitted >= front, true);
+		EXPECT_EQ(submitted < triangles * 3 / 4, true);
+	}
+}
+} // namespace
@@ -0,0 +1,34 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/scene_chains.hpp>
+#include <levk/core/time.hpp>
+#include <cstdio>
+
+namespace {
+using namespace le;
+using test::depth_v;
+using test::naiveModel;
+using test::Scene;
+
+TEST(scene_graph_bench) {
+	Scene scene;
+	SceneGraph graph;
+	graph.update(scene.registry);
+	auto const& registry = scene.registry;
+	auto const nodes = registry.view<SceneNode>();
+	auto start = time::now();
+	glm::mat4 sink{};
+	for (auto [e, c] : registry.view<SceneNode>()) { sink += naiveModel(registry, e); }
+	auto const naive = time::diff(start);
+	start = time::now();
+	graph.update(registry);
+	for (auto [_, c] : registry.view<SceneNode>()) {
+		auto& [node] = c;
+		sink += node.model(registry);
+	}
+	auto const cached = time::diff(start);
+	std::printf("  [%zu nodes, depth %zu] naive: %.2fms, cached: %.2fms (%zu refreshed)\n", nodes.size(), depth_v, naive.count() * 1000.0f,
+				cached.count() * 1000.0f, graph.refreshed());
+	EXPECT_EQ(graph.refreshed(), std::size_t(0));
+	[[maybe_unused]] f32 volatile const result = sink[0][0];
+}
+} // namespace
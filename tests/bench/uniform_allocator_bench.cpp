@@ -0,0 +1,84 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/core/time.hpp>
+#include <levk/engine/builder.hpp>
+#include <levk/graphics/render/descriptor_set.hpp>
+#include <levk/graphics/render/uniform_allocator.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdio>
+
+namespace {
+using namespace le;
+using graphics::DescriptorPool;
+using graphics::DescriptorSet;
+using graphics::DescriptorWriter;
+
+struct Counts {
+	u32 updates{};
+	u32 writes{};
+	u32 skipped{};
+
+	static Counts reset() noexcept { return {DescriptorWriter::s_updates.exchange(0), DescriptorWriter::s_writes.exchange(0), DescriptorSet::s_skipped.exchange(0)}; }
+};
+
+// Drives 10k objects (one mat4 uniform each) through a DescriptorPool, once with a per-set buffer per object (static
+// UNIFORM_BUFFER) and once suballocated from a UniformAllocator (UNIFORM_BUFFER_DYNAMIC), printing descriptor updates for
+// the first frame (sets / buffers created) and steady state. Needs a display and a Vulkan device: skipped otherwise.
+TEST(uniform_allocator_bench) {
+	static constexpr std::size_t objects_v = 10000;
+	static constexpr int frames_v = 60;
+	window::CreateInfo winInfo;
+	winInfo.config.title = "bench-uniform-allocator";
+	winInfo.config.size = {320, 240};
+	auto eng = Engine::Builder{}.window(std::move(winInfo)).noLogFile()();
+	if (!eng || !eng->boot({})) {
+		std::printf("  [skipped] no window / device\n");
+		return;
+	}
+	auto& vram = eng->service().vram();
+	auto& device = *vram.m_device;
+	auto run = [&](char const* name, vk::DescriptorType type, graphics::UniformAllocator* uniforms) {
+		DescriptorSet::BindingData data;
+		data.name = "model";
+		data.layoutBinding = vk::DescriptorSetLayoutBinding(0, type, 1, vk::ShaderStageFlagBits::eVertex);
+		auto layout = device.makeDescriptorSetLayout(data.layoutBinding);
+		DescriptorWriter writer(&device);
+		DescriptorPool::CreateInfo info;
+		info.bindingData.push_back(data);
+		info.layout = layout;
+		info.uniforms = uniforms;
+		info.writer = &writer;
+		info.setsPerPool = 1024;
+		std::optional<DescriptorPool> pool;
+		pool.emplace(&vram, std::move(info));
+		auto frame = [&](int f) {
+			writer.defer();
+			for (std::size_t i = 0; i < objects_v; ++i) {
+				pool->set(i).writeUpdate(glm::translate(glm::mat4(1.0f), glm::vec3(float(i), float(f), 0.0f)), 0);
+			}
+			writer.flush();
+			pool->swap();
+			if (uniforms) { uniforms->next(); }
+		};
+		auto const print = [name](char const* stage, Counts const& c, Time_s elapsed, int frames) {
+			std::printf("  %-9s %-6s: [%6u] vkUpdateDescriptorSets, [%6u] descriptor writes, [%6u] elided, %.2fms / frame\n", name, stage, c.updates,
+						c.writes, c.skipped, elapsed.count() * 1000.0f / float(frames));
+		};
+		Counts::reset();
+		auto start = time::now();
+		frame(0);
+		print("first", Counts::reset(), time::diff(start), 1);
+		start = time::now();
+		for (int f = 1; f <= frames_v; ++f) { frame(f); }
+		print("steady", Counts::reset(), time::diff(start), frames_v);
+		device.waitIdle();
+		pool.reset();
+		device.destroy(layout);
+	};
+	std::printf("  [%zu] objects, [%d] frames\n", objects_v, frames_v);
+	run("per-set", vk::DescriptorType::eUniformBuffer, nullptr);
+	graphics::UniformAllocator uniforms(&vram, graphics::Buffering::eDouble);
+	run("allocator", vk::DescriptorType::eUniformBufferDynamic, &uniforms);
+	std::printf("  allocator: [%.2f] KiB capacity\n", double(uniforms.capacity()) / 1024.0);
+	device.waitIdle();
+}
+} // namespace
@@ -0,0 +1,73 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <fixtures/zip_writer.hpp>
+#include <levk/core/io/fs_media.hpp>
+#include <levk/core/io/zip_media.hpp>
+#include <levk/core/os.hpp>
+#include <levk/core/time.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+
+namespace {
+using namespace le;
+using test::blob;
+using test::TempDir;
+using test::ZipWriter;
+
+// resident memory in KiB, if available
+std::optional<std::size_t> rss() {
+#if defined(LEVK_OS_LINUX)
+	std::ifstream status("/proc/self/status");
+	std::string line;
+	while (std::getline(status, line)) {
+		if (line.starts_with("VmRSS:")) { return std::strtoull(line.data() + 6, nullptr, 10); }
+	}
+#endif
+	return std::nullopt;
+}
+
+// Compares mount time / resident memory of file-backed vs in-memory mounts: set LEVK_ZIP_BENCH_MB to resize
+TEST(zip_bench) {
+	TempDir const dir("levk-zip-media-bench");
+	auto const archive = dir.path / "bench.zip";
+	std::size_t megabytes = 128;
+	if (auto const env = std::getenv("LEVK_ZIP_BENCH_MB")) { megabytes = std::max(std::strtoull(env, nullptr, 10), 1ULL); }
+	constexpr std::size_t entry_v = 4U << 20;
+	auto const count = std::max(megabytes / 4U, std::size_t(1));
+	{
+		ZipWriter writer(archive);
+		for (std::size_t i = 0; i < count; ++i) { writer.add(fmt::format("entry_{}.bin", i), blob(entry_v, char(i))); }
+		writer.finish();
+	}
+	auto const path = io::Path(archive.generic_string());
+	auto const report = [](char const* name, Time_s elapsed, std::optional<std::size_t> before, std::optional<std::size_t> after) {
+		auto const delta = before && after ? fmt::format("{:.2f} MiB", double(*after > *before ? *after - *before : 0U) / 1024.0) : std::string("n/a");
+		std::printf("  %-7s: mount %.2fms, RSS +%s\n", name, elapsed.count() * 1000.0f, delta.data());
+	};
+	std::printf("  [%zu] entries, [%zu MiB]\n", count, count * 4U);
+	{
+		io::ZIPMedia media;
+		auto const before = rss();
+		auto const start = time::now();
+		ASSERT_EQ(media.mount(path), true);
+		report("file", time::diff(start), before, rss());
+		auto stream = media.stream("entry_0.bin");
+		ASSERT_EQ(stream.has_value(), true);
+		std::byte buffer[64 * 1024];
+		EXPECT_EQ(stream->read(buffer, [](Span<std::byte const>) {}), entry_v);
+		media.clear();
+	}
+	{
+		io::ZIPMedia media;
+		auto const before = rss();
+		auto const start = time::now();
+		auto const bytes = io::FSMedia{}.bytes(path);
+		ASSERT_EQ(bytes.has_value(), true);
+		ASSERT_EQ(media.mount("bench_memory.zip", *bytes), true);
+		report("memory", time::diff(start), before, rss());
+		media.clear();
+	}
+}
+} // namespace
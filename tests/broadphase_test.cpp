@@ -0,0 +1,40 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/trigger_field.hpp>
+
+namespace {
+using namespace le;
+using physics::Broadphase;
+using physics::Trigger;
+using test::Field;
+
+TEST(broadphase_prune) {
+	Field field(64);
+	Broadphase broadphase;
+	field.update(broadphase);
+	EXPECT_EQ(broadphase.size(), std::size_t(64));
+	for (std::size_t i = 0; i < 32; ++i) { broadphase.update(field.entities[i], field.triggers[i], field.boxes[i]); }
+	broadphase.prune();
+	EXPECT_EQ(broadphase.size(), std::size_t(32));
+	field.update(broadphase);
+	EXPECT_EQ(broadphase.pairs([](Trigger&, Trigger&) {}), field.brute());
+}
+
+TEST(broadphase_channels) {
+	dens::registry registry;
+	auto const ea = registry.make_entity();
+	auto const eb = registry.make_entity();
+	Trigger a, b;
+	a.cflags = 0x1;
+	b.cflags = 0x2;
+	Broadphase broadphase;
+	broadphase.update(ea, a, Broadphase::Box::make({}, glm::vec3(1.0f)));
+	broadphase.update(eb, b, Broadphase::Box::make({0.5f, 0.0f, 0.0f}, glm::vec3(1.0f)));
+	broadphase.prune();
+	EXPECT_EQ(broadphase.pairs([](Trigger&, Trigger&) {}), std::size_t(0));
+	b.channels(0x1);
+	broadphase.update(ea, a, Broadphase::Box::make({}, glm::vec3(1.0f)));
+	broadphase.update(eb, b, Broadphase::Box::make({0.5f, 0.0f, 0.0f}, glm::vec3(1.0f)));
+	broadphase.prune();
+	EXPECT_EQ(broadphase.pairs([](Trigger&, Trigger&) {}), std::size_t(1));
+}
+} // namespace
@@ -0,0 +1,73 @@
+#include <dumb_test/dtest.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <levk/graphics/render/draw_list.hpp>
+
+namespace {
+using namespace le;
+using namespace le::graphics;
+
+// primitives are only compared by address, never dereferenced
+int g_meshes[4]{};
+BPMaterialData const g_materials[2]{};
+
+DrawPrimitive prim(std::size_t mesh, std::size_t material = 0) {
+	return DrawPrimitive{{}, reinterpret_cast<MeshPrimitive const*>(&g_meshes[mesh]), &g_materials[material]};
+}
+
+glm::mat4 at(f32 x) { return glm::translate(glm::mat4(1.0f), {x, 0.0f, 0.0f}); }
+
+TEST(draw_list_consecutive_instancing) {
+	DrawList list;
+	for (int i = 0; i < 8; ++i) { list.push(prim(0), at(f32(i))); }
+	EXPECT_EQ(list.size(), std::size_t(1));
+	EXPECT_EQ(list.instances(), std::size_t(8));
+	auto const obj = *list.begin();
+	EXPECT_EQ(obj.instances(), u32(8));
+	EXPECT_EQ(obj.objs.size(), std::size_t(1));
+	EXPECT_EQ(obj.matrices[3][3].x, 3.0f);
+}
+
+TEST(draw_list_distinct_state) {
+	DrawList list;
+	list.push(prim(0), at(0.0f));
+	list.push(prim(0, 1), at(1.0f));
+	list.push(prim(0, 1), at(2.0f), vk::Rect2D({}, {16, 16}));
+	list.push(prim(0, 1), at(3.0f), vk::Rect2D({}, {16, 16}));
+	list.push(prim(0, 1), at(4.0f), vk::Rect2D({}, {32, 32}));
+	EXPECT_EQ(list.size(), std::size_t(4));
+	EXPECT_EQ(list.instances(), std::size_t(5));
+}
+
+TEST(draw_list_batch) {
+	DrawList list;
+	for (int i = 0; i < 12; ++i) { list.push(prim(std::size_t(i % 3)), at(f32(i))); }
+	EXPECT_EQ(list.size(), std::size_t(12));
+	list.batch();
+	EXPECT_EQ(list.size(), std::size_t(3));
+	EXPECT_EQ(list.instances(), std::size_t(12));
+	std::size_t group = 0;
+	for (auto const obj : list) {
+		EXPECT_EQ(obj.instances(), u32(4));
+		EXPECT_EQ(obj.objs[0].primitive.primitive, prim(group).primitive);
+		// relative order within a group is preserved
+		for (std::size_t i = 0; i < obj.matrices.size(); ++i) { EXPECT_EQ(obj.matrices[i][3].x, f32(group + i * 3)); }
+		++group;
+	}
+}
+
+TEST(draw_list_batch_multi_primitive) {
+	DrawList list;
+	DrawPrimitive const ab[] = {prim(0), prim(1)};
+	DrawPrimitive const ac[] = {prim(0), prim(2)};
+	list.push(ab, at(0.0f));
+	list.push(ac, at(1.0f));
+	list.push(ab, at(2.0f));
+	list.push(ac, at(3.0f));
+	list.batch();
+	EXPECT_EQ(list.size(), std::size_t(2));
+	for (auto const obj : list) {
+		EXPECT_EQ(obj.objs.size(), std::size_t(2));
+		EXPECT_EQ(obj.instances(), u32(2));
+	}
+}
+} // namespace
@@ -0,0 +1,116 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <levk/core/io/file_watcher.hpp>
+#include <filesystem>
+#include <thread>
+
+using namespace le;
+
+namespace {
+namespace stdfs = std::filesystem;
+
+using test::TempDir;
+
+constexpr Time_ms debounce_v = 50ms;
+
+std::vector<io::Path> settle(io::FileWatcher& watcher) {
+	std::this_thread::sleep_for(debounce_v * 3);
+	return watcher.changed();
+}
+
+void burstWrites(bool forcePolling) {
+	TempDir const dir("levk-file-watcher-test");
+	dir.write("a.txt", "a");
+	dir.write("b.txt", "b");
+	io::FileWatcher watcher(io::FileWatcher::CreateInfo{debounce_v, forcePolling});
+	auto const a = watcher.watch(dir / "a.txt");
+	ASSERT_EQ(a.has_value(), true);
+	ASSERT_EQ(watcher.watch(dir / "b.txt").has_value(), true);
+	EXPECT_EQ(settle(watcher).empty(), true);
+	for (int i = 0; i < 20; ++i) {
+		dir.write("a.txt", std::string(std::size_t(i + 1) * 64, 'x'));
+		if (forcePolling) { watcher.changed(); }
+	}
+	dir.write("untracked.txt", "untracked");
+	auto const changed = settle(watcher);
+	ASSERT_EQ(changed.size(), 1U);
+	EXPECT_EQ(changed[0] == *a, true);
+	EXPECT_EQ(settle(watcher).empty(), true);
+}
+
+TEST(file_watcher_burst) { burstWrites(false); }
+
+TEST(file_watcher_burst_polling) { burstWrites(true); }
+
+TEST(file_watcher_debounce) {
+	TempDir const dir("levk-file-watcher-test");
+	dir.write("a.txt", "a");
+	io::FileWatcher watcher(io::FileWatcher::CreateInfo{500ms, false});
+	if (!watcher.native()) { return; }
+	ASSERT_EQ(watcher.watch(dir / "a.txt").has_value(), true);
+	dir.write("a.txt", "b");
+	// still within debounce window
+	EXPECT_EQ(watcher.changed().empty(), true);
+}
+
+TEST(file_watcher_save_by_rename) {
+	TempDir const dir("levk-file-watcher-test");
+	dir.write("a.txt", "a");
+	io::FileWatcher watcher(io::FileWatcher::CreateInfo{debounce_v, false});
+	auto const a = watcher.watch(dir / "a.txt");
+	ASSERT_EQ(a.has_value(), true);
+	// write to temp, then atomically replace
+	dir.write("a.txt.tmp", "replaced");
+	stdfs::rename(dir.path / "a.txt.tmp", dir.path / "a.txt");
+	auto changed = settle(watcher);
+	ASSERT_EQ(changed.size(), 1U);
+	EXPECT_EQ(changed[0] == *a, true);
+	// backup-and-rewrite (vim style)
+	stdfs::rename(dir.path / "a.txt", dir.path / "a.txt~");
+	dir.write("a.txt", "rewritten");
+	stdfs::remove(dir.path / "a.txt~");
+	changed = settle(watcher);
+	ASSERT_EQ(changed.size(), 1U);
+	EXPECT_EQ(changed[0] == *a, true);
+}
+
+TEST(file_watcher_dir_recreated) {
+	TempDir const dir("levk-file-watcher-test");
+	dir.write("sub/a.txt", "a");
+	io::FileWatcher watcher(io::FileWatcher::CreateInfo{debounce_v, false});
+	auto const a = watcher.watch(dir / "sub/a.txt");
+	ASSERT_EQ(a.has_value(), true);
+	// deleted files are stamped when detected, and recreated ones may only be seen by the next poll
+	auto const next = [&watcher] {
+		auto ret = settle(watcher);
+		return ret.empty() ? settle(watcher) : ret;
+	};
+	stdfs::remove_all(dir.path / "sub");
+	auto changed = next();
+	ASSERT_EQ(changed.size(), 1U);
+	EXPECT_EQ(changed[0] == *a, true);
+	dir.write("sub/a.txt", "recreated");
+	changed = next();
+	ASSERT_EQ(changed.size(), 1U);
+	EXPECT_EQ(changed[0] == *a, true);
+	// watched again
+	dir.write("sub/a.txt", "modified");
+	changed = next();
+	ASSERT_EQ(changed.size(), 1U);
+	EXPECT_EQ(changed[0] == *a, true);
+	EXPECT_EQ(settle(watcher).empty(), true);
+}
+
+TEST(file_watcher_unwatch) {
+	TempDir const dir("levk-file-watcher-test");
+	dir.write("a.txt", "a");
+	io::FileWatcher watcher;
+	ASSERT_EQ(watcher.watch(dir / "a.txt").has_value(), true);
+	EXPECT_EQ(watcher.watch(dir / "missing/a.txt").has_value(), false);
+	EXPECT_EQ(watcher.size(), 1U);
+	EXPECT_EQ(watcher.unwatch(dir / "a.txt"), true);
+	EXPECT_EQ(watcher.size(), 0U);
+	dir.write("a.txt", "b");
+	EXPECT_EQ(settle(watcher).empty(), true);
+}
+} // namespace
@@ -0,0 +1,75 @@
+#pragma once
+#include <fmt/format.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace le::test {
+///
+/// \brief Flat side x side grid of triangles, serializable as .glb and .obj
+///
+struct Grid {
+	struct Vertex {
+		float position[3];
+		float normal[3];
+	};
+
+	std::vector<Vertex> vertices;
+	std::vector<std::uint32_t> indices;
+
+	static Grid make(std::uint32_t side) {
+		Grid ret;
+		for (std::uint32_t y = 0; y < side; ++y) {
+			for (std::uint32_t x = 0; x < side; ++x) { ret.vertices.push_back({{float(x), 0.0f, float(y)}, {0.0f, 1.0f, 0.0f}}); }
+		}
+		for (std::uint32_t y = 0; y + 1 < side; ++y) {
+			for (std::uint32_t x = 0; x + 1 < side; ++x) {
+				auto const i = y * side + x;
+				ret.indices.insert(ret.indices.end(), {i, i + side, i + 1, i + 1, i + side, i + side + 1});
+			}
+		}
+		return ret;
+	}
+
+	// interleaved positions / normals (byteStride, accessor byteOffset) followed by indices
+	std::vector<std::byte> glb() const {
+		auto const vsize = vertices.size() * sizeof(Vertex);
+		auto const isize = indices.size() * sizeof(std::uint32_t);
+		std::vector<std::byte> bin(vsize + isize);
+		std::memcpy(bin.data(), vertices.data(), vsize);
+		std::memcpy(bin.data() + vsize, indices.data(), isize);
+		auto json = fmt::format(R"({{"asset":{{"version":"2.0"}},"buffers":[{{"byteLength":{0}}}],)"
+								R"("bufferViews":[{{"buffer":0,"byteLength":{1},"byteStride":{2},"target":34962}},{{"buffer":0,"byteOffset":{1},"byteLength":{3},"target":34963}}],)"
+								R"("accessors":[{{"bufferView":0,"componentType":5126,"count":{4},"type":"VEC3"}},{{"bufferView":0,"byteOffset":12,"componentType":5126,"count":{4},"type":"VEC3"}},)"
+								R"({{"bufferView":1,"componentType":5125,"count":{5},"type":"SCALAR"}}],)"
+								R"("meshes":[{{"primitives":[{{"attributes":{{"POSITION":0,"NORMAL":1}},"indices":2}}]}}],"nodes":[{{"mesh":0}}],"scenes":[{{"nodes":[0]}}],"scene":0}})",
+								bin.size(), vsize, sizeof(Vertex), isize, vertices.size(), indices.size());
+		while (json.size() % 4 != 0) { json += ' '; }
+		std::vector<std::byte> ret;
+		auto const push = [&ret](void const* data, std::size_t size) {
+			auto const bytes = static_cast<std::byte const*>(data);
+			ret.insert(ret.end(), bytes, bytes + size);
+		};
+		auto const push_u32 = [&push](std::uint32_t value) { push(&value, sizeof(value)); };
+		push_u32(0x46546C67);
+		push_u32(2);
+		push_u32(std::uint32_t(12 + 8 + json.size() + 8 + bin.size()));
+		push_u32(std::uint32_t(json.size()));
+		push_u32(0x4E4F534A);
+		push(json.data(), json.size());
+		push_u32(std::uint32_t(bin.size()));
+		push_u32(0x004E4942);
+		push(bin.data(), bin.size());
+		return ret;
+	}
+
+	std::string obj() const {
+		std::string ret;
+		for (auto const& v : vertices) { ret += fmt::format("v {} {} {}\n", v.position[0], v.position[1], v.position[2]); }
+		ret += "vn 0 1 0\n";
+		for (std::size_t i = 0; i + 2 < indices.size(); i += 3) { ret += fmt::format("f {}//1 {}//1 {}//1\n", indices[i] + 1, indices[i + 1] + 1, indices[i + 2] + 1); }
+		return ret;
+	}
+};
+} // namespace le::test
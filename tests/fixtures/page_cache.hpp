@@ -0,0 +1,24 @@
+#pragma once
+#include <levk/core/os.hpp>
+#include <filesystem>
+
+#if defined(LEVK_OS_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace le::test {
+// drop file pages from the page cache (best effort), to measure cold reads
+inline bool evict([[maybe_unused]] std::filesystem::path const& path) {
+#if defined(LEVK_OS_LINUX)
+	int const fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) { return false; }
+	::fdatasync(fd);
+	bool const ret = ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+	::close(fd);
+	return ret;
+#else
+	return false;
+#endif
+}
+} // namespace le::test
@@ -0,0 +1,42 @@
+#pragma once
+#include <levk/graphics/geometry.hpp>
+#include <cmath>
+#include <random>
+
+namespace le::test {
+inline constexpr f32 pi_v = 3.14159265f;
+
+// lumpy UV sphere (stand-in for a scanned mesh) with outward facing triangles
+inline graphics::Geometry makeScan(u32 rings, u32 segments, u32 seed = 42) {
+	std::mt19937 gen(seed);
+	// scanner noise: a fraction of the edge length
+	f32 const amplitude = 0.05f * pi_v / f32(rings);
+	std::uniform_real_distribution<f32> noise(-amplitude, amplitude);
+	graphics::Geometry ret;
+	for (u32 r = 0; r <= rings; ++r) {
+		f32 const theta = pi_v * f32(r) / f32(rings);
+		for (u32 s = 0; s <= segments; ++s) {
+			f32 const phi = 2.0f * pi_v * f32(s) / f32(segments);
+			graphics::Vertex vertex;
+			vertex.position = glm::vec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)) * (1.0f + noise(gen));
+			ret.vertices.push_back(vertex);
+		}
+	}
+	auto const add = [&ret](u32 a, u32 b, u32 c) {
+		auto const& pa = ret.vertices[a].position;
+		auto const normal = glm::cross(ret.vertices[b].position - pa, ret.vertices[c].position - pa);
+		if (glm::length(normal) <= 0.0f) { return; }
+		if (glm::dot(normal, pa) < 0.0f) { std::swap(b, c); }
+		ret.indices.insert(ret.indices.end(), {a, b, c});
+	};
+	u32 const row = segments + 1;
+	for (u32 r = 0; r < rings; ++r) {
+		for (u32 s = 0; s < segments; ++s) {
+			u32 const i = r * row + s;
+			if (r > 0) { add(i, i + 1, i + row); }
+			if (r + 1 < rings) { add(i + 1, i + row + 1, i + row); }
+		}
+	}
+	return ret;
+}
+} // namespace le::test
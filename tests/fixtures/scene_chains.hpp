@@ -0,0 +1,42 @@
+#pragma once
+#include <dens/registry.hpp>
+#include <levk/gameplay/scene/scene_node.hpp>
+#include <vector>
+
+namespace le::test {
+constexpr std::size_t chains_v = 512;
+constexpr std::size_t depth_v = 24;
+
+inline dens::entity makeNode(dens::registry& out, dens::entity parent) {
+	auto ret = out.make_entity<Transform>();
+	auto& node = out.attach<SceneNode>(ret, ret);
+	if (parent != dens::entity()) { node.parent(out, parent); }
+	out.get<Transform>(ret).position({1.0f, 0.0f, 0.0f}).rotate(0.1f, {0.0f, 1.0f, 0.0f});
+	return ret;
+}
+
+// model matrix without the SceneNode cache
+inline glm::mat4 naiveModel(dens::registry const& registry, dens::entity e) {
+	auto ret = registry.get<Transform>(e).matrix();
+	if (auto p = registry.get<SceneNode>(e).parent(registry)) { return naiveModel(registry, p->entity()) * ret; }
+	return ret;
+}
+
+///
+/// \brief Root with chains_v chains of depth_v nodes each
+///
+struct Scene {
+	dens::registry registry;
+	dens::entity root;
+	std::vector<dens::entity> leaves;
+
+	Scene() {
+		root = makeNode(registry, {});
+		for (std::size_t c = 0; c < chains_v; ++c) {
+			auto e = root;
+			for (std::size_t d = 0; d < depth_v; ++d) { e = makeNode(registry, e); }
+			leaves.push_back(e);
+		}
+	}
+};
+} // namespace le::test
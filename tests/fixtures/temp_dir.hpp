@@ -0,0 +1,35 @@
+#pragma once
+#include <levk/core/io/path.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
+namespace le::test {
+///
+/// \brief Scratch directory under the system temp path: emptied on construction, removed on destruction
+///
+struct TempDir {
+	std::filesystem::path path;
+
+	explicit TempDir(std::string_view name) : path(std::filesystem::temp_directory_path() / name) {
+		std::filesystem::remove_all(path);
+		std::filesystem::create_directories(path);
+	}
+	~TempDir() { std::filesystem::remove_all(path); }
+
+	TempDir(TempDir&&) = delete;
+	TempDir& operator=(TempDir&&) = delete;
+
+	///
+	/// \brief Write text to name (creating intermediate directories) and return its full path
+	///
+	io::Path write(std::string_view name, std::string_view text) const {
+		auto const ret = path / name;
+		std::filesystem::create_directories(ret.parent_path());
+		std::ofstream(ret, std::ios::binary) << text;
+		return io::Path(ret.generic_string());
+	}
+
+	io::Path operator/(std::string_view name) const { return io::Path((path / name).generic_string()); }
+};
+} // namespace le::test
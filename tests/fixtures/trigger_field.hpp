@@ -0,0 +1,45 @@
+#pragma once
+#include <dens/registry.hpp>
+#include <levk/gameplay/physics/broadphase.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace le::test {
+///
+/// \brief Randomly placed unit triggers on two collision channels
+///
+struct Field {
+	dens::registry registry;
+	std::vector<dens::entity> entities;
+	std::vector<physics::Trigger> triggers;
+	std::vector<physics::Broadphase::Box> boxes;
+
+	explicit Field(std::size_t count) : triggers(count), boxes(count) {
+		for (std::size_t i = 0; i < count; ++i) { entities.push_back(registry.make_entity()); }
+		// constant density: ~4 neighbours per trigger
+		f32 const extent = std::cbrt(f32(count)) * 2.0f;
+		std::mt19937 gen(static_cast<u32>(count));
+		std::uniform_real_distribution<f32> pos(-extent, extent);
+		for (std::size_t i = 0; i < count; ++i) {
+			triggers[i].cflags = i % 4 == 0 ? 0x2 : 0x1;
+			boxes[i] = physics::Broadphase::Box::make({pos(gen), pos(gen), pos(gen)}, glm::vec3(1.0f));
+		}
+	}
+
+	std::size_t brute() const {
+		std::size_t ret{};
+		for (std::size_t i = 0; i + 1 < boxes.size(); ++i) {
+			for (std::size_t j = i + 1; j < boxes.size(); ++j) {
+				if ((triggers[i].cflags & triggers[j].cflags) != 0 && boxes[i].overlaps(boxes[j])) { ++ret; }
+			}
+		}
+		return ret;
+	}
+
+	void update(physics::Broadphase& out) {
+		for (std::size_t i = 0; i < boxes.size(); ++i) { out.update(entities[i], triggers[i], boxes[i]); }
+		out.prune();
+	}
+};
+} // namespace le::test
@@ -0,0 +1,108 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace le::test {
+// Minimal writer for uncompressed (stored) .zip archives
+class ZipWriter {
+  public:
+	explicit ZipWriter(std::filesystem::path const& path) : m_file(path, std::ios::binary) {}
+
+	void add(std::string_view name, std::string_view data) {
+		Entry entry{std::string(name), crc32(data), std::uint32_t(data.size()), std::uint32_t(m_offset)};
+		put32(0x04034b50); // local file header
+		put16(20);		   // version
+		put16(0);		   // flags
+		put16(0);		   // method: stored
+		put16(0);		   // time
+		put16(0);		   // date
+		put32(entry.crc);
+		put32(entry.size);
+		put32(entry.size);
+		put16(std::uint16_t(name.size()));
+		put16(0); // extra
+		write(name);
+		write(data);
+		m_entries.push_back(std::move(entry));
+	}
+
+	void finish() {
+		auto const cdOffset = m_offset;
+		for (auto const& entry : m_entries) {
+			put32(0x02014b50); // central directory header
+			put16(20);		   // version made by
+			put16(20);		   // version needed
+			put16(0);		   // flags
+			put16(0);		   // method
+			put16(0);		   // time
+			put16(0);		   // date
+			put32(entry.crc);
+			put32(entry.size);
+			put32(entry.size);
+			put16(std::uint16_t(entry.name.size()));
+			put16(0); // extra
+			put16(0); // comment
+			put16(0); // disk
+			put16(0); // internal attributes
+			put32(0); // external attributes
+			put32(entry.offset);
+			write(entry.name);
+		}
+		auto const cdSize = m_offset - cdOffset;
+		put32(0x06054b50); // end of central directory
+		put16(0);
+		put16(0);
+		put16(std::uint16_t(m_entries.size()));
+		put16(std::uint16_t(m_entries.size()));
+		put32(std::uint32_t(cdSize));
+		put32(std::uint32_t(cdOffset));
+		put16(0);
+		m_file.close();
+	}
+
+  private:
+	struct Entry {
+		std::string name;
+		std::uint32_t crc;
+		std::uint32_t size;
+		std::uint32_t offset;
+	};
+
+	static std::uint32_t crc32(std::string_view data) {
+		std::uint32_t crc = 0xffffffff;
+		for (unsigned char const c : data) {
+			crc ^= c;
+			for (int i = 0; i < 8; ++i) { crc = (crc >> 1) ^ (0xedb88320 & (0U - (crc & 1U))); }
+		}
+		return ~crc;
+	}
+
+	void write(std::string_view data) {
+		m_file.write(data.data(), std::streamsize(data.size()));
+		m_offset += data.size();
+	}
+	void put16(std::uint16_t value) {
+		char const bytes[] = {char(value & 0xff), char(value >> 8)};
+		write({bytes, 2});
+	}
+	void put32(std::uint32_t value) {
+		char const bytes[] = {char(value & 0xff), char((value >> 8) & 0xff), char((value >> 16) & 0xff), char(value >> 24)};
+		write({bytes, 4});
+	}
+
+	std::ofstream m_file;
+	std::vector<Entry> m_entries;
+	std::size_t m_offset{};
+};
+
+// deterministic payload of size bytes
+inline std::string blob(std::size_t size, char seed) {
+	std::string ret(size, 0);
+	for (std::size_t i = 0; i < size; ++i) { ret[i] = char(seed + char(i % 251)); }
+	return ret;
+}
+} // namespace le::test
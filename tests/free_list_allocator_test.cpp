@@ -0,0 +1,96 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/graphics/device/free_list_allocator.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+using le::graphics::FreeListAllocator;
+
+TEST(free_list_alloc_basic) {
+	FreeListAllocator list(64);
+	auto const a = list.allocate(16);
+	auto const b = list.allocate(16);
+	ASSERT_EQ(a.has_value() && b.has_value(), true);
+	EXPECT_EQ(*a, 0U);
+	EXPECT_EQ(*b, 16U);
+	EXPECT_EQ(list.used(), 32U);
+	EXPECT_EQ(list.count(), 2U);
+	EXPECT_EQ(list.allocate(0).has_value(), false);
+	EXPECT_EQ(list.allocate(65).has_value(), false);
+	EXPECT_EQ(list.allocate(33).has_value(), false);
+	EXPECT_EQ(list.release(*a), true);
+	EXPECT_EQ(list.release(*a), false);
+	EXPECT_EQ(list.release(*b), true);
+	EXPECT_EQ(list.empty(), true);
+	EXPECT_EQ(list.used(), 0U);
+	EXPECT_EQ(list.fragments(), 1U);
+}
+
+TEST(free_list_alloc_alignment) {
+	FreeListAllocator list(256);
+	auto const a = list.allocate(3);
+	// non power of two alignment (vertex stride)
+	auto const b = list.allocate(24, 12);
+	auto const c = list.allocate(4, 64);
+	ASSERT_EQ(a.has_value() && b.has_value() && c.has_value(), true);
+	EXPECT_EQ(*a, 0U);
+	EXPECT_EQ(*b, 12U);
+	EXPECT_EQ(*c, 64U);
+	EXPECT_EQ(list.used(), 31U);
+	// padding is reusable
+	auto const d = list.allocate(9);
+	ASSERT_EQ(d.has_value(), true);
+	EXPECT_EQ(*d, 3U);
+}
+
+TEST(free_list_alloc_reuse) {
+	FreeListAllocator list(64);
+	auto const a = list.allocate(16);
+	auto const b = list.allocate(16);
+	auto const c = list.allocate(16);
+	ASSERT_EQ(a.has_value() && b.has_value() && c.has_value(), true);
+	list.release(*b);
+	EXPECT_EQ(list.fragments(), 2U);
+	// first fit: the hole is reused
+	auto const d = list.allocate(8);
+	ASSERT_EQ(d.has_value(), true);
+	EXPECT_EQ(*d, 16U);
+	EXPECT_EQ(list.allocate(24).has_value(), false);
+	list.release(*a);
+	list.release(*d);
+	list.release(*c);
+	EXPECT_EQ(list.fragments(), 1U);
+	auto const e = list.allocate(64);
+	ASSERT_EQ(e.has_value(), true);
+	EXPECT_EQ(*e, 0U);
+}
+
+TEST(free_list_alloc_random) {
+	constexpr FreeListAllocator::size_type capacity = 1U << 16;
+	FreeListAllocator list(capacity);
+	std::mt19937 engine(42);
+	std::vector<std::pair<FreeListAllocator::size_type, FreeListAllocator::size_type>> live;
+	for (int i = 0; i < 10000; ++i) {
+		if (live.empty() || engine() % 3U != 0U) {
+			auto const size = FreeListAllocator::size_type(engine() % 512U + 1U);
+			auto const align = FreeListAllocator::size_type(engine() % 4U == 0U ? 16U : 4U);
+			if (auto const offset = list.allocate(size, align)) {
+				EXPECT_EQ(*offset % align, 0U);
+				EXPECT_EQ(*offset + size <= capacity, true);
+				for (auto const& [begin, end] : live) { EXPECT_EQ(*offset >= end || *offset + size <= begin, true); }
+				live.emplace_back(*offset, *offset + size);
+			}
+		} else {
+			auto const index = engine() % live.size();
+			EXPECT_EQ(list.release(live[index].first), true);
+			live.erase(live.begin() + std::ptrdiff_t(index));
+		}
+	}
+	FreeListAllocator::size_type used{};
+	for (auto const& [begin, end] : live) { used += end - begin; }
+	EXPECT_EQ(list.used(), used);
+	for (auto const& [begin, _] : live) { list.release(begin); }
+	EXPECT_EQ(list.empty(), true);
+	EXPECT_EQ(list.fragments(), 1U);
+}
+} // namespace
@@ -0,0 +1,52 @@
+#include <dumb_test/dtest.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <levk/graphics/bounds.hpp>
+
+namespace {
+using namespace le;
+using graphics::AABB;
+using graphics::Frustum;
+
+// camera at origin looking down -Z
+Frustum makeFrustum() {
+	auto const proj = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+	auto const view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	return Frustum::make(proj * view);
+}
+
+AABB unitBox() { return AABB{glm::vec3(-0.5f), glm::vec3(0.5f)}; }
+glm::mat4 at(glm::vec3 pos) { return glm::translate(glm::mat4(1.0f), pos); }
+
+TEST(aabb_make) {
+	glm::vec3 const points[] = {{1.0f, -2.0f, 0.0f}, {-1.0f, 3.0f, 2.0f}, {0.0f, 0.0f, -4.0f}};
+	auto const aabb = AABB::make(points);
+	EXPECT_EQ(aabb.valid(), true);
+	EXPECT_EQ(aabb.min.x, -1.0f);
+	EXPECT_EQ(aabb.max.y, 3.0f);
+	EXPECT_EQ(aabb.min.z, -4.0f);
+	EXPECT_EQ(AABB{}.valid(), false);
+}
+
+TEST(aabb_transform) {
+	auto const rotated = unitBox().transform(glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+	// rotated unit box about Y grows to half diagonal in X/Z
+	EXPECT_EQ(rotated.max.x > 0.7f && rotated.max.x < 0.71f, true);
+	EXPECT_EQ(rotated.max.y, 0.5f);
+	auto const moved = unitBox().transform(at({10.0f, 0.0f, 0.0f}));
+	EXPECT_EQ(moved.centre().x, 10.0f);
+}
+
+TEST(frustum_intersects) {
+	auto const frustum = makeFrustum();
+	EXPECT_EQ(frustum.contains({0.0f, 0.0f, -5.0f}), true);
+	EXPECT_EQ(frustum.contains({0.0f, 0.0f, 5.0f}), false);
+	EXPECT_EQ(frustum.intersects(unitBox().transform(at({0.0f, 0.0f, -5.0f}))), true);
+	EXPECT_EQ(frustum.intersects(unitBox().transform(at({0.0f, 0.0f, 5.0f}))), false);
+	EXPECT_EQ(frustum.intersects(unitBox().transform(at({0.0f, 0.0f, -200.0f}))), false);
+	EXPECT_EQ(frustum.intersects(unitBox().transform(at({50.0f, 0.0f, -5.0f}))), false);
+	EXPECT_EQ(frustum.intersects(unitBox().transform(at({0.0f, -50.0f, -5.0f}))), false);
+	// straddling the right plane: centre outside, box partially inside
+	EXPECT_EQ(frustum.contains({3.2f, 0.0f, -5.0f}), false);
+	EXPECT_EQ(frustum.intersects(unitBox().transform(at({3.2f, 0.0f, -5.0f}))), true);
+}
+} // namespace
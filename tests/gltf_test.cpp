@@ -0,0 +1,57 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/gltf_grid.hpp>
+#include <levk/graphics/gltf/gltf.hpp>
+#include <cstring>
+#include <span>
+
+namespace {
+using namespace le;
+using test::Grid;
+
+TEST(gltf_glb) {
+	auto const grid = Grid::make(8);
+	auto const result = gltf::asset_t::parse_bytes(grid.glb(), {});
+	ASSERT_EQ(result.ok(), true);
+	ASSERT_EQ(result.asset.meshes.size(), 1U);
+	auto const& primitive = result.asset.meshes[0].primitives[0];
+	ASSERT_EQ(primitive.positions.size(), grid.vertices.size());
+	ASSERT_EQ(primitive.normals.size(), grid.vertices.size());
+	EXPECT_EQ(primitive.indices == grid.indices, true);
+	for (std::size_t i = 0; i < grid.vertices.size(); ++i) {
+		EXPECT_EQ(std::memcmp(primitive.positions[i].data, grid.vertices[i].position, sizeof(float) * 3), 0);
+		EXPECT_EQ(std::memcmp(primitive.normals[i].data, grid.vertices[i].normal, sizeof(float) * 3), 0);
+	}
+}
+
+TEST(gltf_glb_borrow) {
+	auto const glb = Grid::make(4).glb();
+	auto const result = gltf::asset_t::parse_bytes(glb, {}, true);
+	ASSERT_EQ(result.ok(), true);
+	auto const& buffer = result.asset.resources.buffers[0];
+	EXPECT_EQ(buffer.storage.empty(), true);
+	EXPECT_EQ(buffer.bytes.data() >= glb.data() && buffer.bytes.data() + buffer.bytes.size() <= glb.data() + glb.size(), true);
+	EXPECT_EQ(result.asset.meshes[0].primitives[0].positions.size(), 16U);
+}
+
+TEST(gltf_invalid_glb) {
+	auto bytes = Grid::make(2).glb();
+	bytes.resize(bytes.size() / 2);
+	EXPECT_EQ(gltf::asset_t::parse_bytes(bytes, {}).error == gltf::error_t::invalid_glb, true);
+}
+
+TEST(gltf_node_matrix) {
+	std::string_view const json = R"({"asset":{"version":"2.0"},"nodes":[{"matrix":[2,0,0,0, 0,3,0,0, 0,0,4,0, 5,6,7,1]},{"translation":[1,2,3]}]})";
+	auto const result = gltf::asset_t::parse_bytes(std::as_bytes(std::span(json.data(), json.size())), {});
+	ASSERT_EQ(result.ok(), true);
+	ASSERT_EQ(result.asset.nodes.size(), 2U);
+	auto const& matrix = result.asset.nodes[0].matrix;
+	ASSERT_EQ(matrix.has_value(), true);
+	// column major
+	EXPECT_EQ(matrix->data[0].data[0], 2.0f);
+	EXPECT_EQ(matrix->data[1].data[1], 3.0f);
+	EXPECT_EQ(matrix->data[3].data[0], 5.0f);
+	EXPECT_EQ(matrix->data[3].data[2], 7.0f);
+	EXPECT_EQ(result.asset.nodes[1].matrix.has_value(), false);
+	EXPECT_EQ(result.asset.nodes[1].translation.data[2], 3.0f);
+}
+} // namespace
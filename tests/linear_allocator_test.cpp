@@ -0,0 +1,57 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/graphics/device/linear_allocator.hpp>
+
+namespace {
+using le::graphics::LinearAllocator;
+
+TEST(linear_alloc_basic) {
+	LinearAllocator linear(64, 2);
+	EXPECT_EQ(linear.size(), 128U);
+	auto const a = linear.allocate(16);
+	auto const b = linear.allocate(16);
+	ASSERT_EQ(a.has_value() && b.has_value(), true);
+	EXPECT_EQ(*a, 0U);
+	EXPECT_EQ(*b, 16U);
+	EXPECT_EQ(linear.used(), 32U);
+	EXPECT_EQ(linear.allocate(0).has_value(), false);
+	EXPECT_EQ(linear.allocate(65).has_value(), false);
+}
+
+TEST(linear_alloc_alignment) {
+	LinearAllocator linear(256, 2);
+	auto const a = linear.allocate(3, 64);
+	auto const b = linear.allocate(5, 64);
+	ASSERT_EQ(a.has_value() && b.has_value(), true);
+	EXPECT_EQ(*a, 0U);
+	EXPECT_EQ(*b, 64U);
+	EXPECT_EQ(linear.used(), 69U);
+	linear.next();
+	auto const c = linear.allocate(3, 64);
+	ASSERT_EQ(c.has_value(), true);
+	EXPECT_EQ(*c, 256U);
+}
+
+TEST(linear_alloc_full) {
+	LinearAllocator linear(64, 2);
+	ASSERT_EQ(linear.allocate(48).has_value(), true);
+	// does not spill into the next frame's region
+	EXPECT_EQ(linear.allocate(17).has_value(), false);
+	auto const a = linear.allocate(16);
+	ASSERT_EQ(a.has_value(), true);
+	EXPECT_EQ(*a, 48U);
+	EXPECT_EQ(linear.allocate(1).has_value(), false);
+}
+
+TEST(linear_alloc_frames) {
+	LinearAllocator linear(100, 3);
+	for (le::u32 frame = 0; frame < 7; ++frame) {
+		EXPECT_EQ(linear.frame(), frame % 3);
+		auto const a = linear.allocate(60);
+		ASSERT_EQ(a.has_value(), true);
+		EXPECT_EQ(*a, (frame % 3) * 100U);
+		EXPECT_EQ(linear.allocate(60).has_value(), false);
+		linear.next();
+		EXPECT_EQ(linear.used(), 0U);
+	}
+}
+} // namespace
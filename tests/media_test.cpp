@@ -0,0 +1,141 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <levk/core/io/fs_media.hpp>
+#include <levk/core/os.hpp>
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+using namespace le;
+
+namespace {
+namespace stdfs = std::filesystem;
+using test::TempDir;
+
+TEST(media_mapped) {
+	TempDir const dir("levk-media-test");
+	dir.write("a.txt", "hello world");
+	dir.write("empty.txt", "");
+	io::FSMedia media;
+	ASSERT_EQ(media.mount(dir.path.generic_string()), true);
+	auto const a = media.mapped("a.txt");
+	ASSERT_EQ(a.has_value(), true);
+	EXPECT_EQ(a->view(), "hello world");
+	EXPECT_EQ(a->size(), 11U);
+#if defined(LEVK_OS_LINUX) || defined(LEVK_OS_APPLE)
+	EXPECT_EQ(a->mapped(), true);
+#endif
+	auto const b = *a;
+	EXPECT_EQ(b.data(), a->data());
+	auto const empty = media.mapped("empty.txt");
+	ASSERT_EQ(empty.has_value(), true);
+	EXPECT_EQ(empty->empty(), true);
+	EXPECT_EQ(media.mapped("missing.txt").has_value(), false);
+	EXPECT_EQ(media.string("a.txt").value_or(""), "hello world");
+}
+
+TEST(media_mapped_outlives_source) {
+	io::MappedBytes bytes;
+	{
+		TempDir const dir("levk-media-test");
+		dir.write("a.bin", "0123456789");
+		auto mapped = io::MappedBytes::map((dir.path / "a.bin").generic_string());
+		ASSERT_EQ(mapped.has_value(), true);
+		bytes = std::move(*mapped);
+	}
+	EXPECT_EQ(bytes.view(), "0123456789");
+	auto const own = io::MappedBytes::own(bytearray(4, std::byte{0x7f}));
+	EXPECT_EQ(own.mapped(), false);
+	EXPECT_EQ(own.size(), 4U);
+}
+
+// only implements sstream(): string() must not require bytes() / mapped()
+struct StreamMedia : io::Media {
+	Info const& info() const noexcept override {
+		static Info const ret{"StreamMedia", Flag::eRead};
+		return ret;
+	}
+	std::optional<std::stringstream> sstream(io::Path const& uri) const override {
+		if (uri == "s.txt") { return std::stringstream("streamed"); }
+		return std::nullopt;
+	}
+
+  private:
+	std::optional<io::Path> findPrefixed(io::Path const& uri) const override { return uri; }
+};
+
+TEST(media_string_sstream) {
+	StreamMedia const media;
+	EXPECT_EQ(media.mapped("s.txt").has_value(), false);
+	EXPECT_EQ(media.string("s.txt").value_or(""), "streamed");
+	EXPECT_EQ(media.string("missing.txt").has_value(), false);
+}
+
+TEST(media_path_cache) {
+	TempDir const dir("levk-media-cache-test");
+	dir.write("a/x.txt", "a");
+	dir.write("a/sub/y.txt", "y");
+	dir.write("b/x.txt", "b");
+	dir.write("b/z.txt", "z");
+	io::FSMedia media;
+	ASSERT_EQ(media.mount((dir.path / "a").generic_string()), true);
+	ASSERT_EQ(media.mount((dir.path / "b").generic_string()), true);
+	// earlier mounts take precedence
+	EXPECT_EQ(media.string("x.txt").value_or(""), "a");
+	EXPECT_EQ(media.string("sub/y.txt").value_or(""), "y");
+	EXPECT_EQ(media.string("z.txt").value_or(""), "z");
+	auto stats = media.stats();
+	EXPECT_EQ(stats.scans, 1U);
+	EXPECT_EQ(stats.hits, 3U);
+	EXPECT_EQ(stats.probes, 0U);
+	// files created after the scan are found by probing mounts, then cached
+	EXPECT_EQ(media.present("w.txt", std::nullopt), false);
+	dir.write("b/w.txt", "w");
+	EXPECT_EQ(media.string("w.txt").value_or(""), "w");
+	EXPECT_EQ(media.string("w.txt").value_or(""), "w");
+	stats = media.stats();
+	EXPECT_EQ(stats.misses, 2U);
+	EXPECT_EQ(stats.probes, 4U);
+	EXPECT_EQ(stats.hits, 4U);
+	// shadowing files require invalidation
+	dir.write("a/z.txt", "shadow");
+	EXPECT_EQ(media.string("z.txt").value_or(""), "z");
+	media.invalidate(media.fullPath("z.txt"));
+	EXPECT_EQ(media.string("z.txt").value_or(""), "shadow");
+	// remount rescans
+	ASSERT_EQ(media.mount((dir.path / "b").generic_string()), true);
+	EXPECT_EQ(media.present("z.txt", std::nullopt), true);
+	EXPECT_EQ(media.stats().scans, 2U);
+	// deleted files fall through to later mounts
+	dir.write("a/d.txt", "a");
+	dir.write("b/d.txt", "b");
+	media.invalidate();
+	EXPECT_EQ(media.string("d.txt").value_or(""), "a");
+	stdfs::remove(dir.path / "a/d.txt");
+	EXPECT_EQ(media.string("d.txt").value_or(""), "b");
+	EXPECT_EQ(media.string("d.txt").value_or(""), "b");
+	stdfs::remove(dir.path / "b/d.txt");
+	EXPECT_EQ(media.string("d.txt").has_value(), false);
+}
+
+TEST(media_path_cache_threads) {
+	TempDir const dir("levk-media-cache-threads");
+	for (int i = 0; i < 64; ++i) { dir.write(fmt::format("a/{}.txt", i), "a"); }
+	io::FSMedia media;
+	ASSERT_EQ(media.mount((dir.path / "a").generic_string()), true);
+	std::atomic<int> found{};
+	{
+		std::vector<std::jthread> threads;
+		for (int t = 0; t < 4; ++t) {
+			threads.emplace_back([&] {
+				for (int i = 0; i < 256; ++i) {
+					if (media.present(fmt::format("{}.txt", i % 64), std::nullopt)) { ++found; }
+					// concurrent rescans must not lose or corrupt lookups
+					if (i % 64 == 0) { media.invalidate(); }
+				}
+			});
+		}
+	}
+	EXPECT_EQ(found.load(), 4 * 256);
+}
+} // namespace
@@ -0,0 +1,131 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/graphics/mesh_optimizer.hpp>
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace {
+using namespace le;
+using graphics::Geometry;
+using graphics::MeshOptimizer;
+using graphics::Vertex;
+
+// quads x quads grid with shared vertices
+Geometry makeGrid(u32 quads) {
+	Geometry ret;
+	for (u32 y = 0; y <= quads; ++y) {
+		for (u32 x = 0; x <= quads; ++x) {
+			Vertex vertex;
+			vertex.position = {f32(x), f32(y), 0.0f};
+			ret.vertices.push_back(vertex);
+		}
+	}
+	u32 const row = quads + 1;
+	for (u32 y = 0; y < quads; ++y) {
+		for (u32 x = 0; x < quads; ++x) {
+			u32 const i = y * row + x;
+			std::array const quad = {i, i + 1, i + row + 1, i + row + 1, i + row, i};
+			ret.indices.insert(ret.indices.end(), quad.begin(), quad.end());
+		}
+	}
+	return ret;
+}
+
+void shuffleTriangles(Geometry& out_geom, u32 seed) {
+	std::vector<std::array<u32, 3>> triangles;
+	for (std::size_t i = 0; i < out_geom.indices.size(); i += 3) {
+		triangles.push_back({out_geom.indices[i], out_geom.indices[i + 1], out_geom.indices[i + 2]});
+	}
+	std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+	out_geom.indices.clear();
+	for (auto const& tri : triangles) { out_geom.indices.insert(out_geom.indices.end(), tri.begin(), tri.end()); }
+}
+
+using Triangle = std::array<f32, 9>;
+
+// triangles by vertex position, rotated to start at the smallest vertex (preserves winding)
+std::vector<Triangle> triangles(Geometry const& geom) {
+	std::vector<Triangle> ret;
+	for (std::size_t i = 0; i < geom.indices.size(); i += 3) {
+		std::array<std::array<f32, 3>, 3> tri;
+		for (std::size_t k = 0; k < 3; ++k) {
+			auto const& p = geom.vertices[geom.indices[i + k]].position;
+			tri[k] = {p.x, p.y, p.z};
+		}
+		std::rotate(tri.begin(), std::min_element(tri.begin(), tri.end()), tri.end());
+		ret.push_back({tri[0][0], tri[0][1], tri[0][2], tri[1][0], tri[1][1], tri[1][2], tri[2][0], tri[2][1], tri[2][2]});
+	}
+	std::sort(ret.begin(), ret.end());
+	return ret;
+}
+
+MeshOptimizer::Stats analyze(Geometry const& geom) { return MeshOptimizer::analyze(geom.indices, u32(geom.vertices.size())); }
+
+TEST(mesh_optimizer_analyze) {
+	// two triangles sharing an edge: 4 transforms
+	std::array<u32, 6> const quad = {0, 1, 2, 2, 3, 0};
+	auto const stats = MeshOptimizer::analyze(quad, 4);
+	EXPECT_EQ(stats.acmr, 2.0f);
+	EXPECT_EQ(stats.atvr, 1.0f);
+	// invalid input
+	EXPECT_EQ(MeshOptimizer::analyze(quad, 3).acmr, 0.0f);
+}
+
+TEST(mesh_optimizer_shuffled) {
+	auto geom = makeGrid(64);
+	shuffleTriangles(geom, 42);
+	auto const before = analyze(geom);
+	auto const tris = triangles(geom);
+	MeshOptimizer{}(geom);
+	auto const after = analyze(geom);
+	EXPECT_EQ(after.acmr < before.acmr, true);
+	EXPECT_EQ(after.atvr < before.atvr, true);
+	// a regular grid should get well under one transform per triangle
+	EXPECT_EQ(after.acmr < 0.9f, true);
+	EXPECT_EQ(triangles(geom) == tris, true);
+}
+
+TEST(mesh_optimizer_ordered) {
+	// scanline order thrashes a 16 entry cache when rows are longer than it
+	auto geom = makeGrid(64);
+	auto const before = analyze(geom);
+	auto const tris = triangles(geom);
+	MeshOptimizer{}(geom);
+	auto const after = analyze(geom);
+	EXPECT_EQ(after.acmr < before.acmr, true);
+	EXPECT_EQ(after.atvr < before.atvr, true);
+	EXPECT_EQ(triangles(geom) == tris, true);
+}
+
+TEST(mesh_optimizer_fetch_order) {
+	auto geom = makeGrid(16);
+	shuffleTriangles(geom, 7);
+	// unreferenced vertex is kept (moved last)
+	Vertex orphan;
+	orphan.position = {-1.0f, -1.0f, -1.0f};
+	geom.vertices.insert(geom.vertices.begin(), orphan);
+	for (auto& index : geom.indices) { ++index; }
+	auto const count = geom.vertices.size();
+	auto const tris = triangles(geom);
+	MeshOptimizer{}(geom);
+	EXPECT_EQ(geom.vertices.size(), count);
+	EXPECT_EQ(geom.vertices.back().position == orphan.position, true);
+	// vertices are referenced in increasing order of first use
+	u32 next = 0;
+	bool sequential = true;
+	for (u32 const index : geom.indices) {
+		if (index > next) { sequential = false; }
+		if (index == next) { ++next; }
+	}
+	EXPECT_EQ(sequential, true);
+	EXPECT_EQ(triangles(geom) == tris, true);
+}
+
+TEST(mesh_optimizer_invalid) {
+	auto geom = makeGrid(2);
+	geom.indices.back() = 100;
+	auto const indices = geom.indices;
+	MeshOptimizer{}(geom);
+	EXPECT_EQ(geom.indices == indices, true);
+}
+} // namespace
@@ -0,0 +1,135 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/scan_mesh.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <levk/graphics/mesh_optimizer.hpp>
+#include <levk/graphics/meshlet.hpp>
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace {
+using namespace le;
+using graphics::ClusterCuller;
+using graphics::Frustum;
+using graphics::Geometry;
+using graphics::Meshlet;
+using graphics::MeshletBuilder;
+using graphics::MeshOptimizer;
+using test::makeScan;
+
+void shuffleTriangles(Geometry& out_geom, u32 seed) {
+	std::vector<std::array<u32, 3>> triangles;
+	for (std::size_t i = 0; i < out_geom.indices.size(); i += 3) {
+		triangles.push_back({out_geom.indices[i], out_geom.indices[i + 1], out_geom.indices[i + 2]});
+	}
+	std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+	out_geom.indices.clear();
+	for (auto const& triangle : triangles) { out_geom.indices.insert(out_geom.indices.end(), triangle.begin(), triangle.end()); }
+}
+
+// camera at eye looking at origin
+Frustum makeFrustum(glm::vec3 eye) {
+	auto const proj = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+	auto const view = glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	return Frustum::make(proj * view);
+}
+
+bool backfacing(Geometry const& geom, std::size_t first, glm::vec3 const& eye) {
+	auto const& a = geom.vertices[geom.indices[first]].position;
+	auto const& b = geom.vertices[geom.indices[first + 1]].position;
+	auto const& c = geom.vertices[geom.indices[first + 2]].position;
+	return glm::dot(glm::cross(b - a, c - a), eye - a) <= 0.0f;
+}
+
+bool coversOnce(std::vector<Meshlet> const& meshlets, Geometry const& geom, MeshletBuilder const& builder) {
+	u32 next{};
+	for (auto const& meshlet : meshlets) {
+		// contiguous, non empty, whole triangles
+		if (meshlet.firstIndex != next || meshlet.indexCount == 0 || meshlet.indexCount % 3 != 0) { return false; }
+		if (meshlet.indexCount / 3 > builder.maxTriangles) { return false; }
+		std::vector<u32> vertices(geom.indices.begin() + meshlet.firstIndex, geom.indices.begin() + meshlet.firstIndex + meshlet.indexCount);
+		std::sort(vertices.begin(), vertices.end());
+		if (std::unique(vertices.begin(), vertices.end()) - vertices.begin() > std::ptrdiff_t(builder.maxVertices)) { return false; }
+		next += meshlet.indexCount;
+	}
+	return next == geom.indices.size();
+}
+
+TEST(meshlet_coverage) {
+	for (u32 const seed : {0U, 7U}) {
+		auto geom = makeScan(64, 128);
+		if (seed > 0) { shuffleTriangles(geom, seed); }
+		for (auto const builder : {MeshletBuilder{}, MeshletBuilder{32, 48}, MeshletBuilder{3, 1}}) {
+			auto const meshlets = builder(geom);
+			EXPECT_EQ(meshlets.empty(), false);
+			EXPECT_EQ(coversOnce(meshlets, geom, builder), true);
+		}
+	}
+	// invalid input
+	Geometry bad;
+	bad.vertices.resize(3);
+	bad.indices = {0, 1, 5};
+	EXPECT_EQ(MeshletBuilder{}(bad).empty(), true);
+	bad.indices = {0, 1};
+	EXPECT_EQ(MeshletBuilder{}(bad).empty(), true);
+}
+
+TEST(meshlet_bounds) {
+	auto geom = makeScan(64, 128);
+	MeshOptimizer{}(geom);
+	auto const meshlets = MeshletBuilder{}(geom);
+	std::size_t cones{};
+	for (auto const& meshlet : meshlets) {
+		for (u32 i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; ++i) {
+			auto const& position = geom.vertices[geom.indices[i]].position;
+			EXPECT_EQ(glm::length(position - meshlet.centre) <= meshlet.radius * 1.0001f, true);
+		}
+		if (meshlet.coneCutoff < 1.0f) { ++cones; }
+	}
+	// clusters of a dense, smooth surface are nearly flat
+	EXPECT_EQ(cones > meshlets.size() * 9 / 10, true);
+}
+
+TEST(cluster_cull_backfacing) {
+	auto geom = makeScan(64, 128);
+	MeshOptimizer{}(geom);
+	auto const meshlets = MeshletBuilder{}(geom);
+	glm::vec3 const eye = {0.0f, 0.0f, 5.0f};
+	ClusterCuller const culler{makeFrustum(eye), eye};
+	glm::mat4 const identity(1.0f);
+	std::size_t culled{};
+	for (auto const& meshlet : meshlets) {
+		if (culler.visible(meshlet, identity)) { continue; }
+		++culled;
+		// conservative: every triangle of a culled meshlet faces away
+		for (u32 i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; i += 3) { EXPECT_EQ(backfacing(geom, i, eye), true); }
+	}
+	// roughly half the sphere faces away
+	EXPECT_EQ(culled > meshlets.size() / 4 && culled < meshlets.size() * 3 / 4, true);
+	// without an eye only the frustum culls (all in view here)
+	EXPECT_EQ(std::all_of(meshlets.begin(), meshlets.end(), [&](Meshlet const& m) { return ClusterCuller{culler.frustum}.visible(m, identity); }), true);
+}
+
+TEST(cluster_cull_frustum) {
+	auto geom = makeScan(32, 64);
+	auto const meshlets = MeshletBuilder{32, 32}(geom);
+	glm::vec3 const eye = {0.0f, 0.0f, 5.0f};
+	ClusterCuller const culler{makeFrustum(eye)};
+	std::vector<ClusterCuller::Range> ranges;
+	// behind the camera
+	auto const behind = glm::translate(glm::mat4(1.0f), {0.0f, 0.0f, 10.0f});
+	EXPECT_EQ(culler(meshlets, behind, ranges), 0U);
+	EXPECT_EQ(ranges.empty(), true);
+	// one instance in view, one behind: visible to any instance is visible
+	std::array const instances = {behind, glm::mat4(1.0f)};
+	EXPECT_EQ(culler(meshlets, instances, ranges), u32(meshlets.size()));
+	// all meshlets are adjacent: merged into one range
+	EXPECT_EQ(ranges.size(), 1U);
+	EXPECT_EQ(ranges.front().indexCount, u32(geom.indices.size()));
+	// straddling the left plane
+	ranges.clear();
+	auto const straddle = glm::translate(glm::mat4(1.0f), {-2.9f, 0.0f, 0.0f});
+	auto const visible = culler(meshlets, straddle, ranges);
+	EXPECT_EQ(visible > 0U && visible < u32(meshlets.size()), true);
+}
+} // namespace
@@ -0,0 +1,59 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/graphics/packed_vertex.hpp>
+#include <cmath>
+#include <random>
+
+namespace {
+using namespace le;
+using namespace le::graphics;
+
+bool near(glm::vec3 const& a, glm::vec3 const& b, f32 epsilon) {
+	return std::abs(a.x - b.x) <= epsilon && std::abs(a.y - b.y) <= epsilon && std::abs(a.z - b.z) <= epsilon;
+}
+
+TEST(packed_vertex_normals) {
+	glm::vec3 const axes[] = {{1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}};
+	for (auto const& axis : axes) { EXPECT_EQ(near(packing::unpackNormal(packing::normal(axis)), axis, 1e-4f), true); }
+	std::mt19937 engine(42);
+	std::uniform_real_distribution<f32> dist(-1.0f, 1.0f);
+	for (int i = 0; i < 1000; ++i) {
+		glm::vec3 n(dist(engine), dist(engine), dist(engine));
+		if (glm::length(n) < 0.01f) { continue; }
+		n = glm::normalize(n);
+		EXPECT_EQ(near(packing::unpackNormal(packing::normal(n)), n, 1e-3f), true);
+	}
+}
+
+TEST(packed_vertex_positions) {
+	AABB const bounds{glm::vec3(-10.0f, 0.0f, 5.0f), glm::vec3(30.0f, 2.0f, 5.0f)};
+	auto const dequantize = Dequantize::make(bounds);
+	glm::vec3 const points[] = {bounds.min, bounds.max, bounds.centre(), {0.0f, 1.5f, 5.0f}, {29.99f, 0.001f, 5.0f}};
+	// error bound: half a quantization step of the largest extent
+	f32 const epsilon = 20.0f / 32767.0f;
+	for (auto const& point : points) {
+		EXPECT_EQ(near(packing::unpackPosition(packing::position(point, dequantize), dequantize), point, epsilon), true);
+	}
+	// out of bounds positions are clamped
+	auto const clamped = packing::unpackPosition(packing::position(glm::vec3(100.0f, 1.0f, 5.0f), dequantize), dequantize);
+	EXPECT_EQ(near(clamped, glm::vec3(30.0f, 1.0f, 5.0f), epsilon), true);
+}
+
+TEST(packed_vertex_compact) {
+	Vertex vertex;
+	vertex.position = {1.0f, 2.0f, 3.0f};
+	vertex.colour = {1.0f, 0.0f, 0.5f, 1.0f};
+	vertex.normal = glm::normalize(glm::vec3(1.0f, -1.0f, -1.0f));
+	vertex.texCoord = {0.25f, 2.5f};
+	auto const compact = packing::compact(vertex);
+	EXPECT_EQ(compact.position == vertex.position, true);
+	// R8G8B8A8: x in the lowest byte
+	EXPECT_EQ(compact.colour & 0xffU, 0xffU);
+	EXPECT_EQ((compact.colour >> 8U) & 0xffU, 0U);
+	EXPECT_EQ((compact.colour >> 16U) & 0xffU, 128U);
+	EXPECT_EQ(near(packing::unpackNormal(compact.normal), vertex.normal, 1e-3f), true);
+	// 0.25 and 2.5 are exact in half precision
+	EXPECT_EQ(compact.texCoord, packing::texCoord(vertex.texCoord));
+	EXPECT_EQ(compact.texCoord & 0xffffU, 0x3400U);
+	EXPECT_EQ(compact.texCoord >> 16U, 0x4100U);
+}
+} // namespace
@@ -0,0 +1,45 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/graphics/render/pipeline_cache.hpp>
+#include <cstring>
+
+using namespace le;
+using namespace le::graphics;
+
+namespace {
+PhysicalDevice makeDevice() {
+	PhysicalDevice ret;
+	ret.properties.vendorID = 0x10de;
+	ret.properties.deviceID = 0x1234;
+	for (u8 i = 0; i < VK_UUID_SIZE; ++i) { ret.properties.pipelineCacheUUID[i] = i; }
+	return ret;
+}
+
+bytearray makeHeader(PhysicalDevice const& device) {
+	u32 const header[] = {16 + VK_UUID_SIZE, u32(vk::PipelineCacheHeaderVersion::eOne), device.properties.vendorID, device.properties.deviceID};
+	bytearray ret(sizeof(header) + VK_UUID_SIZE + 8);
+	std::memcpy(ret.data(), header, sizeof(header));
+	std::memcpy(ret.data() + sizeof(header), device.properties.pipelineCacheUUID.data(), VK_UUID_SIZE);
+	return ret;
+}
+
+TEST(pipeline_cache_compatible) {
+	auto const device = makeDevice();
+	auto const data = makeHeader(device);
+	EXPECT_EQ(PipelineCache::compatible(device, data), true);
+	EXPECT_EQ(PipelineCache::compatible(device, {}), false);
+	EXPECT_EQ(PipelineCache::compatible(device, Span<std::byte const>(data.data(), 8)), false);
+}
+
+TEST(pipeline_cache_mismatch) {
+	auto const device = makeDevice();
+	auto data = makeHeader(device);
+	auto other = device;
+	other.properties.deviceID = 0x4321;
+	EXPECT_EQ(PipelineCache::compatible(other, data), false);
+	other = device;
+	other.properties.pipelineCacheUUID[3] = 0xff;
+	EXPECT_EQ(PipelineCache::compatible(other, data), false);
+	data[4] = std::byte{2};
+	EXPECT_EQ(PipelineCache::compatible(device, data), false);
+}
+} // namespace
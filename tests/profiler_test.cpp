@@ -0,0 +1,112 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/core/utils/profiler.hpp>
+#include <algorithm>
+#include <string>
+#include <thread>
+
+using namespace le;
+
+namespace {
+using Profiler = utils::ThreadProfiler;
+
+std::size_t count(std::string_view str, std::string_view token) {
+	std::size_t ret{};
+	for (auto pos = str.find(token); pos != std::string_view::npos; pos = str.find(token, pos + token.size())) { ++ret; }
+	return ret;
+}
+
+TEST(profiler_nested) {
+	Profiler profiler(Profiler::CreateInfo{64, "thread", true});
+	Profiler::nameThread("test-main");
+	{
+		auto outer = profiler.profile("outer");
+		{ auto inner = profiler.profile("inner"); }
+		{ auto inner = profiler.profile("inner"); }
+	}
+	auto const threads = profiler.capture();
+	ASSERT_EQ(threads.size(), 1U);
+	auto const& thread = threads[0];
+	EXPECT_EQ(thread.name, "test-main");
+	ASSERT_EQ(thread.zones.size(), 3U);
+	// zones are recorded on close
+	EXPECT_EQ(thread.zones[0].name, "inner");
+	EXPECT_EQ(thread.zones[0].depth, 1U);
+	EXPECT_EQ(thread.zones[2].name, "outer");
+	EXPECT_EQ(thread.zones[2].depth, 0U);
+	EXPECT_EQ(thread.zones[2].start <= thread.zones[0].start && thread.zones[0].end <= thread.zones[2].end, true);
+	profiler.next(1ms);
+	auto const frame = profiler.lastFrame();
+	ASSERT_EQ(frame.entries.size(), 2U);
+	EXPECT_EQ(frame.entries[0].name, "outer");
+	EXPECT_EQ(frame.entries[1].name, "inner");
+	EXPECT_EQ(frame.entries[1].dt == thread.zones[0].dt() + thread.zones[1].dt(), true);
+	profiler.next(1ms);
+	EXPECT_EQ(profiler.lastFrame().entries.empty(), true);
+}
+
+TEST(profiler_disabled) {
+	Profiler profiler(Profiler::CreateInfo{64, "thread", false});
+	{ auto zone = profiler.profile("zone"); }
+	EXPECT_EQ(profiler.capture().empty(), true);
+	profiler.enable(true);
+	{ auto zone = profiler.profile("zone"); }
+	ASSERT_EQ(profiler.capture().size(), 1U);
+	EXPECT_EQ(profiler.capture()[0].zones.size(), 1U);
+}
+
+TEST(profiler_threads) {
+	constexpr std::size_t ring = 256;
+	constexpr int zones = 1000;
+	Profiler profiler(Profiler::CreateInfo{ring, "worker", true});
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 4; ++i) {
+		threads.emplace_back([&profiler, i] {
+			if (i % 2 == 0) { Profiler::nameThread("named " + std::to_string(i)); }
+			for (int j = 0; j < zones; ++j) {
+				auto outer = profiler.profile("outer");
+				auto inner = profiler.profile("inner");
+			}
+		});
+	}
+	// capture while recording
+	for (int i = 0; i < 100; ++i) {
+		for (auto const& thread : profiler.capture()) {
+			EXPECT_EQ(thread.zones.size() <= ring, true);
+			for (auto const& zone : thread.zones) { EXPECT_EQ(zone.name == "outer" || zone.name == "inner", true); }
+		}
+	}
+	for (auto& thread : threads) { thread.join(); }
+	auto const captured = profiler.capture();
+	ASSERT_EQ(captured.size(), 4U);
+	std::size_t named{};
+	for (auto const& thread : captured) {
+		EXPECT_EQ(thread.zones.size(), ring);
+		EXPECT_EQ(thread.dropped, u64(zones * 2) - ring);
+		if (thread.name.starts_with("named ")) {
+			++named;
+		} else {
+			EXPECT_EQ(thread.name.starts_with("worker "), true);
+		}
+	}
+	EXPECT_EQ(named, 2U);
+}
+
+TEST(profiler_chrome_trace) {
+	Profiler profiler(Profiler::CreateInfo{64, "thread", true});
+	{
+		auto zone = profiler.profile("frame");
+		auto quoted = profiler.profile("\"quoted\"");
+	}
+	std::thread([&profiler] {
+		Profiler::nameThread("worker \\ 1");
+		auto zone = profiler.profile("task");
+	}).join();
+	auto const json = profiler.chromeTrace();
+	EXPECT_EQ(json.starts_with(R"({"displayTimeUnit":"ms","traceEvents":[)"), true);
+	EXPECT_EQ(count(json, R"("ph":"M")"), 2U);
+	EXPECT_EQ(count(json, R"("ph":"X")"), 3U);
+	EXPECT_EQ(count(json, R"("name":"\"quoted\"")"), 1U);
+	EXPECT_EQ(count(json, R"("name":"worker \\ 1")"), 1U);
+	EXPECT_EQ(count(json, "{"), count(json, "}"));
+}
+} // namespace
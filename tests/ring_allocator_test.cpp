@@ -0,0 +1,114 @@
+#include <dumb_test/dtest.hpp>
+#include <levk/graphics/device/ring_allocator.hpp>
+
+namespace {
+using le::graphics::RingAllocator;
+
+TEST(ring_alloc_basic) {
+	RingAllocator ring(64);
+	auto const a = ring.allocate(16);
+	auto const b = ring.allocate(16);
+	ASSERT_EQ(a.has_value() && b.has_value(), true);
+	EXPECT_EQ(*a, 0U);
+	EXPECT_EQ(*b, 16U);
+	EXPECT_EQ(ring.used(), 32U);
+	EXPECT_EQ(ring.allocate(0).has_value(), false);
+	EXPECT_EQ(ring.allocate(65).has_value(), false);
+	ring.release(*a);
+	ring.release(*b);
+	EXPECT_EQ(ring.empty(), true);
+	EXPECT_EQ(ring.used(), 0U);
+}
+
+TEST(ring_alloc_alignment) {
+	RingAllocator ring(256);
+	auto const a = ring.allocate(3, 16);
+	auto const b = ring.allocate(5, 16);
+	ASSERT_EQ(a.has_value() && b.has_value(), true);
+	EXPECT_EQ(*a, 0U);
+	EXPECT_EQ(*b, 16U);
+	EXPECT_EQ(*b % 16U, 0U);
+}
+
+TEST(ring_alloc_full) {
+	RingAllocator ring(64);
+	auto const a = ring.allocate(32);
+	auto const b = ring.allocate(32);
+	ASSERT_EQ(a.has_value() && b.has_value(), true);
+	EXPECT_EQ(ring.allocate(1).has_value(), false);
+	ring.release(*a);
+	auto const c = ring.allocate(32);
+	ASSERT_EQ(c.has_value(), true);
+	EXPECT_EQ(*c, 0U);
+	EXPECT_EQ(ring.allocate(1).has_value(), false);
+}
+
+TEST(ring_alloc_wrap) {
+	RingAllocator ring(100);
+	auto const a = ring.allocate(40);
+	auto const b = ring.allocate(40);
+	ASSERT_EQ(a.has_value() && b.has_value(), true);
+	ring.release(*a);
+	// tail space [80, 100) too small: wraps to 0
+	auto const c = ring.allocate(30);
+	ASSERT_EQ(c.has_value(), true);
+	EXPECT_EQ(*c, 0U);
+	// wrapped: only [30, 40) free
+	EXPECT_EQ(ring.allocate(11).has_value(), false);
+	auto const d = ring.allocate(10);
+	ASSERT_EQ(d.has_value(), true);
+	EXPECT_EQ(*d, 30U);
+	ring.release(*b);
+	ring.release(*c);
+	ring.release(*d);
+	EXPECT_EQ(ring.empty(), true);
+}
+
+TEST(ring_alloc_out_of_order) {
+	RingAllocator ring(48);
+	auto const a = ring.allocate(16);
+	auto const b = ring.allocate(16);
+	auto const c = ring.allocate(16);
+	ASSERT_EQ(a.has_value() && b.has_value() && c.has_value(), true);
+	ring.release(*b);
+	// a still live: nothing reclaimed
+	EXPECT_EQ(ring.used(), 48U);
+	EXPECT_EQ(ring.allocate(16).has_value(), false);
+	ring.release(*a);
+	// a and b reclaimed together
+	EXPECT_EQ(ring.used(), 16U);
+	auto const d = ring.allocate(32);
+	ASSERT_EQ(d.has_value(), true);
+	EXPECT_EQ(*d, 0U);
+	ring.release(*c);
+	ring.release(*d);
+	EXPECT_EQ(ring.empty(), true);
+}
+
+TEST(ring_alloc_churn) {
+	RingAllocator ring(1024);
+	std::uint64_t live[4]{};
+	std::size_t count{};
+	for (int i = 0; i < 1000; ++i) {
+		auto const size = std::uint64_t(1 + (i * 37) % 200);
+		auto offset = ring.allocate(size, 16);
+		if (!offset) {
+			ASSERT_EQ(count > 0, true);
+			ring.release(live[0]);
+			for (std::size_t j = 1; j < count; ++j) { live[j - 1] = live[j]; }
+			--count;
+			offset = ring.allocate(size, 16);
+			if (!offset) { continue; }
+		}
+		EXPECT_EQ(*offset % 16U, 0U);
+		EXPECT_EQ(*offset + size <= ring.capacity(), true);
+		if (count == 4) {
+			ring.release(live[0]);
+			for (std::size_t j = 1; j < count; ++j) { live[j - 1] = live[j]; }
+			--count;
+		}
+		live[count++] = *offset;
+		EXPECT_EQ(ring.used() <= ring.capacity(), true);
+	}
+}
+} // namespace
@@ -0,0 +1,71 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/scene_chains.hpp>
+#include <levk/core/maths.hpp>
+
+namespace {
+using namespace le;
+using test::chains_v;
+using test::depth_v;
+using test::makeNode;
+using test::naiveModel;
+using test::Scene;
+
+bool equal(glm::mat4 const& lhs, glm::mat4 const& rhs) {
+	for (int c = 0; c < 4; ++c) {
+		for (int r = 0; r < 4; ++r) {
+			if (!maths::equals(lhs[c][r], rhs[c][r], 0.001f)) { return false; }
+		}
+	}
+	return true;
+}
+
+TEST(scene_graph_cache) {
+	Scene scene;
+	SceneGraph graph;
+	graph.update(scene.registry);
+	EXPECT_EQ(graph.size(), chains_v * depth_v + 1);
+	EXPECT_EQ(graph.refreshed(), graph.size());
+	for (auto const leaf : scene.leaves) { EXPECT_EQ(equal(scene.registry.get<SceneNode>(leaf).model(scene.registry), naiveModel(scene.registry, leaf)), true); }
+	graph.update(scene.registry);
+	EXPECT_EQ(graph.refreshed(), std::size_t(0));
+	auto const first = scene.registry.get<SceneNode>(scene.leaves.front()).parent(scene.registry)->parent(scene.registry)->entity();
+	scene.registry.get<Transform>(first).scale(2.0f);
+	graph.update(scene.registry);
+	EXPECT_EQ(graph.refreshed(), std::size_t(3));
+	EXPECT_EQ(equal(scene.registry.get<SceneNode>(scene.leaves.front()).model(scene.registry), naiveModel(scene.registry, scene.leaves.front())), true);
+	scene.registry.get<Transform>(scene.leaves.back()).position({0.0f, 5.0f, 0.0f});
+	EXPECT_EQ(equal(scene.registry.get<SceneNode>(scene.leaves.back()).model(scene.registry), naiveModel(scene.registry, scene.leaves.back())), true);
+}
+
+TEST(scene_graph_ancestors) {
+	dens::registry registry;
+	auto const root = makeNode(registry, {});
+	auto const grandparent = makeNode(registry, root);
+	auto const parent = makeNode(registry, grandparent);
+	auto const leaf = makeNode(registry, parent);
+	auto const other = makeNode(registry, root);
+	registry.get<Transform>(other).position({0.0f, 0.0f, -3.0f});
+	SceneGraph graph;
+	graph.update(registry);
+	auto const& node = registry.get<SceneNode>(leaf);
+	auto const check = [&] { EXPECT_EQ(equal(node.model(registry), naiveModel(registry, leaf)), true); };
+	check();
+	// direct parent moved, no SceneGraph::update: picked up on access
+	registry.get<Transform>(parent).position({0.0f, 2.0f, 0.0f});
+	check();
+	// further ancestors moved: picked up by the next update
+	registry.get<Transform>(grandparent).scale(3.0f);
+	registry.get<Transform>(root).rotate(0.5f, {0.0f, 0.0f, 1.0f});
+	graph.update(registry);
+	check();
+	// reparent a mid-level node (repeatedly: revisions must never repeat)
+	registry.get<SceneNode>(parent).parent(registry, other);
+	check();
+	registry.get<SceneNode>(parent).parent(registry, grandparent);
+	check();
+	registry.get<SceneNode>(parent).parent(registry, other);
+	check();
+	graph.update(registry);
+	check();
+}
+} // namespace
@@ -0,0 +1,58 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <levk/graphics/utils/utils.hpp>
+#include <filesystem>
+
+using namespace le;
+using namespace le::graphics;
+
+namespace {
+namespace stdfs = std::filesystem;
+using test::TempDir;
+
+constexpr std::string_view shader_v = "#version 450\n#include \"common.glsl\"\nvoid main() {}\n";
+
+TEST(spirv_key_source) {
+	TempDir const dir("levk-spirv-cache-test");
+	dir.write("common.glsl", "#define FOO 1\n");
+	auto const src = dir.write("test.vert", shader_v);
+	auto const a = utils::spirVKey(src, false);
+	EXPECT_EQ(a.source, utils::spirVKey(src, false).source);
+	EXPECT_NE(a.source, utils::spirVKey(src, true).source);
+	dir.write("common.glsl", "#define FOO 2\n");
+	auto const b = utils::spirVKey(src, false);
+	EXPECT_NE(a.source, b.source);
+	dir.write("test.vert", "#version 450\n  #  include <common.glsl>\nvoid main() {}\n");
+	dir.write("common.glsl", "#define FOO 1\n");
+	EXPECT_NE(utils::spirVKey(src, false).source, b.source);
+}
+
+TEST(spirv_key_recursive_include) {
+	TempDir const dir("levk-spirv-cache-test");
+	dir.write("common.glsl", "#include \"test.vert\"\n");
+	auto const src = dir.write("test.vert", shader_v);
+	EXPECT_NE(utils::spirVKey(src).source, 0U);
+}
+
+TEST(spirv_cache_lookup) {
+	TempDir const dir("levk-spirv-cache-test");
+	dir.write("common.glsl", "#define FOO 1\n");
+	auto const src = dir.write("test.vert", shader_v);
+	auto const compiler = utils::g_compiler;
+	utils::g_compiler = "levk-no-such-compiler";
+	auto const key = utils::spirVKey(src, false);
+	EXPECT_EQ(key.compiler, 0U);
+	EXPECT_EQ(utils::cachedSpirV(src, false, false).has_value(), false);
+	// entry built by some other compiler from identical source
+	stdfs::create_directories(dir.path / utils::g_spirVCache);
+	auto const name = fmt::format("{}/test.vert.{:016x}.{:016x}.spv", utils::g_spirVCache, key.source, 42U);
+	dir.write(name, "SPIR-V");
+	auto const found = utils::cachedSpirV(src, false, false);
+	ASSERT_EQ(found.has_value(), true);
+	EXPECT_EQ(io::is_regular_file(*found), true);
+	EXPECT_EQ(utils::cachedSpirV(src, true, false).has_value(), false);
+	dir.write("common.glsl", "#define FOO 2\n");
+	EXPECT_EQ(utils::cachedSpirV(src, false, false).has_value(), false);
+	utils::g_compiler = compiler;
+}
+} // namespace
@@ -0,0 +1,53 @@
+#include <dumb_test/dtest.hpp>
+#include <fixtures/temp_dir.hpp>
+#include <fixtures/zip_writer.hpp>
+#include <levk/core/io/zip_media.hpp>
+#include <cstring>
+
+using namespace le;
+
+namespace {
+using test::blob;
+using test::TempDir;
+using test::ZipWriter;
+
+TEST(zip_stream) {
+	TempDir const dir("levk-zip-media-test");
+	auto const archive = dir.path / "test.zip";
+	auto const data = blob(100'000, 'a');
+	{
+		ZipWriter writer(archive);
+		writer.add("a.txt", "hello");
+		writer.add("data/big.bin", data);
+		writer.finish();
+	}
+	io::ZIPMedia media;
+	ASSERT_EQ(io::ZIPMedia::fsActive(), true);
+	ASSERT_EQ(media.mount(archive.generic_string()), true);
+	EXPECT_EQ(media.string("a.txt").value_or(""), "hello");
+	auto stream = media.stream("data/big.bin");
+	ASSERT_EQ(stream.has_value(), true);
+	EXPECT_EQ(stream->size(), data.size());
+	std::string read;
+	std::byte buffer[4096];
+	std::size_t chunks{};
+	auto const total = stream->read(buffer, [&](Span<std::byte const> chunk) {
+		read.append(reinterpret_cast<char const*>(chunk.data()), chunk.size());
+		++chunks;
+	});
+	EXPECT_EQ(total, data.size());
+	EXPECT_EQ(chunks, (data.size() + sizeof(buffer) - 1) / sizeof(buffer));
+	EXPECT_EQ(read == data, true);
+	EXPECT_EQ(stream->eof(), true);
+	ASSERT_EQ(stream->seek(1000), true);
+	EXPECT_EQ(stream->tell(), 1000U);
+	EXPECT_EQ(stream->read(Span(buffer, 8)), 8U);
+	EXPECT_EQ(std::memcmp(buffer, data.data() + 1000, 8), 0);
+	// archives with open files cannot be unmounted
+	EXPECT_EQ(media.unmount(archive.generic_string()), false);
+	EXPECT_EQ(media.string("a.txt").value_or(""), "hello");
+	stream.reset();
+	EXPECT_EQ(media.unmount(archive.generic_string()), true);
+	EXPECT_EQ(media.stream("a.txt").has_value(), false);
+}
+} // namespace
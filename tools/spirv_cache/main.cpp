@@ -0,0 +1,60 @@
+#include <dumb_json/json.hpp>
+#include <levk/core/io/path.hpp>
+#include <levk/core/log.hpp>
+#include <levk/graphics/utils/utils.hpp>
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+// Precompiles (Debug and Release) SPIR-V for all GLSL shaders listed in asset manifests into the SPIR-V cache
+// Usage: levk-spirv-cache <data root> <manifest>...
+
+namespace {
+using namespace le;
+
+enum class Result { eSuccess = 0, eInvalidUsage = 10, eManifestNotFound = 20, eCompileFailure };
+
+bool isGlsl(io::Path const& path) {
+	static constexpr std::array exts = {".vert", ".frag", ".comp"};
+	return path.has_extension() && std::find(exts.begin(), exts.end(), path.extension().generic_string()) != exts.end();
+}
+
+std::string uri(dj::json const& entry) {
+	if (auto uri = entry.find_as<std::string>("uri")) { return std::move(*uri); }
+	return entry.as<std::string>();
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		logE("Usage: {} <data root> <manifest>...", argv[0]);
+		return static_cast<int>(Result::eInvalidUsage);
+	}
+	io::Path const root = io::absolute(argv[1]);
+	Result ret = Result::eSuccess;
+	std::size_t count{};
+	for (int i = 2; i < argc; ++i) {
+		auto const manifest = root / argv[i];
+		dj::json json;
+		if (!json.load(manifest.generic_string())) {
+			logE("Failed to load manifest [{}]", manifest.generic_string());
+			ret = Result::eManifestNotFound;
+			continue;
+		}
+		if (!json.contains("shaders")) { continue; }
+		for (auto const& entry : json["shaders"].as<dj::vec_t>()) {
+			io::Path const glsl = root / uri(*entry);
+			if (!isGlsl(glsl)) { continue; }
+			for (bool const debug : {true, false}) {
+				if (graphics::utils::cachedSpirV(glsl, debug)) {
+					++count;
+				} else {
+					logE("Failed to compile [{}]", glsl.generic_string());
+					ret = Result::eCompileFailure;
+				}
+			}
+		}
+	}
+	logI("[{}] SPIR-V modules cached", count);
+	return static_cast<int>(ret);
+}